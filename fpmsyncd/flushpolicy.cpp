@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <math.h>
+#include "logger.h"
+#include "fpmsyncd/flushpolicy.h"
+
+using namespace std;
+using namespace swss;
+
+constexpr int FlushPolicy::INFINITE;
+constexpr int FlushPolicy::DEFAULT_LATENCY_TARGET_MS;
+constexpr double FlushPolicy::MIN_BATCH_GAIN;
+constexpr size_t FlushPolicy::LATENCY_WINDOW;
+constexpr double FlushPolicy::EWMA_ALPHA;
+constexpr double FlushPolicy::MIN_BUDGET_SCALE;
+
+static double toMs(FlushPolicy::Clock::duration d)
+{
+    return chrono::duration<double, milli>(d).count();
+}
+
+FlushPolicy::FlushPolicy(int latencyTargetMs) :
+    m_latencyTargetMs(latencyTargetMs)
+{
+    m_latencies.reserve(LATENCY_WINDOW);
+}
+
+void FlushPolicy::setLatencyTarget(int latencyTargetMs)
+{
+    m_latencyTargetMs = latencyTargetMs;
+    m_budgetScale = 1.0;
+    m_latencies.clear();
+}
+
+bool FlushPolicy::shouldFlush(size_t pending, Clock::time_point now)
+{
+    if (pending == 0)
+    {
+        m_pending = 0;
+        m_lastSeen = now;
+        m_timeoutMs = INFINITE;
+        return false;
+    }
+
+    if (m_pending == 0)
+    {
+        m_oldest = now;
+    }
+    else if (pending < m_pending)
+    {
+        /* The pipeline flushed itself when full; what is left arrived after the last check */
+        m_oldest = m_lastSeen;
+    }
+
+    if (pending > m_pending)
+    {
+        double interval = max(toMs(now - m_lastSeen), 1.0);
+        double rate = static_cast<double>(pending - m_pending) / interval;
+
+        /*
+         * The first entries after an idle pipeline restart the estimate, so a
+         * lone update after a load is not held back by the old rate
+         */
+        m_arrivalRate = m_pending ? EWMA_ALPHA * rate + (1 - EWMA_ALPHA) * m_arrivalRate : rate;
+    }
+
+    m_pending = pending;
+    m_lastSeen = now;
+
+    double age = toMs(now - m_oldest);
+    double budget = m_latencyTargetMs * m_budgetScale - m_flushCost * static_cast<double>(pending);
+    double left = budget - age;
+
+    if (left <= 0 || m_arrivalRate * left < MIN_BATCH_GAIN)
+    {
+        return true;
+    }
+
+    m_timeoutMs = max(static_cast<int>(ceil(left)), 1);
+    return false;
+}
+
+void FlushPolicy::onFlush(size_t flushed, Clock::time_point start, Clock::time_point end)
+{
+    if (flushed == 0)
+    {
+        return;
+    }
+
+    double duration = toMs(end - start);
+    m_flushCost = EWMA_ALPHA * duration / static_cast<double>(flushed) + (1 - EWMA_ALPHA) * m_flushCost;
+
+    if (m_pending)
+    {
+        m_latencies.push_back(toMs(end - m_oldest));
+        if (m_latencies.size() >= LATENCY_WINDOW)
+        {
+            updateBudgetScale();
+        }
+    }
+
+    m_pending = 0;
+    m_lastSeen = end;
+    m_timeoutMs = INFINITE;
+}
+
+void FlushPolicy::updateBudgetScale()
+{
+    size_t idx = m_latencies.size() * 99 / 100;
+    nth_element(m_latencies.begin(), m_latencies.begin() + static_cast<ptrdiff_t>(idx), m_latencies.end());
+    double p99 = m_latencies[idx];
+    m_latencies.clear();
+
+    if (p99 <= 0)
+    {
+        return;
+    }
+
+    /* Shrink the budget when over target, give it back slowly when under */
+    double ratio = m_latencyTargetMs / p99;
+    double scale = ratio < 1 ? m_budgetScale * ratio : m_budgetScale * min(ratio, 1.1);
+    m_budgetScale = min(max(scale, MIN_BUDGET_SCALE), 1.0);
+
+    SWSS_LOG_INFO("Pipeline flush p99 latency %.1f ms, target %d ms, budget scale %.2f",
+                  p99, m_latencyTargetMs, m_budgetScale);
+}
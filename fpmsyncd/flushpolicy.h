@@ -0,0 +1,78 @@
+#ifndef __FLUSHPOLICY__
+#define __FLUSHPOLICY__
+
+#include <chrono>
+#include <vector>
+#include <stddef.h>
+
+namespace swss {
+
+/*
+ * FlushPolicy decides when fpmsyncd flushes its redis pipeline.
+ *
+ * It tracks the arrival rate of pipeline entries, the time spent per flushed
+ * entry and the latency of the oldest entry at flush time. A lone update (e.g.
+ * a BFD triggered change) is flushed right away, while under load entries are
+ * held until the latency budget is used up so that batches grow as large as
+ * the target allows. The budget is scaled down when the observed p99 latency
+ * exceeds the target.
+ */
+class FlushPolicy
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static constexpr int INFINITE = -1;
+    static constexpr int DEFAULT_LATENCY_TARGET_MS = 500;
+
+    FlushPolicy(int latencyTargetMs = DEFAULT_LATENCY_TARGET_MS);
+
+    void setLatencyTarget(int latencyTargetMs);
+
+    int getLatencyTarget() const
+    {
+        return m_latencyTargetMs;
+    }
+
+    /* Returns true if the pending entries should be flushed now */
+    bool shouldFlush(size_t pending, Clock::time_point now);
+
+    /* Record a flush of the given number of entries */
+    void onFlush(size_t flushed, Clock::time_point start, Clock::time_point end);
+
+    /* Maximum select() wait in milliseconds before the pipeline must be checked again */
+    int getTimeout() const
+    {
+        return m_timeoutMs;
+    }
+
+private:
+    /* Waiting is worth it only if at least this many entries are expected to join the batch */
+    static constexpr double MIN_BATCH_GAIN = 64;
+    /* Number of flush latencies the p99 is computed over */
+    static constexpr size_t LATENCY_WINDOW = 100;
+    static constexpr double EWMA_ALPHA = 0.25;
+    static constexpr double MIN_BUDGET_SCALE = 0.1;
+
+    void updateBudgetScale();
+
+    int m_latencyTargetMs;
+    int m_timeoutMs = INFINITE;
+
+    size_t m_pending = 0;
+    Clock::time_point m_lastSeen;
+    Clock::time_point m_oldest;
+
+    /* Entries per millisecond */
+    double m_arrivalRate = 0;
+    /* Milliseconds per flushed entry */
+    double m_flushCost = 0;
+    /* Share of the latency target used as flush deadline */
+    double m_budgetScale = 1.0;
+
+    std::vector<double> m_latencies;
+};
+
+}
+
+#endif
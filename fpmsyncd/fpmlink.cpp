@@ -4,6 +4,7 @@
 #include "logger.h"
 #include "netmsg.h"
 #include "netdispatcher.h"
+#include "lib/routetrace.h"
 #include "fpmsyncd/fpmlink.h"
 
 using namespace swss;
@@ -215,6 +216,13 @@ uint64_t FpmLink::readData()
         throw system_error(errno, system_category());
     m_pos+= (uint32_t)read;
 
+    if (RouteTracer::Instance().isEnabled())
+    {
+        RouteTracer::Instance().setReceiveTime(RouteTracer::Clock::now());
+    }
+
+    m_routesync->setRouteBatching(m_routeFastPath);
+
     /* Check for complete messages */
     while (true)
     {
@@ -242,6 +250,8 @@ uint64_t FpmLink::readData()
         start += msg_len;
     }
 
+    m_routesync->setRouteBatching(false);
+
     memmove(m_messageBuffer, m_messageBuffer + start, m_pos - start);
     m_pos = m_pos - (uint32_t)start;
     return 0;
@@ -268,13 +278,13 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
          */
         bool isRaw = isRawProcessing(nl_hdr);
 
-        nl_msg *msg = nlmsg_convert(nl_hdr);
-        if (msg == NULL)
+        if (!isRaw && m_routeFastPath && m_routesync->onRouteMsgFast(nl_hdr))
         {
-            throw system_error(make_error_code(errc::bad_message), "Unable to convert nlmsg");
+            continue;
         }
 
-        nlmsg_set_proto(msg, NETLINK_ROUTE);
+        /* Anything else is written right away, after the routes batched so far */
+        m_routesync->flushRoutes();
 
         if (isRaw)
         {
@@ -288,9 +298,16 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
         }
         else
         {
+            nl_msg *msg = nlmsg_convert(nl_hdr);
+            if (msg == NULL)
+            {
+                throw system_error(make_error_code(errc::bad_message), "Unable to convert nlmsg");
+            }
+
+            nlmsg_set_proto(msg, NETLINK_ROUTE);
             NetDispatcher::getInstance().onNetlinkMessage(msg);
+            nlmsg_free(msg);
         }
-        nlmsg_free(msg);
     }
 }
 
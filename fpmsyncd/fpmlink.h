@@ -44,6 +44,15 @@ public:
 
     void processFpmMessage(fpm_msg_hdr_t* hdr);
 
+    /*
+     * Decode plain routes directly from the receive buffer and write all
+     * routes of a read() burst to the route table at once
+     */
+    void setRouteFastPath(bool enabled)
+    {
+        m_routeFastPath = enabled;
+    }
+
     bool send(nlmsghdr* nl_hdr) override;
 
 private:
@@ -52,6 +61,7 @@ private:
     char *m_messageBuffer;
     char *m_sendBuffer;
     unsigned int m_pos;
+    bool m_routeFastPath = false;
 
     bool m_connected;
     bool m_server_up;
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <inttypes.h>
+#include <getopt.h>
 #include "logger.h"
 #include "select.h"
 #include "selectabletimer.h"
@@ -11,6 +12,9 @@
 #include "fpmsyncd/fpmlink.h"
 #include "fpmsyncd/fpmsyncd.h"
 #include "fpmsyncd/routesync.h"
+#include "fpmsyncd/flushpolicy.h"
+#include "lib/recorder.h"
+#include "lib/routetrace.h"
 
 #include <netlink/route/route.h>
 
@@ -19,11 +23,8 @@ using namespace swss;
 
 // gSelectTimeout specifies the maximum wait time in milliseconds (-1 == infinite)
 static int gSelectTimeout;
-#define INFINITE -1
-#define FLUSH_TIMEOUT 500  // 500 milliseconds
-static int gFlushTimeout = FLUSH_TIMEOUT;
-// consider the traffic is small if pipeline contains < 500 entries
-#define SMALL_TRAFFIC 500
+// Decides when the pipeline is flushed, see FlushPolicy
+static FlushPolicy gFlushPolicy;
 
 /**
  * @brief fpmsyncd invokes redispipeline's flush with a timer
@@ -34,8 +35,18 @@ static int gFlushTimeout = FLUSH_TIMEOUT;
  * By setting gSelectTimeout, fpmsyncd controls the flush interval.
  * 
  * @param pipeline reference to the pipeline to be flushed
+ * @param sync route sync whose traced routes are written by the flush
  */
-void flushPipeline(RedisPipeline& pipeline);
+void flushPipeline(RedisPipeline& pipeline, RouteSync& sync);
+
+void usage()
+{
+    cout << "Usage: fpmsyncd [-l latency_ms] [-t trace_sample_rate] [-d record_location]" << endl;
+    cout << "    -l latency_ms: p99 latency target for route updates in the redis pipeline (default "
+         << FlushPolicy::DEFAULT_LATENCY_TARGET_MS << ")" << endl;
+    cout << "    -t trace_sample_rate: trace the latency of 1 of every trace_sample_rate routes (default 0, disabled)" << endl;
+    cout << "    -d record_location: set route trace record folder location (default .)" << endl;
+}
 
 /*
  * Default warm-restart timer interval for routing-stack app. To be used only if
@@ -73,6 +84,42 @@ int main(int argc, char **argv)
 {
     swss::Logger::linkToDbNative("fpmsyncd");
 
+    int opt;
+    int traceSampleRate = 0;
+    string recordLocation = Recorder::DEFAULT_DIR;
+
+    while ((opt = getopt(argc, argv, "l:t:d:h")) != -1 )
+    {
+        switch (opt)
+        {
+        case 'l':
+            gFlushPolicy.setLatencyTarget(atoi(optarg));
+            if (gFlushPolicy.getLatencyTarget() <= 0)
+            {
+                usage();
+                return EXIT_FAILURE;
+            }
+            break;
+        case 't':
+            traceSampleRate = atoi(optarg);
+            if (traceSampleRate < 0)
+            {
+                usage();
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'd':
+            recordLocation = optarg;
+            break;
+        case 'h':
+            usage();
+            return EXIT_SUCCESS;
+        default: /* '?' */
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
     const auto routeResponseChannelName = std::string("APPL_DB_") + APP_ROUTE_TABLE_NAME + "_RESPONSE_CHANNEL";
 
     DBConnector db("APPL_DB", 0);
@@ -87,6 +134,17 @@ int main(int argc, char **argv)
 
     DBConnector stateDb("STATE_DB", 0);
     Table bgpStateTable(&stateDb, STATE_BGP_TABLE_NAME);
+    Table routeTraceTable(&stateDb, RouteTracer::TABLE_NAME);
+
+    if (traceSampleRate > 0)
+    {
+        Recorder::Instance().routetrace.setRecord(true);
+        Recorder::Instance().routetrace.setLocation(recordLocation);
+        Recorder::Instance().routetrace.startRec(false);
+
+        RouteTracer::Instance().setStateTable(&routeTraceTable);
+        RouteTracer::Instance().enable("fpmsyncd", static_cast<uint32_t>(traceSampleRate));
+    }
 
     NetLink netlink;
 
@@ -113,6 +171,7 @@ int main(int argc, char **argv)
         try
         {
             FpmLink fpm(&sync);
+            fpm.setRouteFastPath(true);
 
             Select s;
             SelectableTimer warmStartTimer(timespec{0, 0});
@@ -174,7 +233,7 @@ int main(int argc, char **argv)
                 sync.getWarmStartHelper().setState(WarmStart::WSDISABLED);
             }
 
-            gSelectTimeout = INFINITE;
+            gSelectTimeout = FlushPolicy::INFINITE;
 
             while (true)
             {
@@ -310,7 +369,7 @@ int main(int argc, char **argv)
                 }
                 else if (!warmStartEnabled || sync.getWarmStartHelper().isReconciled())
                 {
-                    flushPipeline(pipeline);
+                    flushPipeline(pipeline, sync);
                 }
             }
         }
@@ -323,34 +382,20 @@ int main(int argc, char **argv)
     return 1;
 }
 
-void flushPipeline(RedisPipeline& pipeline) {
+void flushPipeline(RedisPipeline& pipeline, RouteSync& sync) {
 
     size_t remaining = pipeline.size();
+    auto now = FlushPolicy::Clock::now();
 
-    if (remaining == 0) {
-        gSelectTimeout = INFINITE;
-        return;
-    }
-
-    int idle = pipeline.getIdleTime();
-
-    // flush the pipeline if
-    // 1. traffic is not scaled (only prevent fpmsyncd from flushing ppl too frequently in the scaled case)
-    // 2. the idle time since last flush has exceeded gFlushTimeout
-    // 3. idle <= 0, due to system clock drift, should not happen since we already use steady_clock for timing
-    if (remaining < SMALL_TRAFFIC || idle >= gFlushTimeout || idle <= 0) {
-
+    if (gFlushPolicy.shouldFlush(remaining, now))
+    {
         pipeline.flush();
-
-        gSelectTimeout = INFINITE;
+        gFlushPolicy.onFlush(remaining, now, FlushPolicy::Clock::now());
+        sync.traceRoutesWritten();
 
         SWSS_LOG_DEBUG("Pipeline flushed");
     }
-    else
-    {
-        // skip flushing ppl and set the timeout of fpmsyncd select function to be (gFlushTimeout - idle)
-        // so that fpmsyncd select function would block at most for (gFlushTimeout - idle)
-        // by doing this, we make sure every entry eventually gets flushed
-        gSelectTimeout = gFlushTimeout - idle;
-    }
+
+    // Block select at most until the oldest pending entry is due, so every entry eventually gets flushed
+    gSelectTimeout = gFlushPolicy.getTimeout();
 }
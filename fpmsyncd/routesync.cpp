@@ -7,6 +7,7 @@
 #include "ipprefix.h"
 #include "dbconnector.h"
 #include "lib/orch_zmq_config.h"
+#include "lib/routetrace.h"
 #include "producerstatetable.h"
 #include "fpmsyncd/fpmlink.h"
 #include "fpmsyncd/routesync.h"
@@ -168,8 +169,19 @@ void RouteSync::setRouteWithWarmRestart(FieldValueTupleWrapperBase & fvw,
 {
     bool warmRestartInProgress = m_warmStartHelper.inProgress();
 
+    if (&table == m_routeTable.get())
+    {
+        traceRoute(fvw.key);
+    }
+
     if (!warmRestartInProgress)
     {
+        if (m_routeBatching && &table == m_routeTable.get())
+        {
+            auto kfvVector = fvw.KeyOpFieldsValuesTupleVector();
+            std::move(kfvVector.begin(), kfvVector.end(), std::back_inserter(m_routeBatch));
+            return;
+        }
         table.set(fvw.KeyOpFieldsValuesTupleVector());
     }
     else
@@ -178,6 +190,49 @@ void RouteSync::setRouteWithWarmRestart(FieldValueTupleWrapperBase & fvw,
     }
 }
 
+void RouteSync::setRouteBatching(bool enabled)
+{
+    flushRoutes();
+    m_routeBatching = enabled;
+}
+
+void RouteSync::flushRoutes()
+{
+    if (m_routeBatch.empty())
+    {
+        return;
+    }
+
+    /* One batched write for all routes set since the last flush */
+    m_routeTable->set(m_routeBatch);
+    m_routeBatch.clear();
+}
+
+void RouteSync::traceRoute(const string& key)
+{
+    auto& tracer = RouteTracer::Instance();
+    if (!tracer.isSampled(key))
+    {
+        return;
+    }
+
+    tracer.stamp(key, RouteTracer::FPM_RECV, tracer.getReceiveTime());
+    tracer.stamp(key, RouteTracer::ROUTESYNC_ENCODE);
+}
+
+void RouteSync::traceRoutesWritten()
+{
+    /* Wait for orchagent's offload reply to close the traces if there is one */
+    if (isSuppressionEnabled())
+    {
+        RouteTracer::Instance().stampAll(RouteTracer::APPL_DB_WRITE);
+    }
+    else
+    {
+        RouteTracer::Instance().completeAll(RouteTracer::APPL_DB_WRITE);
+    }
+}
+
 void RouteSync::setTable(FieldValueTupleWrapperBase & fvw,
                          ProducerStateTable & table )
 {
@@ -187,6 +242,12 @@ void RouteSync::setTable(FieldValueTupleWrapperBase & fvw,
 
 void RouteSync::delWithWarmRestart(FieldValueTupleWrapperBase && fvw,
 				   ProducerStateTable & table) {
+    /* Keep the order with the batched route sets */
+    flushRoutes();
+    if (&table == m_routeTable.get())
+    {
+        traceRoute(fvw.key);
+    }
     bool warmRestartInProgress = m_warmStartHelper.inProgress();
     if (!warmRestartInProgress) {
         table.del(fvw.key);
@@ -1656,6 +1717,180 @@ void RouteSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
 }
 
+/*
+ * Handle a regular IPv4/IPv6 route straight from the netlink message,
+ * without building a libnl route object.
+ * @arg h               Netlink message
+ *
+ * Return false if the route needs the libnl path: default routes, VNET
+ * and MPLS routes, encapsulated next hops and any attribute not decoded here.
+ * Nothing is written in that case.
+ */
+bool RouteSync::onRouteMsgFast(struct nlmsghdr *h)
+{
+    if (h->nlmsg_type != RTM_NEWROUTE && h->nlmsg_type != RTM_DELROUTE)
+    {
+        return false;
+    }
+
+    int len = (int)(h->nlmsg_len - NLMSG_LENGTH(sizeof(struct rtmsg)));
+    if (len < 0)
+    {
+        return false;
+    }
+
+    struct rtmsg *rtm = (struct rtmsg *)NLMSG_DATA(h);
+    uint8_t family = rtm->rtm_family;
+    size_t addr_len = (family == AF_INET) ? IPV4_MAX_BYTE : IPV6_MAX_BYTE;
+    if ((family != AF_INET && family != AF_INET6) || rtm->rtm_dst_len == 0)
+    {
+        return false;
+    }
+
+    struct rtattr *tb[RTA_MAX + 1] = {0};
+    netlink_parse_rtattr(tb, RTA_MAX, RTM_RTA(rtm), len);
+
+    if (!tb[RTA_DST] || (size_t)RTA_PAYLOAD(tb[RTA_DST]) != addr_len ||
+        tb[RTA_ENCAP] || tb[RTA_ENCAP_TYPE] || tb[RTA_VIA] || tb[RTA_NEWDST])
+    {
+        return false;
+    }
+
+    char destipprefix[IFNAMSIZ + MAX_ADDR_SIZE + 2] = {0};
+    size_t pos = 0;
+
+    /* Same table/VRF resolution as onMsg(): the table id is the master device index */
+    uint32_t table = tb[RTA_TABLE] ? *(uint32_t *)RTA_DATA(tb[RTA_TABLE]) : rtm->rtm_table;
+    if (table)
+    {
+        char master_name[IFNAMSIZ] = {0};
+        if (!getIfName(table, master_name, IFNAMSIZ) ||
+            memcmp(master_name, VRF_PREFIX, strlen(VRF_PREFIX)))
+        {
+            return false;
+        }
+        pos = strlen(master_name);
+        memcpy(destipprefix, master_name, pos);
+        destipprefix[pos++] = ':';
+    }
+
+    /* Format the prefix as nl_addr2str() does: no length for host routes */
+    inet_ntop(family, RTA_DATA(tb[RTA_DST]), destipprefix + pos, MAX_ADDR_SIZE);
+    if ((size_t)rtm->rtm_dst_len != addr_len * 8)
+    {
+        pos = strlen(destipprefix);
+        snprintf(destipprefix + pos, sizeof(destipprefix) - pos, "/%u", rtm->rtm_dst_len);
+    }
+
+    if (h->nlmsg_type == RTM_DELROUTE)
+    {
+        SWSS_LOG_INFO("RouteTable del msg: %s", destipprefix);
+        delWithWarmRestart(RouteTableFieldValueTupleWrapper{destipprefix, ""},
+                           *m_routeTable);
+        return true;
+    }
+
+    if (rtm->rtm_type != RTN_UNICAST && rtm->rtm_type != RTN_BLACKHOLE)
+    {
+        return false;
+    }
+
+    string gw_list;
+    string intf_list;
+    string mpls_list;
+    string weights;
+    uint32_t nhg_id = tb[RTA_NH_ID] ? *(uint32_t *)RTA_DATA(tb[RTA_NH_ID]) : 0;
+    const char *default_gw = (family == AF_INET) ? "0.0.0.0" : "::";
+
+    /* Decode all next hops before writing anything so that unsupported ones can still fall back */
+    auto addNextHop = [&](struct rtattr *gateway, int if_index, uint8_t hops) -> bool
+    {
+        if (!gw_list.empty() || !intf_list.empty())
+        {
+            gw_list += NHG_DELIMITER;
+            intf_list += NHG_DELIMITER;
+            weights += NHG_DELIMITER;
+        }
+
+        if (gateway)
+        {
+            char gw_ip[MAX_ADDR_SIZE + 1] = {0};
+            if ((size_t)RTA_PAYLOAD(gateway) != addr_len)
+            {
+                return false;
+            }
+            inet_ntop(family, RTA_DATA(gateway), gw_ip, MAX_ADDR_SIZE);
+            gw_list += gw_ip;
+        }
+        else
+        {
+            gw_list += default_gw;
+        }
+
+        char if_name[IFNAMSIZ] = "0";
+        intf_list += getIfName(if_index, if_name, IFNAMSIZ) ? if_name : "unknown";
+
+        /* Default weight is 1 */
+        weights += to_string(hops ? hops : 1);
+        return true;
+    };
+
+    if (rtm->rtm_type == RTN_UNICAST && !nhg_id)
+    {
+        if (tb[RTA_MULTIPATH])
+        {
+            struct rtnexthop *rtnh = (struct rtnexthop *)RTA_DATA(tb[RTA_MULTIPATH]);
+            int nh_len = (int)RTA_PAYLOAD(tb[RTA_MULTIPATH]);
+
+            while (nh_len >= (int)sizeof(*rtnh) && rtnh->rtnh_len >= sizeof(*rtnh) && rtnh->rtnh_len <= nh_len)
+            {
+                struct rtattr *subtb[RTA_MAX + 1] = {0};
+                netlink_parse_rtattr(subtb, RTA_MAX, RTNH_DATA(rtnh),
+                                     (int)(rtnh->rtnh_len - sizeof(*rtnh)));
+                if (subtb[RTA_ENCAP] || subtb[RTA_ENCAP_TYPE] || subtb[RTA_VIA] || subtb[RTA_NEWDST] ||
+                    !addNextHop(subtb[RTA_GATEWAY], rtnh->rtnh_ifindex, rtnh->rtnh_hops))
+                {
+                    return false;
+                }
+
+                nh_len -= NLMSG_ALIGN(rtnh->rtnh_len);
+                rtnh = RTNH_NEXT(rtnh);
+            }
+        }
+        else if (tb[RTA_GATEWAY] || tb[RTA_OIF])
+        {
+            int if_index = tb[RTA_OIF] ? *(int *)RTA_DATA(tb[RTA_OIF]) : 0;
+            if (!addNextHop(tb[RTA_GATEWAY], if_index, 0))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (!isSuppressionEnabled())
+    {
+        sendOffloadReply(h);
+    }
+    auto proto_str = getProtocolString(rtm->rtm_protocol);
+
+    if (rtm->rtm_type == RTN_BLACKHOLE)
+    {
+        SWSS_LOG_INFO("RouteTable set blackhole msg: %s", destipprefix);
+        RouteTableFieldValueTupleWrapper fvw {destipprefix, std::move(proto_str)};
+        fvw.blackhole = "true";
+        setRouteWithWarmRestart(fvw, *m_routeTable);
+        return true;
+    }
+
+    /*
+     * A unicast route without gateway and OIF is written with empty next hop
+     * lists, as the libnl path does since libnl always hands out a next hop list.
+     */
+    RouteTableFieldValueTupleWrapper fvw {destipprefix, std::move(proto_str)};
+    setRoute(fvw, destipprefix, family, nhg_id, gw_list, intf_list, mpls_list, weights);
+    return true;
+}
+
 /* 
  * Handle regular route (include VRF route) 
  * @arg nlmsg_type      Netlink message type
@@ -1751,8 +1986,42 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     string mpls_list;
     string weights;
 
-    string nhg_id_key;
     uint32_t nhg_id = rtnl_route_get_nh_id(route_obj);
+    if (!nhg_id)
+    {
+        struct nl_list_head *nhs = rtnl_route_get_nexthops(route_obj);
+        if (!nhs)
+        {
+            SWSS_LOG_INFO("Nexthop list is empty for %s", destipprefix);
+            return;
+        }
+
+        /* Get nexthop lists */
+
+        getNextHopList(route_obj, gw_list, mpls_list, intf_list);
+        weights = getNextHopWt(route_obj);
+    }
+
+    setRoute(fvw, destipprefix, rtnl_route_get_family(route_obj), nhg_id,
+             gw_list, intf_list, mpls_list, weights);
+}
+
+/*
+ * Set a regular route once its next hops are known
+ * @arg fvw             Route table entry with key and protocol filled in
+ * @arg destipprefix    Route key
+ * @arg family          Route address family
+ * @arg nhg_id          Next hop group id, 0 when the next hop lists are used
+ * @arg gw_list         Comma-separated list of NH IP gateways
+ * @arg intf_list       Comma-separated list of NH interfaces
+ * @arg mpls_list       Comma-separated list of NH MPLS info
+ * @arg weights         Comma-separated list of NH weights
+ */
+void RouteSync::setRoute(RouteTableFieldValueTupleWrapper &fvw, const char *destipprefix,
+                         uint8_t family, uint32_t nhg_id, string &gw_list,
+                         string &intf_list, string &mpls_list, string &weights)
+{
+    string nhg_id_key;
     if(nhg_id)
     {
         const auto itg = m_nh_groups.find(nhg_id);
@@ -1765,10 +2034,10 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
         if(nhg.group.size() == 0)
         {
         // Using route-table only for single next-hop
-        string nexthops = nhg.nexthop.empty() ? (rtnl_route_get_family(route_obj) == AF_INET ? "0.0.0.0" : "::") : nhg.nexthop;
+        string nexthops = nhg.nexthop.empty() ? (family == AF_INET ? "0.0.0.0" : "::") : nhg.nexthop;
         string ifnames, weights;
 
-        getNextHopGroupFields(nhg, nexthops, ifnames, weights, rtnl_route_get_family(route_obj));
+        getNextHopGroupFields(nhg, nexthops, ifnames, weights, family);
 
         fvw.nexthop = std::move(nexthops);
         fvw.ifname = std::move(ifnames);
@@ -1784,18 +2053,6 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     }
     else
     {
-        struct nl_list_head *nhs = rtnl_route_get_nexthops(route_obj);
-        if (!nhs)
-        {
-            SWSS_LOG_INFO("Nexthop list is empty for %s", destipprefix);
-            return;
-        }
-
-        /* Get nexthop lists */
-
-        getNextHopList(route_obj, gw_list, mpls_list, intf_list);
-        weights = getNextHopWt(route_obj);
-
         vector<string> alsv = tokenize(intf_list, NHG_DELIMITER);
 
         if (alsv.size() == 1)
@@ -1805,7 +2062,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
                 SWSS_LOG_DEBUG("Skip routes to eth0 or docker0: %s %s %s",
                             destipprefix, gw_list.c_str(), intf_list.c_str());
                 SWSS_LOG_INFO("RouteTable del msg for eth0/docker0 route: %s", destipprefix);
-                delWithWarmRestart(RouteTableFieldValueTupleWrapper{std::move(destipprefix), ""},
+                delWithWarmRestart(RouteTableFieldValueTupleWrapper{destipprefix, ""},
                                    *m_routeTable);
                 return;
             }
@@ -2517,6 +2774,8 @@ void RouteSync::onRouteResponse(const std::string& key, const std::vector<FieldV
         return;
     }
 
+    RouteTracer::Instance().complete(key, RouteTracer::OFFLOAD_REPLY);
+
     auto colon = key.find(':');
     if (colon != std::string::npos && key.substr(0, colon).find(VRF_PREFIX) != std::string::npos)
     {
@@ -185,6 +185,17 @@ public:
 
     virtual void onMsgRaw(struct nlmsghdr *obj);
 
+    /* Handle a plain route straight from the netlink message, false to use the libnl path */
+    bool onRouteMsgFast(struct nlmsghdr *h);
+
+    /* Collect route table sets and write them at once on flushRoutes() */
+    void setRouteBatching(bool enabled);
+
+    void flushRoutes();
+
+    /* Called once the pipeline holding the route writes has been flushed to APPL_DB */
+    void traceRoutesWritten();
+
     void setSuppressionEnabled(bool enabled);
 
     bool isSuppressionEnabled() const
@@ -251,12 +262,24 @@ private:
     ProducerStateTable  m_nexthop_groupTable;
     map<uint32_t,NextHopGroup> m_nh_groups;
 
+    /* Route table sets pending for flushRoutes() */
+    vector<KeyOpFieldsValuesTuple> m_routeBatch;
+    bool                m_routeBatching{false};
+
     bool                m_isSuppressionEnabled{false};
     FpmInterface*       m_fpmInterface {nullptr};
 
     /* Handle regular route (include VRF route) */
     void onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf);
 
+    /* Set a regular route once its next hops are decoded */
+    void setRoute(RouteTableFieldValueTupleWrapper &fvw, const char *destipprefix,
+                  uint8_t family, uint32_t nhg_id, string &gw_list,
+                  string &intf_list, string &mpls_list, string &weights);
+
+    /* Stamp a sampled route key on its way into APPL_DB, see RouteTracer */
+    void traceRoute(const string& key);
+
     /* Handle label route */
     void onLabelRouteMsg(int nlmsg_type, struct nl_object *obj);
 
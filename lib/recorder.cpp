@@ -1,7 +1,10 @@
 #include "recorder.h"
 #include "timestamp.h"
 #include "logger.h"
+#include <algorithm>
 #include <cstring>
+#include <chrono>
+#include <time.h>
 
 using namespace swss;
 
@@ -10,6 +13,14 @@ const std::string Recorder::REC_START = "|recording started";
 const std::string Recorder::SWSS_FNAME = "swss.rec";
 const std::string Recorder::SAIREDIS_FNAME = "sairedis.rec";
 const std::string Recorder::RESPPUB_FNAME = "responsepublisher.rec";
+const std::string Recorder::ROUTETRACE_FNAME = "routetrace.rec";
+
+const std::string BinaryRecord::MAGIC = std::string("SWSSREC\x01", 8);
+const std::string BinaryRecord::SUFFIX = ".bin";
+
+/* Wake the binary writer when the ring is this full, otherwise it polls */
+#define REC_RING_WAKEUP_DIVISOR 4
+#define REC_WRITER_POLL_MS 10
 
 
 Recorder& Recorder::Instance()
@@ -41,6 +52,17 @@ ResPubRec::ResPubRec()
 }
 
 
+RouteTraceRec::RouteTraceRec()
+{
+    /* Set Default values */
+    setRecord(false);
+    setRotate(false);
+    setLocation(Recorder::DEFAULT_DIR);
+    setFileName(Recorder::ROUTETRACE_FNAME);
+    setName("Route Trace");
+}
+
+
 SaiRedisRec::SaiRedisRec() 
 {
     /* Set Default values */
@@ -59,6 +81,29 @@ void RecWriter::startRec(bool exit_if_failure)
         return ;
     }
 
+    if (m_binary)
+    {
+        fname = getLoc() + "/" + getFile() + BinaryRecord::SUFFIX;
+        if (!openBinaryFile())
+        {
+            SWSS_LOG_ERROR("%s Recorder: Failed to open recording file %s: error %s", getName().c_str(), fname.c_str(), strerror(errno));
+            if (exit_if_failure)
+            {
+                exit(EXIT_FAILURE);
+            }
+            setRecord(false);
+            return;
+        }
+
+        m_ring.reset(new RecRing(m_ringSize));
+        BinaryRecord start;
+        start.type = BinaryRecord::START;
+        pushBinary(start);
+        m_writer = std::thread(&RecWriter::binaryWriterThread, this);
+        SWSS_LOG_NOTICE("%s Recorder: Binary recording started at %s", getName().c_str(), fname.c_str());
+        return;
+    }
+
     fname = getLoc() + "/" + getFile();
     record_ofs.open(fname, std::ofstream::out | std::ofstream::app);
     if (!record_ofs.is_open())
@@ -80,6 +125,26 @@ void RecWriter::startRec(bool exit_if_failure)
 
 RecWriter::~RecWriter()
 {
+    if (m_writer.joinable())
+    {
+        m_stop = true;
+        m_writerCv.notify_one();
+        m_writer.join();
+
+        /* Count the last records that did not fit in the ring */
+        if (m_dropped > 0 && record_ofs.is_open())
+        {
+            BinaryRecord dropped;
+            dropped.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+            dropped.type = BinaryRecord::DROPPED;
+            dropped.dropped = m_dropped;
+            m_encoded.clear();
+            dropped.encode(m_encoded);
+            record_ofs.write(m_encoded.data(), m_encoded.size());
+        }
+    }
+
     if (record_ofs.is_open())
     {
         record_ofs.close();      
@@ -93,15 +158,150 @@ void RecWriter::record(const std::string& val)
     {
         return ;
     }
-    if (isRotate())
+
+    if (m_binary)
+    {
+        BinaryRecord rec;
+        rec.key = val;
+        pushBinary(rec);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (takeRotate())
     {
-        setRotate(false);
         logfileReopen();
     }
     record_ofs << swss::getTimestamp() << "|" << val << std::endl;
 }
 
 
+void RecWriter::record(const std::string& key, const std::string& op, const std::vector<FieldValueTuple>& fvs)
+{
+    if (!isRecord())
+    {
+        return ;
+    }
+
+    if (m_binary)
+    {
+        BinaryRecord rec;
+        rec.key = key;
+        rec.op = op;
+        rec.fieldValues = fvs;
+        pushBinary(rec);
+        return;
+    }
+
+    std::string s = key + "|" + op;
+    for (const auto &fv : fvs)
+    {
+        s += "|" + fvField(fv) + ":" + fvValue(fv);
+    }
+    record(s);
+}
+
+
+void RecWriter::pushBinary(const BinaryRecord& rec)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (!m_ring)
+    {
+        return;
+    }
+
+    uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    if (m_dropped > 0)
+    {
+        BinaryRecord dropped;
+        dropped.timestamp = now;
+        dropped.type = BinaryRecord::DROPPED;
+        dropped.dropped = m_dropped;
+        m_encoded.clear();
+        dropped.encode(m_encoded);
+        if (!m_ring->push(m_encoded.data(), m_encoded.size()))
+        {
+            m_dropped++;
+            return;
+        }
+        m_dropped = 0;
+    }
+
+    m_encoded.clear();
+    rec.encode(m_encoded);
+    /* Stamp the record with the time it is pushed */
+    memcpy(&m_encoded[sizeof(uint32_t)], &now, sizeof(now));
+    if (!m_ring->push(m_encoded.data(), m_encoded.size()))
+    {
+        m_dropped++;
+        return;
+    }
+
+    if (m_ring->used() > m_ring->size() / REC_RING_WAKEUP_DIVISOR)
+    {
+        m_writerCv.notify_one();
+    }
+}
+
+
+bool RecWriter::openBinaryFile()
+{
+    if (record_ofs.is_open())
+    {
+        record_ofs.close();
+    }
+
+    record_ofs.open(fname, std::ofstream::out | std::ofstream::app | std::ofstream::binary);
+    if (!record_ofs.is_open())
+    {
+        return false;
+    }
+
+    /* A new or rotated file starts with the magic */
+    if (record_ofs.tellp() == 0)
+    {
+        record_ofs.write(BinaryRecord::MAGIC.data(), BinaryRecord::MAGIC.size());
+    }
+    return true;
+}
+
+
+void RecWriter::binaryWriterThread()
+{
+    std::string data;
+
+    while (true)
+    {
+        bool stop = m_stop;
+
+        if (takeRotate())
+        {
+            if (!openBinaryFile())
+            {
+                SWSS_LOG_ERROR("%s Recorder: Failed to open file %s: %s", getName().c_str(), fname.c_str(), strerror(errno));
+            }
+        }
+
+        data.clear();
+        if (m_ring->pop(data) > 0 && record_ofs.is_open())
+        {
+            record_ofs.write(data.data(), data.size());
+            record_ofs.flush();
+        }
+
+        if (stop)
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(m_writerLock);
+        m_writerCv.wait_for(lock, std::chrono::milliseconds(REC_WRITER_POLL_MS));
+    }
+}
+
+
 void RecWriter::logfileReopen()
 {
     /*
@@ -119,3 +319,225 @@ void RecWriter::logfileReopen()
     }
     SWSS_LOG_INFO("%s Recorder: LogRotate request handled", getName().c_str());
 }
+
+
+RecRing::RecRing(size_t size) :
+    m_buf(size),
+    m_head(0),
+    m_tail(0)
+{
+}
+
+
+bool RecRing::push(const char *data, size_t len)
+{
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    uint64_t tail = m_tail.load(std::memory_order_acquire);
+    if (len > m_buf.size() - static_cast<size_t>(head - tail))
+    {
+        return false;
+    }
+
+    size_t pos = static_cast<size_t>(head % m_buf.size());
+    size_t first = std::min(len, m_buf.size() - pos);
+    memcpy(&m_buf[pos], data, first);
+    memcpy(&m_buf[0], data + first, len - first);
+
+    m_head.store(head + len, std::memory_order_release);
+    return true;
+}
+
+
+size_t RecRing::pop(std::string &out)
+{
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    size_t len = static_cast<size_t>(head - tail);
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    size_t pos = static_cast<size_t>(tail % m_buf.size());
+    size_t first = std::min(len, m_buf.size() - pos);
+    out.append(&m_buf[pos], first);
+    out.append(&m_buf[0], len - first);
+
+    m_tail.store(head, std::memory_order_release);
+    return len;
+}
+
+
+static void appendU32(std::string &out, uint32_t value)
+{
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+
+static void appendString(std::string &out, const std::string &str)
+{
+    appendU32(out, static_cast<uint32_t>(str.size()));
+    out.append(str);
+}
+
+
+void BinaryRecord::encode(std::string &out) const
+{
+    size_t start = out.size();
+    appendU32(out, 0);
+    out.append(reinterpret_cast<const char *>(&timestamp), sizeof(timestamp));
+    out.push_back(static_cast<char>(type));
+
+    switch (type)
+    {
+        case ENTRY:
+            appendString(out, key);
+            appendString(out, op);
+            appendU32(out, static_cast<uint32_t>(fieldValues.size()));
+            for (const auto &fv : fieldValues)
+            {
+                appendString(out, fvField(fv));
+                appendString(out, fvValue(fv));
+            }
+            break;
+        case DROPPED:
+            out.append(reinterpret_cast<const char *>(&dropped), sizeof(dropped));
+            break;
+        default:
+            break;
+    }
+
+    uint32_t len = static_cast<uint32_t>(out.size() - start - sizeof(uint32_t));
+    memcpy(&out[start], &len, sizeof(len));
+}
+
+
+namespace {
+
+class RecordReader {
+public:
+    RecordReader(const std::string &data) : m_data(data) {}
+
+    template<typename T>
+    bool read(T &value)
+    {
+        if (m_data.size() - m_pos < sizeof(T))
+        {
+            return false;
+        }
+        memcpy(&value, &m_data[m_pos], sizeof(T));
+        m_pos += sizeof(T);
+        return true;
+    }
+
+    bool read(std::string &str)
+    {
+        uint32_t len;
+        if (!read(len) || m_data.size() - m_pos < len)
+        {
+            return false;
+        }
+        str.assign(m_data, m_pos, len);
+        m_pos += len;
+        return true;
+    }
+
+private:
+    const std::string &m_data;
+    size_t m_pos = 0;
+};
+
+}
+
+
+bool BinaryRecord::decode(std::istream &in)
+{
+    uint32_t len;
+    if (!in.read(reinterpret_cast<char *>(&len), sizeof(len)))
+    {
+        return false;
+    }
+
+    std::string data(len, '\0');
+    if (!in.read(&data[0], len))
+    {
+        return false;
+    }
+
+    RecordReader reader(data);
+    uint8_t t;
+    if (!reader.read(timestamp) || !reader.read(t))
+    {
+        return false;
+    }
+    type = static_cast<Type>(t);
+
+    key.clear();
+    op.clear();
+    fieldValues.clear();
+    dropped = 0;
+
+    switch (type)
+    {
+        case ENTRY:
+        {
+            uint32_t count;
+            if (!reader.read(key) || !reader.read(op) || !reader.read(count))
+            {
+                return false;
+            }
+            for (uint32_t i = 0; i < count; i++)
+            {
+                std::string field, value;
+                if (!reader.read(field) || !reader.read(value))
+                {
+                    return false;
+                }
+                fieldValues.emplace_back(field, value);
+            }
+            return true;
+        }
+        case START:
+            return true;
+        case DROPPED:
+            return reader.read(dropped);
+        default:
+            return false;
+    }
+}
+
+
+std::string BinaryRecord::toText() const
+{
+    /* Same timestamp format as swss::getTimestamp() */
+    time_t sec = static_cast<time_t>(timestamp / 1000000);
+    struct tm tm;
+    localtime_r(&sec, &tm);
+    char buf[64];
+    size_t n = strftime(buf, sizeof(buf), "%Y-%m-%d.%T", &tm);
+    snprintf(buf + n, sizeof(buf) - n, ".%06lu", static_cast<unsigned long>(timestamp % 1000000));
+
+    std::string s = buf;
+    switch (type)
+    {
+        case START:
+            s += Recorder::REC_START;
+            break;
+        case DROPPED:
+            s += "|recording dropped " + std::to_string(dropped) + " records";
+            break;
+        default:
+            s += "|" + key;
+            /* Records of preformatted text have no op */
+            if (!op.empty())
+            {
+                s += "|" + op;
+            }
+            for (const auto &fv : fieldValues)
+            {
+                s += "|" + fvField(fv) + ":" + fvValue(fv);
+            }
+            break;
+    }
+    return s;
+}
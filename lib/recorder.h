@@ -5,6 +5,13 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <vector>
+
+#include "table.h"
 
 namespace swss {
 
@@ -21,31 +28,125 @@ public:
     /* getters */
     bool isRecord()  { return m_recording; }
     bool isRotate()  { return m_rotate; }
+    /* Clear the rotate request, returns whether it was set */
+    bool takeRotate()  { return m_rotate.exchange(false); }
     std::string getLoc() { return m_location; }
     std::string getFile() { return m_filename; }
     std::string getName() { return m_name; }
 
 private:
     bool m_recording;
-    bool m_rotate;
+    /* Set from the SIGHUP handler, read by the binary writer thread */
+    std::atomic<bool> m_rotate;
     std::string m_location;
     std::string m_filename;
     std::string m_name;
 };
 
+/*
+ * Fixed size byte ring between one producer and one consumer thread. The
+ * producer and the consumer never wait for each other; the producer fails
+ * to push when the ring is full.
+ */
+class RecRing {
+public:
+    RecRing(size_t size);
+
+    size_t size() const { return m_buf.size(); }
+    size_t used() const { return static_cast<size_t>(m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire)); }
+
+    /* Producer side */
+    bool push(const char *data, size_t len);
+
+    /* Consumer side, append everything pushed so far to out */
+    size_t pop(std::string &out);
+
+private:
+    std::vector<char> m_buf;
+    std::atomic<uint64_t> m_head;
+    std::atomic<uint64_t> m_tail;
+};
+
+/*
+ * Binary recording format. The file starts with MAGIC, followed by records
+ * in host byte order:
+ *
+ *   uint32 length of the rest of the record
+ *   uint64 timestamp, microseconds since the epoch
+ *   uint8  type
+ *   ENTRY:   key, op, uint32 field count, then field and value of each
+ *   START:   nothing
+ *   DROPPED: uint64 count of the records dropped before this one
+ *
+ * where strings are a uint32 length followed by the bytes.
+ */
+class BinaryRecord {
+public:
+    static const std::string MAGIC;
+    static const std::string SUFFIX;
+
+    enum Type : uint8_t {
+        ENTRY = 0,
+        START = 1,
+        DROPPED = 2,
+    };
+
+    uint64_t timestamp = 0;
+    Type type = ENTRY;
+    std::string key;
+    std::string op;
+    std::vector<FieldValueTuple> fieldValues;
+    uint64_t dropped = 0;
+
+    void encode(std::string &out) const;
+    /* Read the next record, false at the end of the file or on a truncated record */
+    bool decode(std::istream &in);
+    /* Line of the text recording */
+    std::string toText() const;
+};
+
 class RecWriter : public RecBase {
 public:
     RecWriter() = default;
     virtual ~RecWriter();
     void startRec(bool exit_if_failure);
     void record(const std::string& val);
+    /* Record key|op|field:value|..., without formatting it in binary mode */
+    void record(const std::string& key, const std::string& op, const std::vector<FieldValueTuple>& fvs);
+
+    /*
+     * Write the recording as <file>.bin in the BinaryRecord format, from a
+     * background thread the records are handed to through a RecRing. The
+     * recording thread never blocks on the file; records that do not fit in
+     * the ring are dropped and counted in the recording.
+     */
+    void setBinary(bool binary, size_t ring_size = DEFAULT_RING_SIZE) { m_binary = binary; m_ringSize = ring_size; }
+    bool isBinary() { return m_binary; }
+
+    static const size_t DEFAULT_RING_SIZE = 16 * 1024 * 1024;
 
 protected:
     void logfileReopen();
 
 private:
+    void pushBinary(const BinaryRecord& rec);
+    void binaryWriterThread();
+    bool openBinaryFile();
+
     std::ofstream record_ofs;
     std::string fname;
+    // Tasks are recorded from the main thread and the ring threads
+    std::mutex m_lock;
+
+    bool m_binary = false;
+    size_t m_ringSize = DEFAULT_RING_SIZE;
+    std::unique_ptr<RecRing> m_ring;
+    uint64_t m_dropped = 0;
+    std::string m_encoded;
+    std::thread m_writer;
+    std::atomic<bool> m_stop{false};
+    std::mutex m_writerLock;
+    std::condition_variable m_writerCv;
 };
 
 class SwSSRec : public RecWriter {
@@ -59,6 +160,12 @@ public:
     ResPubRec();
 };
 
+/* Record Handler for route latency traces, see RouteTracer */
+class RouteTraceRec : public RecWriter {
+public:
+    RouteTraceRec();
+};
+
 class SaiRedisRec : public RecBase {
 public:
     SaiRedisRec();
@@ -73,12 +180,14 @@ public:
     static const std::string SWSS_FNAME;
     static const std::string SAIREDIS_FNAME;
     static const std::string RESPPUB_FNAME;
+    static const std::string ROUTETRACE_FNAME;
 
     Recorder() = default;
     /* Individual Handlers */
     SwSSRec swss;
     SaiRedisRec sairedis;
     ResPubRec respub;
+    RouteTraceRec routetrace;
 };
 
 }
@@ -0,0 +1,299 @@
+#include "routetrace.h"
+#include "recorder.h"
+#include "logger.h"
+#include "table.h"
+#include <algorithm>
+#include <inttypes.h>
+#include <math.h>
+
+using namespace std;
+using namespace swss;
+
+constexpr size_t RouteTracer::MAX_OPEN_TRACES;
+constexpr size_t RouteTracer::HISTOGRAM_BUCKETS;
+constexpr size_t RouteTracer::EXPORT_INTERVAL;
+const string RouteTracer::TABLE_NAME = "ROUTE_TRACE_TABLE";
+
+static const char *stageNames[RouteTracer::STAGE_MAX] = {
+    "FPM_RECV",
+    "ROUTESYNC_ENCODE",
+    "APPL_DB_WRITE",
+    "ORCH_DOTASK",
+    "BULK_FLUSH",
+    "RESPONSE",
+    "OFFLOAD_REPLY",
+};
+
+static uint64_t toUs(RouteTracer::Clock::duration d)
+{
+    auto us = chrono::duration_cast<chrono::microseconds>(d).count();
+    return us > 0 ? static_cast<uint64_t>(us) : 0;
+}
+
+RouteTracer& RouteTracer::Instance()
+{
+    static RouteTracer m_tracer;
+    return m_tracer;
+}
+
+const char *RouteTracer::stageName(Stage stage)
+{
+    return stage < STAGE_MAX ? stageNames[stage] : "UNKNOWN";
+}
+
+void RouteTracer::enable(const string& process, uint32_t sampleRate)
+{
+    lock_guard<mutex> lock(m_lock);
+
+    m_process = process;
+    m_sampleRate = sampleRate;
+    m_traces.clear();
+    m_dropped = 0;
+
+    if (sampleRate)
+    {
+        SWSS_LOG_NOTICE("Route tracing enabled for %s, sampling 1 of %u routes", process.c_str(), sampleRate);
+    }
+}
+
+bool RouteTracer::isSampled(const string& key) const
+{
+    if (!m_sampleRate)
+    {
+        return false;
+    }
+
+    /* FNV-1a, std::hash is not guaranteed to agree between processes */
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : key)
+    {
+        hash = (hash ^ c) * 16777619u;
+    }
+
+    return hash % m_sampleRate == 0;
+}
+
+void RouteTracer::setStateTable(Table *table)
+{
+    lock_guard<mutex> lock(m_lock);
+    m_stateTable = table;
+}
+
+void RouteTracer::stamp(const string& key, Stage stage)
+{
+    if (!isSampled(key))
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_lock);
+    stampLocked(key, stage, Clock::now());
+}
+
+void RouteTracer::stamp(const string& key, Stage stage, Clock::time_point when)
+{
+    if (!isSampled(key))
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_lock);
+    stampLocked(key, stage, when);
+}
+
+void RouteTracer::stampAll(Stage stage)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_lock);
+    auto now = Clock::now();
+    for (auto& trace : m_traces)
+    {
+        if (trace.second[stage] == Clock::time_point())
+        {
+            trace.second[stage] = now;
+        }
+    }
+}
+
+void RouteTracer::complete(const string& key, Stage stage)
+{
+    if (!isSampled(key))
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_lock);
+    auto it = m_traces.find(key);
+    if (it == m_traces.end())
+    {
+        return;
+    }
+
+    it->second[stage] = Clock::now();
+    closeLocked(it->first, it->second);
+    m_traces.erase(it);
+}
+
+void RouteTracer::completeAll(Stage stage)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_lock);
+    auto now = Clock::now();
+    for (auto& trace : m_traces)
+    {
+        trace.second[stage] = now;
+        closeLocked(trace.first, trace.second);
+    }
+    m_traces.clear();
+}
+
+void RouteTracer::stampLocked(const string& key, Stage stage, Clock::time_point when)
+{
+    auto it = m_traces.find(key);
+    if (it == m_traces.end())
+    {
+        /* Traces of routes that never complete must not pile up */
+        if (m_traces.size() >= MAX_OPEN_TRACES)
+        {
+            /* Log the first drop and then every MAX_OPEN_TRACES of them */
+            if (m_dropped++ % MAX_OPEN_TRACES == 0)
+            {
+                SWSS_LOG_WARN("%s: %zu route traces open, dropped %" PRIu64 " traces so far",
+                              m_process.c_str(), m_traces.size(), m_dropped);
+            }
+            return;
+        }
+        it = m_traces.emplace(key, Stamps()).first;
+    }
+
+    if (it->second[stage] == Clock::time_point())
+    {
+        it->second[stage] = when;
+    }
+}
+
+void RouteTracer::closeLocked(const string& key, const Stamps& stamps)
+{
+    string rec = m_process + "|" + key;
+    const Clock::time_point *first = nullptr;
+    const Clock::time_point *prev = nullptr;
+
+    for (size_t i = 0; i < STAGE_MAX; i++)
+    {
+        if (stamps[i] == Clock::time_point())
+        {
+            continue;
+        }
+
+        if (prev)
+        {
+            m_histograms[i].add(toUs(stamps[i] - *prev));
+        }
+        else
+        {
+            first = &stamps[i];
+        }
+        prev = &stamps[i];
+
+        rec += "|";
+        rec += stageNames[i];
+        rec += ":";
+        rec += to_string(toUs(stamps[i].time_since_epoch()));
+    }
+
+    if (prev != first)
+    {
+        m_total.add(toUs(*prev - *first));
+    }
+
+    Recorder::Instance().routetrace.record(rec);
+
+    if (++m_completed % EXPORT_INTERVAL == 0)
+    {
+        exportLocked();
+    }
+}
+
+void RouteTracer::exportHistograms()
+{
+    lock_guard<mutex> lock(m_lock);
+    exportLocked();
+}
+
+void RouteTracer::exportLocked()
+{
+    if (!m_stateTable)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i <= STAGE_MAX; i++)
+    {
+        const auto& h = i < STAGE_MAX ? m_histograms[i] : m_total;
+        if (!h.count)
+        {
+            if (i == STAGE_MAX && m_dropped)
+            {
+                m_stateTable->hset(m_process + "|TOTAL", "dropped", to_string(m_dropped));
+            }
+            continue;
+        }
+
+        vector<FieldValueTuple> fvs = {
+            { "count", to_string(h.count) },
+            { "avg_us", to_string(h.sumUs / h.count) },
+            { "p50_us", to_string(h.percentile(0.5)) },
+            { "p99_us", to_string(h.percentile(0.99)) },
+            { "max_us", to_string(h.maxUs) },
+        };
+        if (i == STAGE_MAX)
+        {
+            fvs.emplace_back("dropped", to_string(m_dropped));
+        }
+        m_stateTable->set(m_process + "|" + (i < STAGE_MAX ? stageNames[i] : "TOTAL"), fvs);
+    }
+}
+
+void RouteTracer::Histogram::add(uint64_t us)
+{
+    size_t bucket = 0;
+    while (bucket < HISTOGRAM_BUCKETS - 1 && (us >> bucket))
+    {
+        bucket++;
+    }
+
+    buckets[bucket]++;
+    count++;
+    sumUs += us;
+    maxUs = max(maxUs, us);
+}
+
+uint64_t RouteTracer::Histogram::percentile(double pct) const
+{
+    if (!count)
+    {
+        return 0;
+    }
+
+    auto rank = static_cast<uint64_t>(ceil(pct * static_cast<double>(count)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+        {
+            /* Bucket i holds values below 2^i */
+            return min(i ? (uint64_t(1) << i) - 1 : 0, maxUs);
+        }
+    }
+
+    return maxUs;
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+namespace swss {
+
+class Table;
+
+/*
+ * Route programming latency tracing.
+ *
+ * A sampled subset of route keys is stamped at each stage a route goes
+ * through, from FPM receive in fpmsyncd to the offload reply published by
+ * orchagent. Sampling is a deterministic hash of the APPL_DB route key, so
+ * fpmsyncd and orchagent pick the same routes without exchanging anything.
+ * With suppress-fib-pending enabled fpmsyncd keeps its traces open until the
+ * offload reply for the route comes back on the response channel, which
+ * gives the end to end latency on a single clock.
+ *
+ * Each process keeps a log2 histogram per stage of the time spent since the
+ * previous stage, plus the total, and exports them to STATE_DB
+ * ROUTE_TRACE_TABLE|<process>|<stage>, the TOTAL entry also carries the
+ * number of traces dropped because too many were open. The raw wall clock stamps of every
+ * completed trace are written to the routetrace recording, which can be joined
+ * across processes by route key.
+ */
+class RouteTracer
+{
+public:
+    typedef std::chrono::system_clock Clock;
+
+    enum Stage
+    {
+        /* fpmsyncd */
+        FPM_RECV,
+        ROUTESYNC_ENCODE,
+        APPL_DB_WRITE,
+        /* orchagent */
+        ORCH_DOTASK,
+        BULK_FLUSH,
+        RESPONSE,
+        /* fpmsyncd, with suppress-fib-pending */
+        OFFLOAD_REPLY,
+        STAGE_MAX
+    };
+
+    static constexpr size_t MAX_OPEN_TRACES = 4096;
+    static constexpr size_t HISTOGRAM_BUCKETS = 32;
+    static constexpr size_t EXPORT_INTERVAL = 64;
+    static const std::string TABLE_NAME;
+
+    static RouteTracer& Instance();
+
+    static const char *stageName(Stage stage);
+
+    /* Trace one out of every sampleRate routes, 0 disables tracing */
+    void enable(const std::string& process, uint32_t sampleRate);
+
+    bool isEnabled() const
+    {
+        return m_sampleRate != 0;
+    }
+
+    bool isSampled(const std::string& key) const;
+
+    /*
+     * Table the histograms are exported to, not owned. Exports run from
+     * whichever thread completes a trace, so the table must sit on a DB
+     * connection nothing else uses.
+     */
+    void setStateTable(Table *table);
+
+    /* Stamp a stage of a sampled route, only the first stamp of a stage counts */
+    void stamp(const std::string& key, Stage stage);
+    void stamp(const std::string& key, Stage stage, Clock::time_point when);
+
+    /* Stamp a stage of all open traces that did not reach it yet */
+    void stampAll(Stage stage);
+
+    /* Stamp the last stage of a route in this process and close its trace */
+    void complete(const std::string& key, Stage stage);
+
+    /* Stamp the last stage of all open traces and close them */
+    void completeAll(Stage stage);
+
+    /* Remember when the data currently being decoded was received */
+    void setReceiveTime(Clock::time_point when)
+    {
+        m_receiveTime = when;
+    }
+
+    Clock::time_point getReceiveTime() const
+    {
+        return m_receiveTime;
+    }
+
+    void exportHistograms();
+
+    struct Histogram
+    {
+        uint64_t count = 0;
+        uint64_t sumUs = 0;
+        uint64_t maxUs = 0;
+        std::array<uint64_t, HISTOGRAM_BUCKETS> buckets{};
+
+        void add(uint64_t us);
+        /* Upper bound of the bucket the given percentile falls into */
+        uint64_t percentile(double pct) const;
+    };
+
+    const Histogram& getHistogram(Stage stage) const
+    {
+        return m_histograms[stage];
+    }
+
+    const Histogram& getTotalHistogram() const
+    {
+        return m_total;
+    }
+
+    size_t openTraces() const
+    {
+        return m_traces.size();
+    }
+
+    /* Traces not opened because MAX_OPEN_TRACES were already open */
+    uint64_t droppedTraces() const
+    {
+        return m_dropped;
+    }
+
+private:
+    typedef std::array<Clock::time_point, STAGE_MAX> Stamps;
+
+    void stampLocked(const std::string& key, Stage stage, Clock::time_point when);
+    void closeLocked(const std::string& key, const Stamps& stamps);
+    void exportLocked();
+
+    std::string m_process;
+    uint32_t m_sampleRate = 0;
+    Table *m_stateTable = nullptr;
+    Clock::time_point m_receiveTime;
+
+    /* Route tasks are processed from the main thread and the ring threads */
+    std::mutex m_lock;
+    std::unordered_map<std::string, Stamps> m_traces;
+    std::array<Histogram, STAGE_MAX> m_histograms;
+    Histogram m_total;
+    size_t m_completed = 0;
+    uint64_t m_dropped = 0;
+};
+
+}
@@ -32,6 +32,15 @@ NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConne
     {
         m_AppRestartAssist->registerAppTable(APP_NEIGH_TABLE_NAME, &m_neighTable);
     }
+
+    /* Neighbor updates are written once per netlink read, see flush() */
+    m_neighTable.setBuffered(true);
+
+    /* Load the existing config before the first netlink event */
+    for (auto table : getCfgTables())
+    {
+        processCfgTable(table);
+    }
 }
 
 NeighSync::~NeighSync()
@@ -56,6 +65,53 @@ bool NeighSync::isNeighRestoreDone()
     return false;
 }
 
+void NeighSync::processCfgTable(SubscriberStateTable *table)
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    table->pops(entries);
+
+    for (const auto &entry : entries)
+    {
+        const string &key = kfvKey(entry);
+        bool set = kfvOp(entry) == SET_COMMAND;
+
+        if (table == &m_cfgPeerSwitchTable)
+        {
+            if (set)
+            {
+                m_peerSwitches.insert(key);
+            }
+            else
+            {
+                m_peerSwitches.erase(key);
+            }
+            continue;
+        }
+
+        /* Only the interface entry has the link local mode, not its IP entries */
+        if (key.find(table->getTableNameSeparator()) != string::npos)
+        {
+            continue;
+        }
+
+        const auto &values = kfvFieldsValues(entry);
+        auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
+        if (set && it != values.end() && it->second == "enable")
+        {
+            m_linkLocalIntfs.insert(key);
+        }
+        else
+        {
+            m_linkLocalIntfs.erase(key);
+        }
+    }
+}
+
+void NeighSync::flush()
+{
+    m_neighTable.flush();
+}
+
 void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
 {
     char ipStr[MAX_ADDR_SIZE + 1] = {0};
@@ -64,9 +120,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = !m_peerSwitches.empty();
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
@@ -192,46 +246,18 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
 /* To check the ipv6 link local is enabled on a given port */
 bool NeighSync::isLinkLocalEnabled(const string &port)
 {
-    vector<FieldValueTuple> values;
-
-    if (!port.compare(0, strlen("Vlan"), "Vlan"))
-    {
-        if (!m_cfgVlanInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else if (!port.compare(0, strlen("PortChannel"), "PortChannel"))
-    {
-        if (!m_cfgLagInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else if (!port.compare(0, strlen("Ethernet"), "Ethernet"))
-    {
-        if (!m_cfgInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else
+    if (port.compare(0, strlen("Vlan"), "Vlan") &&
+        port.compare(0, strlen("PortChannel"), "PortChannel") &&
+        port.compare(0, strlen("Ethernet"), "Ethernet"))
     {
         SWSS_LOG_INFO("IPv6 Link local is not supported for %s ", port.c_str());
         return false;
     }
 
-    auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
-    if (it != values.end())
+    if (m_linkLocalIntfs.find(port) != m_linkLocalIntfs.end())
     {
-        if (it->second == "enable")
-        {
-            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
-            return true;
-        }
+        SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
+        return true;
     }
 
     SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
@@ -1,8 +1,13 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <set>
+#include <string>
+#include <vector>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscriberstatetable.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
@@ -30,16 +35,35 @@ public:
 
     bool isNeighRestoreDone();
 
+    /* CONFIG_DB tables neighsyncd keeps an in memory view of */
+    std::vector<SubscriberStateTable *> getCfgTables()
+    {
+        return { &m_cfgPeerSwitchTable, &m_cfgInterfaceTable, &m_cfgLagInterfaceTable, &m_cfgVlanInterfaceTable };
+    }
+
+    void processCfgTable(SubscriberStateTable *table);
+
+    /* Write the neighbor updates buffered since the last flush to APPL_DB */
+    void flush();
+
     AppRestartAssist *getRestartAssist()
     {
         return m_AppRestartAssist;
     }
 
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable;
+    Table m_stateNeighRestoreTable;
     ProducerStateTable m_neighTable;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+    SubscriberStateTable m_cfgPeerSwitchTable;
+    SubscriberStateTable m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+
+    /*
+     * Kept up to date from the config table notifications, so that netlink
+     * events are handled without any CONFIG_DB read
+     */
+    std::set<std::string> m_peerSwitches;
+    std::set<std::string> m_linkLocalIntfs;
 
     bool isLinkLocalEnabled(const std::string &port);
 };
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <chrono>
+#include <algorithm>
 #include "logger.h"
 #include "select.h"
 #include "netdispatcher.h"
@@ -67,10 +68,24 @@ int main(int argc, char **argv)
             netlink.dumpRequest(RTM_GETNEIGH);
 
             s.addSelectable(&netlink);
+
+            auto cfgTables = sync.getCfgTables();
+            for (auto table : cfgTables)
+            {
+                s.addSelectable(table);
+            }
+
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                auto cfgTable = find(cfgTables.begin(), cfgTables.end(), temps);
+                if (cfgTable != cfgTables.end())
+                {
+                    sync.processCfgTable(*cfgTable);
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -83,6 +98,9 @@ int main(int argc, char **argv)
                         sync.getRestartAssist()->reconcile();
                     }
                 }
+
+                /* Write the neighbor updates of this netlink read in one go */
+                sync.flush();
             }
         }
         catch (const std::exception& e)
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <assert.h>
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -10,6 +14,7 @@
 #include "sai.h"
 #include "logger.h"
 #include "sai_serialize.h"
+#include "bulksizer.h"
 
 typedef sai_status_t (*sai_bulk_set_outbound_ca_to_pa_entry_attribute_fn) (
         _In_ uint32_t object_count,
@@ -424,6 +429,18 @@ struct SaiBulkerTraits<sai_dash_meter_api_t>
     using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_dash_acl_api_t;
+    using create_entry_fn = sai_create_dash_acl_rule_fn;
+    using remove_entry_fn = sai_remove_dash_acl_rule_fn;
+    using set_entry_attribute_fn = sai_set_dash_acl_rule_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_vnet_api_t>
 {
@@ -632,6 +649,9 @@ public:
 
     void flush()
     {
+        // Keep the order with a flush still in flight
+        wait();
+
         // Removing
         if (!removing_entries.empty())
         {
@@ -649,7 +669,7 @@ public:
                 {
                     rs.push_back(entry);
 
-                    if (rs.size() >= max_bulk_size)
+                    if (rs.size() >= bulk_size())
                     {
                         flush_removing_entries(rs);
                     }
@@ -683,7 +703,7 @@ public:
                     tss.push_back(attrs.data());
                     cs.push_back((uint32_t)attrs.size());
 
-                    if (rs.size() >= max_bulk_size)
+                    if (rs.size() >= bulk_size())
                     {
                         flush_creating_entries(rs, tss, cs);
                     }
@@ -729,7 +749,7 @@ public:
                         ts.push_back(attr);
                         status_vector.push_back(object_status);
 
-                        if (rs.size() >= max_bulk_size)
+                        if (rs.size() >= bulk_size())
                         {
                             flush_setting_entries(rs, ts, status_vector);
                         }
@@ -743,6 +763,48 @@ public:
         }
     }
 
+    /*
+     * Flush the pending entries on a separate thread and return right away, so the
+     * caller can go on while the bulk is in flight. New entries go to an empty batch
+     * in the meantime. At most one flush is in flight, starting another one or calling
+     * flush() waits for it first.
+     *
+     * The object statuses are written by the flushing thread: they must not be read
+     * before wait() returns, and the attribute values must stay valid until then.
+     * on_done, if given, is called on the flushing thread once the bulk completed.
+     * The SAI calls of both threads are serialized by sairedis.
+     */
+    void flush_async(std::function<void()> on_done = nullptr)
+    {
+        wait();
+
+        auto batch = std::make_shared<EntityBulker>(std::move(*this));
+        clear();
+        sizer = batch->sizer;
+
+        inflight = std::async(std::launch::async, [batch, on_done]() {
+            batch->flush();
+            if (on_done)
+            {
+                on_done();
+            }
+        });
+    }
+
+    // Wait for the flush in flight, if any, to complete
+    void wait()
+    {
+        if (inflight.valid())
+        {
+            inflight.get();
+        }
+    }
+
+    bool flush_in_flight() const
+    {
+        return inflight.valid();
+    }
+
     void clear()
     {
         removing_entries.clear();
@@ -806,8 +868,46 @@ private:
     std::vector<Te>                                         set_order;
     std::vector<Te>                                         remove_order;
 
+    std::future<void>                                       inflight;
+
     size_t max_bulk_size;
 
+    std::shared_ptr<BulkSizer>                              sizer;
+
+    size_t bulk_size() const
+    {
+        return sizer ? std::min(sizer->size(), max_bulk_size) : max_bulk_size;
+    }
+
+    void record_bulk(sai_status_t status, const std::vector<sai_status_t> &statuses, BulkSizer::Clock::time_point start)
+    {
+        if (!sizer)
+        {
+            return;
+        }
+
+        size_t succeeded = 0;
+        size_t failed = 0;
+        for (auto object_status : statuses)
+        {
+            if (object_status == SAI_STATUS_SUCCESS)
+            {
+                succeeded++;
+            }
+            else if (object_status != SAI_STATUS_NOT_EXECUTED)
+            {
+                failed++;
+            }
+        }
+        if (status != SAI_STATUS_SUCCESS && succeeded == 0)
+        {
+            // The bulk was rejected as a whole
+            failed = statuses.size();
+        }
+
+        sizer->record(statuses.size(), failed, BulkSizer::Clock::now() - start);
+    }
+
     typename Ts::bulk_create_entry_fn                       create_entries;
     typename Ts::bulk_remove_entry_fn                       remove_entries;
     typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
@@ -821,7 +921,9 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
+        auto start = BulkSizer::Clock::now();
         sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        record_bulk(status, statuses, start);
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("EntityBulker.flush removing_entries %zu\n", count);
@@ -858,8 +960,10 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
+        auto start = BulkSizer::Clock::now();
         sai_status_t status = (*create_entries)((uint32_t)count, rs.data(), cs.data(), tss.data()
             , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        record_bulk(status, statuses, start);
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("EntityBulker.flush creating_entries %zu\n", count);
@@ -898,8 +1002,10 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
+        auto start = BulkSizer::Clock::now();
         sai_status_t status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
             , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        record_bulk(status, statuses, start);
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("EntityBulker.flush setting_entries, count %zu\n", count);
@@ -932,6 +1038,7 @@ template <>
 inline EntityBulker<sai_route_api_t>::EntityBulker(sai_route_api_t *api, size_t max_bulk_size) :
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get(SAI_OBJECT_TYPE_ROUTE_ENTRY, max_bulk_size);
     create_entries = api->create_route_entries;
     remove_entries = api->remove_route_entries;
     set_entries_attribute = api->set_route_entries_attribute;
@@ -954,6 +1061,7 @@ template <>
 inline EntityBulker<sai_mpls_api_t>::EntityBulker(sai_mpls_api_t *api, size_t max_bulk_size) :
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get(SAI_OBJECT_TYPE_INSEG_ENTRY, max_bulk_size);
     create_entries = api->create_inseg_entries;
     remove_entries = api->remove_inseg_entries;
     set_entries_attribute = api->set_inseg_entries_attribute;
@@ -963,6 +1071,7 @@ template <>
 inline EntityBulker<sai_neighbor_api_t>::EntityBulker(sai_neighbor_api_t *api, size_t max_bulk_size) :
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, max_bulk_size);
     create_entries = api->create_neighbor_entries;
     remove_entries = api->remove_neighbor_entries;
     set_entries_attribute = api->set_neighbor_entries_attribute;
@@ -971,6 +1080,7 @@ inline EntityBulker<sai_neighbor_api_t>::EntityBulker(sai_neighbor_api_t *api, s
 template <>
 inline EntityBulker<sai_dash_inbound_routing_api_t>::EntityBulker(sai_dash_inbound_routing_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY, max_bulk_size);
     create_entries = api->create_inbound_routing_entries;
     remove_entries = api->remove_inbound_routing_entries;
     set_entries_attribute = nullptr;
@@ -979,6 +1089,7 @@ inline EntityBulker<sai_dash_inbound_routing_api_t>::EntityBulker(sai_dash_inbou
 template <>
 inline EntityBulker<sai_dash_outbound_ca_to_pa_api_t>::EntityBulker(sai_dash_outbound_ca_to_pa_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY, max_bulk_size);
     create_entries = api->create_outbound_ca_to_pa_entries;
     remove_entries = api->remove_outbound_ca_to_pa_entries;
     set_entries_attribute = nullptr;
@@ -987,6 +1098,7 @@ inline EntityBulker<sai_dash_outbound_ca_to_pa_api_t>::EntityBulker(sai_dash_out
 template <>
 inline EntityBulker<sai_dash_pa_validation_api_t>::EntityBulker(sai_dash_pa_validation_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY, max_bulk_size);
     create_entries = api->create_pa_validation_entries;
     remove_entries = api->remove_pa_validation_entries;
     set_entries_attribute = nullptr;
@@ -995,6 +1107,7 @@ inline EntityBulker<sai_dash_pa_validation_api_t>::EntityBulker(sai_dash_pa_vali
 template <>
 inline EntityBulker<sai_dash_outbound_routing_api_t>::EntityBulker(sai_dash_outbound_routing_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY, max_bulk_size);
     create_entries = api->create_outbound_routing_entries;
     remove_entries = api->remove_outbound_routing_entries;
     set_entries_attribute = nullptr;
@@ -1003,6 +1116,7 @@ inline EntityBulker<sai_dash_outbound_routing_api_t>::EntityBulker(sai_dash_outb
 template <>
 inline EntityBulker<sai_dash_outbound_port_map_api_t>::EntityBulker(sai_dash_outbound_port_map_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY, max_bulk_size);
     create_entries = api->create_outbound_port_map_port_range_entries;
     remove_entries = api->remove_outbound_port_map_port_range_entries;
     set_entries_attribute = nullptr;
@@ -1045,6 +1159,21 @@ public:
         return SAI_STATUS_NOT_EXECUTED;
     }
 
+    // Same as above, with the status of the entry reported in object_status on flush
+    sai_status_t create_entry(
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_status,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+
+        *object_status = create_entry(object_id, attr_count, attr_list);
+        creating_statuses[object_id] = object_status;
+        return *object_status;
+    }
+
     sai_status_t remove_entry(
         _Out_ sai_status_t *object_status,
         _In_ sai_object_id_t object_id)
@@ -1091,6 +1220,9 @@ public:
 
     void flush()
     {
+        // Keep the order with a flush still in flight
+        wait();
+
         // Removing
         if (!removing_entries.empty())
         {
@@ -1103,7 +1235,7 @@ public:
                 {
                     rs.push_back(entry);
 
-                    if (rs.size() >= max_bulk_size)
+                    if (rs.size() >= bulk_size())
                     {
                         flush_removing_entries(rs);
                     }
@@ -1132,7 +1264,7 @@ public:
                     tss.push_back(attrs.data());
                     cs.push_back((uint32_t)attrs.size());
 
-                    if (rs.size() >= max_bulk_size)
+                    if (rs.size() >= bulk_size())
                     {
                         flush_creating_entries(rs, tss, cs);
                     }
@@ -1141,6 +1273,7 @@ public:
             flush_creating_entries(rs, tss, cs);
 
             creating_entries.clear();
+            creating_statuses.clear();
         }
 
         // Setting
@@ -1160,7 +1293,7 @@ public:
                     rs.push_back(entry);
                     ts.push_back(attr);
 
-                    if (rs.size() >= max_bulk_size)
+                    if (rs.size() >= bulk_size())
                     {
                         flush_setting_entries(rs, ts);
                     }
@@ -1173,10 +1306,56 @@ public:
         */
     }
 
+    /*
+     * Same as EntityBulker::flush_async(), the object ids and statuses are written
+     * by the flushing thread and must not be read before wait() returns.
+     */
+    void flush_async(std::function<void()> on_done = nullptr)
+    {
+        wait();
+
+        auto batch = std::make_shared<ObjectBulker>(std::move(*this));
+        clear();
+        sizer = batch->sizer;
+
+        inflight_batch = batch;
+        inflight = std::async(std::launch::async, [batch, on_done]() {
+            batch->flush();
+            if (on_done)
+            {
+                on_done();
+            }
+        });
+    }
+
+    // Wait for the flush in flight, if any, to complete
+    void wait()
+    {
+        if (!inflight.valid())
+        {
+            return;
+        }
+
+        inflight.get();
+
+        // create_status() reports the last flush that created objects
+        if (!inflight_batch->create_statuses.empty())
+        {
+            create_statuses = std::move(inflight_batch->create_statuses);
+        }
+        inflight_batch.reset();
+    }
+
+    bool flush_in_flight() const
+    {
+        return inflight.valid();
+    }
+
     void clear()
     {
         removing_entries.clear();
         creating_entries.clear();
+        creating_statuses.clear();
         setting_entries.clear();
     }
 
@@ -1216,11 +1395,51 @@ private:
 
     size_t max_bulk_size;
 
+    std::shared_ptr<BulkSizer>                              sizer;
+
+    size_t bulk_size() const
+    {
+        return sizer ? std::min(sizer->size(), max_bulk_size) : max_bulk_size;
+    }
+
+    void record_bulk(sai_status_t status, const std::vector<sai_status_t> &statuses, BulkSizer::Clock::time_point start)
+    {
+        if (!sizer)
+        {
+            return;
+        }
+
+        size_t succeeded = 0;
+        size_t failed = 0;
+        for (auto object_status : statuses)
+        {
+            if (object_status == SAI_STATUS_SUCCESS)
+            {
+                succeeded++;
+            }
+            else if (object_status != SAI_STATUS_NOT_EXECUTED)
+            {
+                failed++;
+            }
+        }
+        if (status != SAI_STATUS_SUCCESS && succeeded == 0)
+        {
+            // The bulk was rejected as a whole
+            failed = statuses.size();
+        }
+
+        sizer->record(statuses.size(), failed, BulkSizer::Clock::now() - start);
+    }
+
     std::vector<std::pair<                                  // A vector of pair of
             sai_object_id_t *,                              // - object_id
             std::vector<sai_attribute_t>                    // - attrs
     >>                                                      creating_entries;
 
+                                                            // A map of
+                                                            // OUT object_id -> OUT object_status
+    std::unordered_map<sai_object_id_t *, sai_status_t *>   creating_statuses;
+
     std::unordered_map<                                     // A map of
             sai_object_id_t,                                // object_id -> (OUT object_status, attributes)
             std::pair<
@@ -1240,6 +1459,9 @@ private:
 
     std::unordered_map<sai_object_id_t, sai_status_t>       create_statuses;
 
+    std::future<void>                                       inflight;
+    std::shared_ptr<ObjectBulker>                           inflight_batch;
+
     sai_status_t flush_removing_entries(
         _Inout_ std::vector<sai_object_id_t> &rs)
     {
@@ -1249,7 +1471,9 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
+        auto start = BulkSizer::Clock::now();
         sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        record_bulk(status, statuses, start);
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush removing_entries %zu rc=%d statuses[0]=%d\n", removing_entries.size(), status, statuses[0]);
@@ -1284,8 +1508,10 @@ private:
         size_t count = rs.size();
         std::vector<sai_object_id_t> object_ids(count);
         std::vector<sai_status_t> statuses(count);
+        auto start = BulkSizer::Clock::now();
         sai_status_t status = (*create_entries)(switch_id, (uint32_t)count, cs.data(), tss.data()
             , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+        record_bulk(status, statuses, start);
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush creating_entries %zu\n", count);
@@ -1301,6 +1527,12 @@ private:
             create_statuses.emplace(object_ids[i], statuses[i]);
             sai_object_id_t *pid = rs[i];
             *pid = (statuses[i] == SAI_STATUS_SUCCESS) ? object_ids[i] : SAI_NULL_OBJECT_ID;
+
+            auto found_status = creating_statuses.find(pid);
+            if (found_status != creating_statuses.end())
+            {
+                *found_status->second = statuses[i];
+            }
         }
 
         rs.clear();
@@ -1347,6 +1579,7 @@ inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, max_bulk_size);
     create_entries = api->create_next_hop_group_members;
     remove_entries = api->remove_next_hop_group_members;
     // TODO: wait until available in SAI
@@ -1358,6 +1591,7 @@ inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_h
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get(SAI_OBJECT_TYPE_NEXT_HOP, max_bulk_size);
     create_entries = api->create_next_hops;
     remove_entries = api->remove_next_hops;
     // TODO: wait until available in SAI
@@ -1369,15 +1603,27 @@ inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_VNET, max_bulk_size);
     create_entries = api->create_vnets;
     remove_entries = api->remove_vnets;
 }
 
+template <>
+inline ObjectBulker<sai_dash_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_DASH_ACL_RULE, max_bulk_size);
+    create_entries = api->create_dash_acl_rules;
+    remove_entries = api->remove_dash_acl_rules;
+}
+
 template <>
 inline ObjectBulker<sai_dash_meter_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_meter_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_METER_RULE, max_bulk_size);
     create_entries = api->create_meter_rules;
     remove_entries = api->remove_meter_rules;
 }
@@ -1407,6 +1653,8 @@ inline ObjectBulker<sai_dash_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_das
             ss << "Invalid object type for sai_dash_tunnel_api_t: " << type_str;
             throw std::invalid_argument(ss.str());
     }
+
+    sizer = BulkSizer::get((sai_object_type_t)object_type, max_bulk_size);
 }
 
 template <>
@@ -1414,6 +1662,7 @@ inline ObjectBulker<sai_dash_outbound_port_map_api_t>::ObjectBulker(SaiBulkerTra
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    sizer = BulkSizer::get((sai_object_type_t)SAI_OBJECT_TYPE_OUTBOUND_PORT_MAP, max_bulk_size);
     create_entries = api->create_outbound_port_maps;
     remove_entries = api->remove_outbound_port_maps;
 }
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include "sai.h"
+
+/*
+ * BulkSizer sizes the SAI bulk calls of one object type.
+ *
+ * The bulkers of an object type share a BulkSizer, which records the latency
+ * and the per entry failure rate of every bulk call. With adaptive sizing on,
+ * a call that fails for most of its entries halves the bulk size (vendors
+ * reject bulks above their own limit as a whole), a call slower than the
+ * latency target scales it down to the target, and a full call well within
+ * the target grows it by a quarter. Growth slows down approaching the smallest
+ * size that failed, until enough calls succeeded to try above it again. The
+ * size stays between the min and max guards, the max being the bulk size
+ * given on the command line.
+ * With adaptive sizing off the size is the max and only the counters move.
+ */
+class BulkSizer
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static constexpr size_t DEFAULT_MIN_BULK_SIZE = 16;
+    static constexpr uint64_t DEFAULT_LATENCY_TARGET_US = 200000;
+    /* Successful calls after which a failed size is tried again */
+    static constexpr uint64_t CEILING_EXPIRY_CALLS = 256;
+
+    struct Stats
+    {
+        size_t bulkSize = 0;
+        size_t minBulkSize = 0;
+        size_t maxBulkSize = 0;
+        uint64_t calls = 0;
+        uint64_t entries = 0;
+        uint64_t failedEntries = 0;
+        uint64_t latencySumUs = 0;
+        uint64_t maxLatencyUs = 0;
+        uint64_t shrinks = 0;
+        uint64_t grows = 0;
+    };
+
+    BulkSizer(size_t maxBulkSize) :
+        m_maxBulkSize(std::max(maxBulkSize, size_t(1))),
+        m_minBulkSize(std::min(size_t(DEFAULT_MIN_BULK_SIZE), m_maxBulkSize)),
+        m_bulkSize(m_maxBulkSize)
+    {
+    }
+
+    /* Shared sizer of an object type, created on first use */
+    static std::shared_ptr<BulkSizer> get(sai_object_type_t objectType, size_t maxBulkSize)
+    {
+        std::lock_guard<std::mutex> lock(registryLock());
+
+        auto &sizer = registry()[objectType];
+        if (!sizer)
+        {
+            sizer = std::make_shared<BulkSizer>(maxBulkSize);
+        }
+        else if (maxBulkSize > sizer->getMaxBulkSize())
+        {
+            sizer->setLimits(sizer->getMinBulkSize(), maxBulkSize);
+        }
+
+        return sizer;
+    }
+
+    /* Visit the sizers that recorded a call since the last visit */
+    static void forEachUpdated(const std::function<void(sai_object_type_t, const Stats&)> &visit)
+    {
+        std::lock_guard<std::mutex> lock(registryLock());
+
+        for (auto &it : registry())
+        {
+            if (it.second->m_updated.exchange(false))
+            {
+                visit(it.first, it.second->getStats());
+            }
+        }
+    }
+
+    static void setAdaptive(bool adaptive)
+    {
+        adaptiveFlag() = adaptive;
+    }
+
+    static bool isAdaptive()
+    {
+        return adaptiveFlag();
+    }
+
+    static void setLatencyTarget(uint64_t latencyTargetUs)
+    {
+        latencyTarget() = std::max(latencyTargetUs, uint64_t(1));
+    }
+
+    static uint64_t getLatencyTarget()
+    {
+        return latencyTarget();
+    }
+
+    void setLimits(size_t minBulkSize, size_t maxBulkSize)
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        m_maxBulkSize = std::max(maxBulkSize, size_t(1));
+        m_minBulkSize = std::min(std::max(minBulkSize, size_t(1)), m_maxBulkSize);
+        m_bulkSize = std::min(std::max(m_bulkSize.load(), m_minBulkSize), m_maxBulkSize);
+    }
+
+    size_t getMinBulkSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_minBulkSize;
+    }
+
+    size_t getMaxBulkSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_maxBulkSize;
+    }
+
+    /* Number of entries the next bulk call may carry */
+    size_t size() const
+    {
+        return isAdaptive() ? m_bulkSize.load() : getMaxBulkSize();
+    }
+
+    /* Record a bulk call of count entries, failed of which did not succeed */
+    void record(size_t count, size_t failed, Clock::duration latency)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto latencyUs = static_cast<uint64_t>(std::max(
+                std::chrono::duration_cast<std::chrono::microseconds>(latency).count(), decltype(latency.count())(0)));
+
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        m_stats.calls++;
+        m_stats.entries += count;
+        m_stats.failedEntries += failed;
+        m_stats.latencySumUs += latencyUs;
+        m_stats.maxLatencyUs = std::max(m_stats.maxLatencyUs, latencyUs);
+        m_updated = true;
+
+        if (!isAdaptive())
+        {
+            return;
+        }
+
+        size_t current = m_bulkSize;
+        size_t next = current;
+        uint64_t target = getLatencyTarget();
+
+        if (failed * 2 > count && count > 1)
+        {
+            next = count / 2;
+            m_ceiling = std::min(m_ceiling, count - 1);
+            m_goodCalls = 0;
+        }
+        else
+        {
+            if (failed == 0 && ++m_goodCalls >= CEILING_EXPIRY_CALLS)
+            {
+                m_ceiling = SIZE_MAX;
+                m_goodCalls = 0;
+            }
+
+            if (latencyUs > target)
+            {
+                next = static_cast<size_t>(static_cast<double>(count) * static_cast<double>(target) / static_cast<double>(latencyUs));
+            }
+            else if (count >= current && latencyUs * 2 < target && current < m_ceiling)
+            {
+                next = current + std::max(std::min(current / 4, (m_ceiling - current) / 2), size_t(1));
+            }
+        }
+
+        next = std::min(std::max(next, m_minBulkSize), m_maxBulkSize);
+        if (next < current)
+        {
+            m_stats.shrinks++;
+        }
+        else if (next > current)
+        {
+            m_stats.grows++;
+        }
+        m_bulkSize = next;
+    }
+
+    Stats getStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        Stats stats = m_stats;
+        stats.bulkSize = isAdaptive() ? m_bulkSize.load() : m_maxBulkSize;
+        stats.minBulkSize = m_minBulkSize;
+        stats.maxBulkSize = m_maxBulkSize;
+        return stats;
+    }
+
+private:
+    static std::map<sai_object_type_t, std::shared_ptr<BulkSizer>>& registry()
+    {
+        static std::map<sai_object_type_t, std::shared_ptr<BulkSizer>> sizers;
+        return sizers;
+    }
+
+    static std::mutex& registryLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
+    static std::atomic<bool>& adaptiveFlag()
+    {
+        static std::atomic<bool> adaptive(false);
+        return adaptive;
+    }
+
+    static std::atomic<uint64_t>& latencyTarget()
+    {
+        static std::atomic<uint64_t> target(DEFAULT_LATENCY_TARGET_US);
+        return target;
+    }
+
+    /* Bulks may be flushed on another thread, see flush_async() */
+    mutable std::mutex m_lock;
+    size_t m_maxBulkSize;
+    size_t m_minBulkSize;
+    std::atomic<size_t> m_bulkSize;
+    std::atomic<bool> m_updated{false};
+    size_t m_ceiling = SIZE_MAX;
+    uint64_t m_goodCalls = 0;
+    Stats m_stats;
+};
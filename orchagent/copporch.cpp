@@ -8,6 +8,7 @@ extern "C" {
 #include "copporch.h"
 #include "portsorch.h"
 #include "flexcounterorch.h"
+#include "counterratesorch.h"
 #include "tokenize.h"
 #include "logger.h"
 #include "sai_serialize.h"
@@ -33,6 +34,7 @@ extern PortsOrch*           gPortsOrch;
 extern Directory<Orch*>     gDirectory;
 extern bool                 gIsNatSupported;
 extern bool                 gTraditionalFlexCounter;
+extern bool                 gNativeCounterRates;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -1378,8 +1380,16 @@ void CoppOrch::initTrapRatePlugin()
     std::string trapSha;
     try
     {
-        std::string trapLuaScript = swss::loadLuaScript(trapRatePluginName);
-        trapSha = swss::loadRedisScript(m_counter_db.get(), trapLuaScript);
+        /* Trap rates are computed by CounterRatesOrch then, once told the counters are polled */
+        if (gNativeCounterRates)
+        {
+            trapSha = CounterRatesOrch::loadPollPlugin(m_counter_db.get(), "TRAP");
+        }
+        else
+        {
+            std::string trapLuaScript = swss::loadLuaScript(trapRatePluginName);
+            trapSha = swss::loadRedisScript(m_counter_db.get(), trapLuaScript);
+        }
     }
     catch (const runtime_error &e)
     {
@@ -0,0 +1,29 @@
+-- KEYS - counter object IDs
+-- ARGV[1] - counters db index
+-- ARGV[2] - counters table name
+-- ARGV[3] - poll time interval
+-- return log
+--
+-- object_type is defined ahead of this script by CounterRatesOrch::loadPollPlugin().
+-- Tells CounterRatesOrch that the counters of the object type were polled,
+-- along with the poll interval and the rates configuration of the type.
+
+local logtable = {}
+
+local counters_db = ARGV[1]
+local rates_table_name = "RATES"
+
+redis.call('SELECT', counters_db)
+
+local msg = '["' .. object_type .. '","' .. ARGV[3] .. '"'
+for _, field in ipairs({object_type .. '_ALPHA', object_type .. '_SMOOTH_INTERVAL'}) do
+    local value = redis.call('HGET', rates_table_name .. ':' .. object_type, field)
+    if value then
+        msg = msg .. ',"' .. field .. '","' .. value .. '"'
+    end
+end
+msg = msg .. ']'
+
+redis.call('PUBLISH', 'COUNTER_RATES_POLL', msg)
+
+return logtable
@@ -0,0 +1,291 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+
+#include "counterrates.h"
+#include "schema.h"
+
+using namespace std;
+using namespace swss;
+
+/* Average BER of an uncorrectable RS frame, see port_rates.lua */
+#define RS_AVERAGE_FRAME_BER 1e-8
+#define FEC_HISTOGRAM_BINS 16
+
+static const string FEC_CORRECTED_BITS = "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS";
+static const string FEC_NOT_CORRECTABLE_FRAMES = "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES";
+static const string FEC_CODEWORD_ERRORS_PREFIX = "SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S";
+/* The names port_rates.lua keeps the last FEC counters under, typo included */
+static const string FEC_CORRECTED_BITS_LAST = "SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last";
+static const string FEC_NOT_CORRECTABLE_FRAMES_LAST = "SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last";
+
+static const vector<CounterRateSpec> counterRateSpecs = {
+    {
+        "PORT", COUNTERS_PORT_NAME_MAP,
+        {
+            { "RX_BPS", { "SAI_PORT_STAT_IF_IN_OCTETS" } },
+            { "RX_PPS", { "SAI_PORT_STAT_IF_IN_UCAST_PKTS", "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS" } },
+            { "TX_BPS", { "SAI_PORT_STAT_IF_OUT_OCTETS" } },
+            { "TX_PPS", { "SAI_PORT_STAT_IF_OUT_UCAST_PKTS", "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS" } },
+        },
+        false, true
+    },
+    {
+        "RIF", COUNTERS_RIF_NAME_MAP,
+        {
+            { "RX_BPS", { "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS" } },
+            { "RX_PPS", { "SAI_ROUTER_INTERFACE_STAT_IN_PACKETS" } },
+            { "TX_BPS", { "SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS" } },
+            { "TX_PPS", { "SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS" } },
+        },
+        false, false
+    },
+    {
+        "TUNNEL", COUNTERS_TUNNEL_NAME_MAP,
+        {
+            { "RX_BPS", { "SAI_TUNNEL_STAT_IN_OCTETS" } },
+            { "RX_PPS", { "SAI_TUNNEL_STAT_IN_PACKETS" } },
+            { "TX_BPS", { "SAI_TUNNEL_STAT_OUT_OCTETS" } },
+            { "TX_PPS", { "SAI_TUNNEL_STAT_OUT_PACKETS" } },
+        },
+        true, false
+    },
+    {
+        "TRAP", COUNTERS_TRAP_NAME_MAP,
+        {
+            { "RX_PPS", { "SAI_COUNTER_STAT_PACKETS" } },
+        },
+        true, false
+    },
+};
+
+/* Format a number the way Lua does */
+static string formatNumber(double value)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.14g", value);
+    return buf;
+}
+
+static bool parseCounter(const string &str, uint64_t &value)
+{
+    if (str.empty())
+    {
+        return false;
+    }
+
+    char *end = nullptr;
+    errno = 0;
+    value = strtoull(str.c_str(), &end, 10);
+    return errno == 0 && *end == '\0';
+}
+
+/* Counter delta, negative if the counter was cleared */
+static double counterDelta(uint64_t current, uint64_t last)
+{
+    return static_cast<double>(static_cast<int64_t>(current - last));
+}
+
+const vector<CounterRateSpec> &CounterRates::getSpecs()
+{
+    return counterRateSpecs;
+}
+
+double CounterRates::getSerdesRate(size_t laneCount, uint32_t speed)
+{
+    if (laneCount == 0 || speed == 0 || speed % laneCount != 0)
+    {
+        return 0;
+    }
+
+    double serdes;
+    switch (speed / laneCount)
+    {
+        case 1000:
+            serdes = 1.25e+9;
+            break;
+        case 10000:
+            serdes = 10.3125e+9;
+            break;
+        case 25000:
+            serdes = 25.78125e+9;
+            break;
+        case 50000:
+            serdes = 53.125e+9;
+            break;
+        case 100000:
+            serdes = 106.25e+9;
+            break;
+        case 200000:
+            serdes = 212.5e+9;
+            break;
+        default:
+            return 0;
+    }
+
+    return static_cast<double>(laneCount) * serdes;
+}
+
+CounterRates::CounterRates(const CounterRateSpec &spec) :
+    m_spec(spec)
+{
+    for (const auto &rate : m_spec.rates)
+    {
+        vector<size_t> indexes;
+        for (const auto &counter : rate.second)
+        {
+            auto it = find(m_counters.begin(), m_counters.end(), counter);
+            indexes.push_back(static_cast<size_t>(it - m_counters.begin()));
+            if (it == m_counters.end())
+            {
+                m_counters.push_back(counter);
+            }
+        }
+        m_rateCounters.push_back(indexes);
+    }
+
+    m_fecIndex = m_counters.size();
+    if (m_spec.fec)
+    {
+        m_counters.push_back(FEC_CORRECTED_BITS);
+        m_counters.push_back(FEC_NOT_CORRECTABLE_FRAMES);
+        for (int i = 0; i < FEC_HISTOGRAM_BINS; i++)
+        {
+            m_counters.push_back(FEC_CODEWORD_ERRORS_PREFIX + to_string(i));
+        }
+    }
+}
+
+bool CounterRates::update(const string &object, const vector<string> &snapshot,
+                          double deltaMs, double alpha, double serdesRate,
+                          vector<FieldValueTuple> &rates,
+                          vector<FieldValueTuple> &state)
+{
+    if (snapshot.size() != m_counters.size() || deltaMs <= 0)
+    {
+        return false;
+    }
+
+    vector<uint64_t> values(m_fecIndex);
+    for (size_t i = 0; i < m_fecIndex; i++)
+    {
+        if (!parseCounter(snapshot[i], values[i]) && !m_spec.zeroMissing)
+        {
+            return false;
+        }
+    }
+
+    auto &obj = m_objects[object];
+    bool initialized = obj.init != InitState::NONE;
+
+    if (initialized)
+    {
+        vector<double> newRates;
+        for (const auto &indexes : m_rateCounters)
+        {
+            double delta = 0;
+            for (auto index : indexes)
+            {
+                delta += counterDelta(values[index], obj.last[index]);
+            }
+            newRates.push_back(delta * 1000 / deltaMs);
+        }
+
+        if (obj.init == InitState::DONE)
+        {
+            for (size_t i = 0; i < newRates.size(); i++)
+            {
+                obj.rates[i] = alpha * newRates[i] + (1.0 - alpha) * obj.rates[i];
+            }
+        }
+        else
+        {
+            obj.rates = newRates;
+            obj.init = InitState::DONE;
+            state.emplace_back("INIT_DONE", "DONE");
+        }
+
+        for (size_t i = 0; i < obj.rates.size(); i++)
+        {
+            rates.emplace_back(m_spec.rates[i].first, formatNumber(obj.rates[i]));
+        }
+    }
+    else
+    {
+        obj.init = InitState::COUNTERS_LAST;
+        state.emplace_back("INIT_DONE", "COUNTERS_LAST");
+    }
+
+    obj.last = values;
+    for (size_t i = 0; i < m_fecIndex; i++)
+    {
+        rates.emplace_back(m_counters[i] + "_last", to_string(values[i]));
+    }
+
+    uint64_t corrected, uncorrectable;
+    if (!m_spec.fec ||
+        !parseCounter(snapshot[m_fecIndex], corrected) ||
+        !parseCounter(snapshot[m_fecIndex + 1], uncorrectable))
+    {
+        return true;
+    }
+
+    double preBer = -1, postBer = -1;
+    if (initialized)
+    {
+        if (serdesRate > 0)
+        {
+            double bits = serdesRate * deltaMs / 1000;
+            preBer = counterDelta(corrected, obj.fecCorrectedBitsLast) / bits;
+            postBer = counterDelta(uncorrectable, obj.fecUncorrectableFramesLast) * RS_AVERAGE_FRAME_BER / bits;
+        }
+
+        if (preBer > obj.fecPreBerMax)
+        {
+            obj.fecPreBerMax = preBer;
+            rates.emplace_back("FEC_PRE_BER_MAX", formatNumber(preBer));
+        }
+
+        /* Highest histogram bin with a non zero count */
+        int maxT = -1;
+        for (int i = 0; i < FEC_HISTOGRAM_BINS; i++)
+        {
+            uint64_t count;
+            if (parseCounter(snapshot[m_fecIndex + 2 + static_cast<size_t>(i)], count) && count > 0)
+            {
+                maxT = i;
+            }
+        }
+        rates.emplace_back("FEC_MAX_T", to_string(maxT));
+    }
+
+    obj.fecCorrectedBitsLast = corrected;
+    obj.fecUncorrectableFramesLast = uncorrectable;
+    rates.emplace_back(FEC_CORRECTED_BITS_LAST, to_string(corrected));
+    rates.emplace_back(FEC_NOT_CORRECTABLE_FRAMES_LAST, to_string(uncorrectable));
+    rates.emplace_back("FEC_PRE_BER", formatNumber(preBer));
+    rates.emplace_back("FEC_POST_BER", formatNumber(postBer));
+
+    return true;
+}
+
+void CounterRates::setFecPreBerMax(const string &object, double fecPreBerMax)
+{
+    m_objects[object].fecPreBerMax = fecPreBerMax;
+}
+
+void CounterRates::remove(const string &object)
+{
+    m_objects.erase(object);
+}
+
+vector<string> CounterRates::getObjects() const
+{
+    vector<string> objects;
+    for (const auto &it : m_objects)
+    {
+        objects.push_back(it.first);
+    }
+    return objects;
+}
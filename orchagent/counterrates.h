@@ -0,0 +1,99 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "table.h"
+
+/* How the rates of one counter object type are computed */
+struct CounterRateSpec
+{
+    /* Object type of the RATES:<type> config and RATES:<object>:<type> state keys */
+    std::string type;
+    /* COUNTERS_DB map of the object names to their counter keys */
+    std::string nameMap;
+    /* Rate fields and the counters summed into each of them */
+    std::vector<std::pair<std::string, std::vector<std::string>>> rates;
+    /* Missing counters read as 0, otherwise an object missing one is skipped */
+    bool zeroMissing;
+    /* Compute the port FEC BER and max T */
+    bool fec;
+};
+
+/*
+ * CounterRates computes the smoothed rates of the objects of one type from
+ * successive counter snapshots, as port_rates.lua, rif_rates.lua,
+ * tunnel_rates.lua and trap_rates.lua do inside Redis. The fields written are
+ * the same as the scripts write, but the last counters and rates are kept in
+ * memory rather than read back from COUNTERS_DB.
+ *
+ * The first snapshot of an object only records its counters, the second
+ * gives its raw rates, and the following ones the rates smoothed with
+ * rate = alpha * new + (1 - alpha) * old.
+ */
+class CounterRates
+{
+public:
+    static const std::vector<CounterRateSpec> &getSpecs();
+
+    /* Serdes rate in bits per second of a port, 0 if unknown */
+    static double getSerdesRate(size_t laneCount, uint32_t speed);
+
+    CounterRates(const CounterRateSpec &spec);
+
+    const CounterRateSpec &getSpec() const
+    {
+        return m_spec;
+    }
+
+    /* Counters of a snapshot, in snapshot order */
+    const std::vector<std::string> &getCounters() const
+    {
+        return m_counters;
+    }
+
+    /*
+     * Take the snapshot of an object, one counter value per getCounters()
+     * entry and empty for a missing counter, deltaMs after the previous one.
+     * Fills the fields to set on RATES:<object> and RATES:<object>:<type>,
+     * returns false if the object was skipped.
+     */
+    bool update(const std::string &object, const std::vector<std::string> &snapshot,
+                double deltaMs, double alpha, double serdesRate,
+                std::vector<swss::FieldValueTuple> &rates,
+                std::vector<swss::FieldValueTuple> &state);
+
+    /* Start the FEC_PRE_BER_MAX of an object from the value already in RATES */
+    void setFecPreBerMax(const std::string &object, double fecPreBerMax);
+
+    void remove(const std::string &object);
+
+    std::vector<std::string> getObjects() const;
+
+private:
+    enum class InitState
+    {
+        NONE,
+        COUNTERS_LAST,
+        DONE
+    };
+
+    struct ObjectRates
+    {
+        InitState init = InitState::NONE;
+        std::vector<uint64_t> last;
+        std::vector<double> rates;
+        uint64_t fecCorrectedBitsLast = 0;
+        uint64_t fecUncorrectableFramesLast = 0;
+        double fecPreBerMax = 0;
+    };
+
+    CounterRateSpec m_spec;
+    std::vector<std::string> m_counters;
+    /* Indexes in m_counters of the counters of each rate */
+    std::vector<std::vector<size_t>> m_rateCounters;
+    size_t m_fecIndex = 0;
+    std::map<std::string, ObjectRates> m_objects;
+};
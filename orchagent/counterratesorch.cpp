@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <hiredis/hiredis.h>
+
+#include "counterratesorch.h"
+#include "logger.h"
+#include "notifier.h"
+#include "redisreply.h"
+#include "schema.h"
+
+using namespace std;
+using namespace swss;
+
+#define COUNTERS_RATES_TABLE "RATES"
+#define COUNTER_RATES_POLL_CHANNEL "COUNTER_RATES_POLL"
+/* Seconds between two refreshes of the object lists */
+#define COUNTER_RATES_REFRESH_SEC 10
+
+CounterRatesOrch::CounterRatesOrch() :
+    Orch(),
+    m_countersDb(make_shared<DBConnector>("COUNTERS_DB", 0)),
+    m_applDb(make_shared<DBConnector>("APPL_DB", 0)),
+    m_pipeline(m_countersDb.get()),
+    m_countersTable(m_countersDb.get(), COUNTERS_TABLE),
+    m_ratesTable(&m_pipeline, COUNTERS_RATES_TABLE, true),
+    m_portTable(m_applDb.get(), APP_PORT_TABLE_NAME)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &spec : CounterRates::getSpecs())
+    {
+        m_types.emplace_back(new ObjectType(spec));
+    }
+
+    refreshObjects();
+
+    m_pollNotifications = new NotificationConsumer(m_countersDb.get(), COUNTER_RATES_POLL_CHANNEL);
+    Orch::addExecutor(new Notifier(m_pollNotifications, this, COUNTER_RATES_POLL_CHANNEL));
+
+    auto interval = timespec { .tv_sec = COUNTER_RATES_REFRESH_SEC, .tv_nsec = 0 };
+    m_refreshTimer = new SelectableTimer(interval);
+    Orch::addExecutor(new ExecutableTimer(m_refreshTimer, this, "COUNTER_RATES_REFRESH_TIMER"));
+    m_refreshTimer->start();
+}
+
+void CounterRatesOrch::doTask(NotificationConsumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
+
+    /* Polls queued behind each other are read at once, their intervals add up */
+    for (const auto &entry : entries)
+    {
+        const auto &typeName = kfvOp(entry);
+        auto type = find_if(m_types.begin(), m_types.end(),
+                            [&](const unique_ptr<ObjectType> &t) { return t->rates.getSpec().type == typeName; });
+        if (type == m_types.end())
+        {
+            SWSS_LOG_WARN("Unknown counter rates object type %s", typeName.c_str());
+            continue;
+        }
+
+        auto intervalMs = strtoull(kfvKey(entry).c_str(), nullptr, 10);
+        if (intervalMs == 0)
+        {
+            SWSS_LOG_WARN("Invalid poll interval %s of %s counters", kfvKey(entry).c_str(), typeName.c_str());
+            continue;
+        }
+
+        (*type)->pollTimeMs += intervalMs;
+        (*type)->pollIntervalMs = intervalMs;
+        (*type)->polled = true;
+        setAlpha(**type, kfvFieldsValues(entry));
+    }
+
+    for (auto &type : m_types)
+    {
+        if (type->polled)
+        {
+            poll(*type);
+        }
+    }
+}
+
+void CounterRatesOrch::doTask(SelectableTimer &timer)
+{
+    SWSS_LOG_ENTER();
+
+    refreshObjects();
+}
+
+void CounterRatesOrch::refreshObjects()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto &type : m_types)
+    {
+        const auto &spec = type->rates.getSpec();
+
+        Table nameMap(m_countersDb.get(), spec.nameMap);
+        vector<FieldValueTuple> names;
+        nameMap.get("", names);
+
+        type->objects.clear();
+        for (const auto &name : names)
+        {
+            type->objects[fvValue(name)] = fvField(name);
+        }
+
+        auto tracked = type->rates.getObjects();
+        for (const auto &object : tracked)
+        {
+            if (type->objects.find(object) == type->objects.end())
+            {
+                type->rates.remove(object);
+                type->snapshotTimes.erase(object);
+            }
+        }
+
+        if (!spec.fec)
+        {
+            continue;
+        }
+
+        /* Keep the FEC_PRE_BER_MAX already in RATES, e.g. across restarts, as port_rates.lua does */
+        for (const auto &object : type->objects)
+        {
+            string value;
+            if (find(tracked.begin(), tracked.end(), object.first) == tracked.end() &&
+                m_ratesTable.hget(object.first, "FEC_PRE_BER_MAX", value))
+            {
+                type->rates.setFecPreBerMax(object.first, strtod(value.c_str(), nullptr));
+            }
+        }
+
+        vector<string> keys;
+        for (const auto &object : type->objects)
+        {
+            keys.push_back(m_portTable.getKeyName(object.second));
+        }
+        auto ports = readFields(m_applDb.get(), keys, { "lanes", "speed" });
+
+        m_serdesRates.clear();
+        size_t i = 0;
+        for (const auto &object : type->objects)
+        {
+            const auto &lanes = ports[i][0];
+            const auto &speed = ports[i][1];
+            i++;
+
+            if (lanes.empty() || speed.empty())
+            {
+                continue;
+            }
+
+            size_t laneCount = static_cast<size_t>(count(lanes.begin(), lanes.end(), ',')) + 1;
+            m_serdesRates[object.second] = CounterRates::getSerdesRate(laneCount, static_cast<uint32_t>(strtoul(speed.c_str(), nullptr, 10)));
+        }
+    }
+}
+
+void CounterRatesOrch::setAlpha(ObjectType &type, const vector<FieldValueTuple> &config)
+{
+    const auto &spec = type.rates.getSpec();
+
+    type.alpha = 0;
+    for (const auto &fv : config)
+    {
+        if (fvField(fv) == spec.type + "_ALPHA")
+        {
+            type.alpha = strtod(fvValue(fv).c_str(), nullptr);
+            return;
+        }
+        else if (fvField(fv) == spec.type + "_SMOOTH_INTERVAL")
+        {
+            type.alpha = 2.0 / (strtod(fvValue(fv).c_str(), nullptr) + 1.0);
+        }
+    }
+}
+
+void CounterRatesOrch::poll(ObjectType &type)
+{
+    SWSS_LOG_ENTER();
+
+    const auto &spec = type.rates.getSpec();
+
+    type.polled = false;
+
+    if (type.alpha <= 0)
+    {
+        SWSS_LOG_DEBUG("Alpha is not defined for %s rates", spec.type.c_str());
+        return;
+    }
+
+    if (type.objects.empty())
+    {
+        return;
+    }
+
+    vector<string> keys;
+    for (const auto &object : type.objects)
+    {
+        keys.push_back(m_countersTable.getKeyName(object.first));
+    }
+    auto snapshots = readFields(m_countersDb.get(), keys, type.rates.getCounters());
+
+    size_t i = 0;
+    for (const auto &object : type.objects)
+    {
+        const auto &snapshot = snapshots[i++];
+
+        /* The first snapshot of an object only records its counters */
+        double deltaMs = static_cast<double>(type.pollIntervalMs);
+        auto last = type.snapshotTimes.find(object.first);
+        if (last != type.snapshotTimes.end())
+        {
+            deltaMs = static_cast<double>(type.pollTimeMs - last->second);
+        }
+
+        double serdesRate = 0;
+        auto serdes = m_serdesRates.find(object.second);
+        if (spec.fec && serdes != m_serdesRates.end())
+        {
+            serdesRate = serdes->second;
+        }
+
+        vector<FieldValueTuple> rates, state;
+        if (!type.rates.update(object.first, snapshot, deltaMs, type.alpha, serdesRate, rates, state))
+        {
+            SWSS_LOG_DEBUG("Not found some counters on %s", object.second.c_str());
+            continue;
+        }
+        type.snapshotTimes[object.first] = type.pollTimeMs;
+
+        if (!rates.empty())
+        {
+            m_ratesTable.set(object.first, rates);
+        }
+        if (!state.empty())
+        {
+            m_ratesTable.set(object.first + m_ratesTable.getTableNameSeparator() + spec.type, state);
+        }
+    }
+
+    m_ratesTable.flush();
+}
+
+vector<vector<string>> CounterRatesOrch::readFields(DBConnector *db,
+                                                    const vector<string> &keys,
+                                                    const vector<string> &fields)
+{
+    SWSS_LOG_ENTER();
+
+    redisContext *context = db->getContext();
+
+    vector<const char *> argv = { "HMGET", "" };
+    vector<size_t> argvlen = { strlen("HMGET"), 0 };
+    for (const auto &field : fields)
+    {
+        argv.push_back(field.c_str());
+        argvlen.push_back(field.size());
+    }
+
+    for (const auto &key : keys)
+    {
+        argv[1] = key.c_str();
+        argvlen[1] = key.size();
+
+        RedisCommand command;
+        command.formatArgv(static_cast<int>(argv.size()), argv.data(), argvlen.data());
+        if (redisAppendFormattedCommand(context, command.c_str(), command.length()) != REDIS_OK)
+        {
+            throw runtime_error("Failed to queue HMGET " + key);
+        }
+    }
+
+    vector<vector<string>> values;
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(context, reinterpret_cast<void **>(&reply)) != REDIS_OK)
+        {
+            throw runtime_error("Failed to read HMGET replies");
+        }
+        RedisReply r(reply);
+
+        vector<string> row(fields.size());
+        if (reply->type == REDIS_REPLY_ARRAY)
+        {
+            for (size_t j = 0; j < reply->elements && j < row.size(); j++)
+            {
+                if (reply->element[j]->type == REDIS_REPLY_STRING)
+                {
+                    row[j].assign(reply->element[j]->str, reply->element[j]->len);
+                }
+            }
+        }
+        values.push_back(move(row));
+    }
+
+    return values;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "orch.h"
+#include "counterrates.h"
+#include "dbconnector.h"
+#include "notificationconsumer.h"
+#include "redisapi.h"
+#include "redispipeline.h"
+#include "selectabletimer.h"
+#include "table.h"
+#include "timer.h"
+
+#define COUNTER_RATES_POLL_PLUGIN "counter_rates_poll.lua"
+
+/*
+ * CounterRatesOrch computes the port, RIF, tunnel and trap rates in orchagent
+ * instead of the rate plugins syncd runs inside Redis after every poll.
+ *
+ * In their place each flex counter group runs counter_rates_poll.lua, which
+ * publishes the object type, the poll interval and the RATES:<type> config
+ * on COUNTER_RATES_POLL once the counters are polled. On that notification
+ * the counters of all the objects of the type are read with one pipelined
+ * round trip and their rates written back to the RATES table in one pipeline
+ * flush. The time between two snapshots of an object is the sum of the poll
+ * intervals reported in between. The object lists come from the counter
+ * name maps and, for ports, the lane count and speed from APPL_DB, both
+ * refreshed every few seconds rather than looked up on every poll.
+ *
+ * The smoothing factor is <type>_ALPHA, or 2 / (N + 1) for a
+ * <type>_SMOOTH_INTERVAL of N polls. An object type with neither is not
+ * computed, as with the plugins.
+ */
+class CounterRatesOrch : public Orch
+{
+public:
+    CounterRatesOrch();
+
+    /* Load counter_rates_poll.lua for an object type, returns its SHA */
+    static std::string loadPollPlugin(swss::DBConnector *db, const std::string &type)
+    {
+        std::string script = "local object_type = '" + type + "'\n" + swss::loadLuaScript(COUNTER_RATES_POLL_PLUGIN);
+        return swss::loadRedisScript(db, script);
+    }
+
+    void doTask(swss::NotificationConsumer &consumer) override;
+    void doTask(swss::SelectableTimer &timer) override;
+
+private:
+    struct ObjectType
+    {
+        ObjectType(const CounterRateSpec &spec) :
+            rates(spec)
+        {
+        }
+
+        CounterRates rates;
+        /* Counter key, e.g. oid:0x1000000000002, to object name */
+        std::map<std::string, std::string> objects;
+        /* Sum of the poll intervals reported so far */
+        uint64_t pollTimeMs = 0;
+        /* Interval of the last poll reported */
+        uint64_t pollIntervalMs = 0;
+        /* Counter key to the poll time of its last snapshot */
+        std::map<std::string, uint64_t> snapshotTimes;
+        /* Polled since the counters were last read */
+        bool polled = false;
+        /* Smoothing factor from the last poll, 0 if not configured */
+        double alpha = 0;
+    };
+
+    void refreshObjects();
+    void setAlpha(ObjectType &type, const std::vector<swss::FieldValueTuple> &config);
+    void poll(ObjectType &type);
+
+    /* HMGET the fields of every key in one round trip */
+    std::vector<std::vector<std::string>> readFields(swss::DBConnector *db,
+                                                     const std::vector<std::string> &keys,
+                                                     const std::vector<std::string> &fields);
+
+    std::shared_ptr<swss::DBConnector> m_countersDb;
+    std::shared_ptr<swss::DBConnector> m_applDb;
+    swss::RedisPipeline m_pipeline;
+    swss::Table m_countersTable;
+    swss::Table m_ratesTable;
+    swss::Table m_portTable;
+
+    std::vector<std::unique_ptr<ObjectType>> m_types;
+    /* Port name to serdes rate */
+    std::map<std::string, double> m_serdesRates;
+
+    swss::NotificationConsumer *m_pollNotifications;
+    swss::SelectableTimer *m_refreshTimer;
+};
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <sstream>
 #include <inttypes.h>
 
@@ -7,9 +8,12 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_INCREMENTAL_POLLING "incremental_polling"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
+/* With incremental polling, polls between two full polls */
+#define CRM_FULL_POLL_INTERVALS 10
 #define CRM_THRESHOLD_TYPE_DEFAULT CrmThresholdType::CRM_PERCENTAGE
 #define CRM_THRESHOLD_LOW_DEFAULT 70
 #define CRM_THRESHOLD_HIGH_DEFAULT 85
@@ -441,6 +445,8 @@ void CrmOrch::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     string table_name = consumer.getTableName();
 
     if (table_name != CFG_CRM_TABLE_NAME)
@@ -491,6 +497,12 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 m_timer->setInterval(interv);
                 m_timer->reset();
             }
+            else if (field == CRM_INCREMENTAL_POLLING)
+            {
+                m_incrementalPolling = (value == "true");
+                // Start over with a full poll
+                m_pollCount = 0;
+            }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
                 auto thresholdType = crmThreshTypeMap.at(value);
@@ -543,9 +555,13 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY];
+        cnt.usedCounter++;
+        cnt.dirty = true;
     }
     catch (...)
     {
@@ -558,9 +574,13 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY];
+        cnt.usedCounter--;
+        cnt.dirty = true;
     }
     catch (...)
     {
@@ -573,9 +593,13 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)];
+        cnt.usedCounter++;
+        cnt.dirty = true;
     }
     catch (...)
     {
@@ -588,9 +612,13 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)];
+        cnt.usedCounter--;
+        cnt.dirty = true;
 
         // remove acl_entry and acl_counter in this acl table
         if (resource == CrmResourceType::CRM_ACL_TABLE)
@@ -627,10 +655,14 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)];
+        cnt.usedCounter++;
+        cnt.dirty = true;
+        cnt.id = tableId;
     }
     catch (...)
     {
@@ -643,9 +675,13 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)];
+        cnt.usedCounter--;
+        cnt.dirty = true;
     }
     catch (...)
     {
@@ -658,9 +694,13 @@ void CrmOrch::incCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter++;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)];
+        cnt.usedCounter++;
+        cnt.dirty = true;
     }
     catch (...)
     {
@@ -673,9 +713,13 @@ void CrmOrch::decCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)];
+        cnt.usedCounter--;
+        cnt.dirty = true;
     }
     catch (...)
     {
@@ -688,6 +732,8 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
@@ -708,6 +754,7 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         {
             auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
             ++rule_cnt.usedCounter;
+            rule_cnt.dirty = true;
         }
     }
     catch (...)
@@ -721,6 +768,8 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
@@ -739,6 +788,7 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         {
             auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
             --rule_cnt.usedCounter;
+            rule_cnt.dirty = true;
         }
     }
     catch (...)
@@ -752,8 +802,12 @@ void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
-    getResAvailableCounters();
-    updateCrmCountersTable();
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
+    bool full = !m_incrementalPolling || (m_pollCount++ % CRM_FULL_POLL_INTERVALS == 0);
+
+    getResAvailableCounters(full);
+    updateCrmCountersTable(full);
     checkCrmThresholds();
 }
 
@@ -829,12 +883,14 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
         availCount = attr.value.u32;
     }
 
-    res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+    auto &cnt = res.countersMap[CRM_COUNTERS_TABLE_KEY];
+    cnt.availableCounter = static_cast<uint32_t>(availCount);
+    cnt.dirty = false;
 
     return true;
 }
 
-bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res)
+bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res, bool full)
 {
     if (gMySwitchType != "dpu")
     {
@@ -846,6 +902,11 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
 
     for (auto &cnt : res.countersMap)
     { 
+        if (!full && !cnt.second.dirty)
+        {
+            continue;
+        }
+
         sai_attribute_t attr;
         attr.id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
         attr.value.oid = cnt.second.id;
@@ -870,12 +931,13 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
         }
 
         cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+        cnt.second.dirty = false;
     }
 
     return true;
 }
 
-void CrmOrch::getResAvailableCounters()
+void CrmOrch::getResAvailableCounters(bool full)
 {
     SWSS_LOG_ENTER();
 
@@ -887,6 +949,14 @@ void CrmOrch::getResAvailableCounters()
             continue;
         }
 
+        // Between full polls, skip the resources with no used counter
+        // changed since their last query
+        if (!full && !any_of(res.second.countersMap.begin(), res.second.countersMap.end(),
+                             [](const pair<const string, CrmResourceCounter> &cnt) { return cnt.second.dirty; }))
+        {
+            continue;
+        }
+
         switch (res.first)
         {
             case CrmResourceType::CRM_IPV4_ROUTE:
@@ -985,6 +1055,12 @@ void CrmOrch::getResAvailableCounters()
                     res.second.countersMap[key].availableCounter = attr.value.aclresource.list[i].avail_num;
                 }
 
+                // One query returns all the stages and bind points
+                for (auto &cnt : res.second.countersMap)
+                {
+                    cnt.second.dirty = false;
+                }
+
                 break;
             }
 
@@ -996,6 +1072,11 @@ void CrmOrch::getResAvailableCounters()
 
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!full && !cnt.second.dirty)
+                    {
+                        continue;
+                    }
+
                     sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
                     if ((status == SAI_STATUS_NOT_SUPPORTED) ||
                         (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -1014,6 +1095,7 @@ void CrmOrch::getResAvailableCounters()
                     }
 
                     cnt.second.availableCounter = attr.value.u32;
+                    cnt.second.dirty = false;
                 }
 
                 break;
@@ -1023,6 +1105,11 @@ void CrmOrch::getResAvailableCounters()
             {
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!full && !cnt.second.dirty)
+                    {
+                        continue;
+                    }
+
                     std::string table_name = cnt.first;
                     sai_object_type_t objType = crmResSaiObjAttrMap.at(res.first);
                     sai_attribute_t attr;
@@ -1042,6 +1129,7 @@ void CrmOrch::getResAvailableCounters()
                     }
 
                     cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+                    cnt.second.dirty = false;
                 }
                 break;
             }
@@ -1049,7 +1137,7 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_DASH_IPV4_ACL_RULE:
             case CrmResourceType::CRM_DASH_IPV6_ACL_RULE:
             {
-                getDashAclGroupResAvailability(res.first, res.second);
+                getDashAclGroupResAvailability(res.first, res.second, full);
                 break;
             }
 
@@ -1060,10 +1148,14 @@ void CrmOrch::getResAvailableCounters()
     }
 }
 
-void CrmOrch::updateCrmCountersTable()
+void CrmOrch::updateCrmCountersTable(bool full)
 {
     SWSS_LOG_ENTER();
 
+    // Counters to write per COUNTERS_DB key, only the changed ones unless
+    // this is a full poll
+    map<string, vector<FieldValueTuple>> updates;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
@@ -1077,9 +1169,10 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (full || !cnt.second.written || cnt.second.usedCounter != cnt.second.writtenUsedCounter)
+                {
+                    updates[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
+                }
             }
         }
         catch(const out_of_range &e)
@@ -1101,9 +1194,10 @@ void CrmOrch::updateCrmCountersTable()
 
             for (const auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (full || !cnt.second.written || cnt.second.availableCounter != cnt.second.writtenAvailableCounter)
+                {
+                    updates[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
+                }
             }
         }
         catch(const out_of_range &e)
@@ -1111,6 +1205,26 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    for (const auto &update : updates)
+    {
+        m_countersCrmTable->set(update.first, update.second);
+    }
+
+    for (auto &res : m_resourcesMap)
+    {
+        if (res.second.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
+        {
+            continue;
+        }
+
+        for (auto &cnt : res.second.countersMap)
+        {
+            cnt.second.written = true;
+            cnt.second.writtenUsedCounter = cnt.second.usedCounter;
+            cnt.second.writtenAvailableCounter = cnt.second.availableCounter;
+        }
+    }
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <mutex>
 #include "orch.h"
 #include "port.h"
 #include "events.h"
@@ -104,6 +105,12 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+        // The used counter changed since the last availability query
+        bool dirty = true;
+        // Counters last written to COUNTERS_DB
+        bool written = false;
+        uint32_t writtenAvailableCounter = 0;
+        uint32_t writtenUsedCounter = 0;
     };
 
     struct CrmResourceEntry
@@ -122,16 +129,22 @@ private:
     };
 
     std::chrono::seconds m_pollingInterval;
+    // Only query and write the counters whose used counter changed, with a
+    // full poll every CRM_FULL_POLL_INTERVALS polls
+    bool m_incrementalPolling = false;
+    uint32_t m_pollCount = 0;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
+    // Used counters are updated by Orchs served by different ring threads
+    std::recursive_mutex m_resourcesMutex;
 
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
-    bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
-    void getResAvailableCounters();
-    void updateCrmCountersTable();
+    bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res, bool full = true);
+    void getResAvailableCounters(bool full = true);
+    void updateCrmCountersTable(bool full = true);
     void checkCrmThresholds();
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclTableKey(sai_object_id_t id);
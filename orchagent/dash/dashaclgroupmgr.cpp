@@ -1,6 +1,9 @@
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <map>
+#include <tuple>
 
 #include "dashaclgroupmgr.h"
 
@@ -14,6 +17,7 @@
 extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern CrmOrch *gCrmOrch;
 
 using namespace std;
@@ -128,23 +132,35 @@ sai_attr_id_t getSaiStage(DashAclDirection d, sai_ip_addr_family_t f, DashAclSta
 }
 
 DashAclRuleInfo::DashAclRuleInfo(const DashAclRule &rule) :
-    m_src_tags(rule.m_src_tags),
-    m_dst_tags(rule.m_dst_tags)
+    m_rule(rule)
 {
     SWSS_LOG_ENTER();
 }
 
 bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 {
-    return (m_src_tags.find(tag_id) != end(m_src_tags)) || (m_dst_tags.find(tag_id) != end(m_dst_tags));
+    return (m_rule.m_src_tags.find(tag_id) != end(m_rule.m_src_tags)) || (m_rule.m_dst_tags.find(tag_id) != end(m_rule.m_dst_tags));
 }
 
 DashAclGroupMgr::DashAclGroupMgr(DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch) :
     m_dash_orch(dashorch),
     m_dash_acl_orch(aclorch),
-    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME))
+    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME)),
+    m_rule_bulker(sai_dash_acl_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
+
+    m_rule_prefix_set_supported = true;
+    for (auto attr_id : { SAI_DASH_ACL_RULE_ATTR_SIP, SAI_DASH_ACL_RULE_ATTR_DIP })
+    {
+        sai_attr_capability_t capability;
+        auto status = sai_query_attribute_capability(gSwitchId, (sai_object_type_t)SAI_OBJECT_TYPE_DASH_ACL_RULE, attr_id, &capability);
+        if (status != SAI_STATUS_SUCCESS || !capability.set_implemented)
+        {
+            m_rule_prefix_set_supported = false;
+        }
+    }
+    SWSS_LOG_NOTICE("ACL rule prefixes %s updated in place", m_rule_prefix_set_supported ? "are" : "are not");
 }
 
 void DashAclGroupMgr::init(DashAclGroup& group)
@@ -154,7 +170,7 @@ void DashAclGroupMgr::init(DashAclGroup& group)
 
 }
 
-void DashAclGroupMgr::create(DashAclGroup& group)
+bool DashAclGroupMgr::create(DashAclGroup& group)
 {
     SWSS_LOG_ENTER();
 
@@ -169,11 +185,14 @@ void DashAclGroupMgr::create(DashAclGroup& group)
     {
         SWSS_LOG_ERROR("Failed to create ACL group: %d, %s", status, sai_serialize_status(status).c_str());
         handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        return false;
     }
 
     CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
         CrmResourceType::CRM_DASH_IPV4_ACL_GROUP : CrmResourceType::CRM_DASH_IPV6_ACL_GROUP;
     gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    return true;
 }
 
 task_process_status DashAclGroupMgr::create(const string& group_id, DashAclGroup& group)
@@ -185,7 +204,10 @@ task_process_status DashAclGroupMgr::create(const string& group_id, DashAclGroup
         return task_failed;
     }
 
-    create(group);
+    if (!create(group))
+    {
+        return task_need_retry;
+    }
 
     m_groups_table.emplace(group_id, group);
 
@@ -194,20 +216,23 @@ task_process_status DashAclGroupMgr::create(const string& group_id, DashAclGroup
     return task_success;
 }
 
-void DashAclGroupMgr::remove(DashAclGroup& group)
+bool DashAclGroupMgr::remove(DashAclGroup& group)
 {
     SWSS_LOG_ENTER();
 
     if (group.m_dash_acl_group_id == SAI_NULL_OBJECT_ID)
     {
-        return;
+        return true;
     }
 
     sai_status_t status = sai_dash_acl_api->remove_dash_acl_group(group.m_dash_acl_group_id);
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to remove ACL group: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        if (handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status) != task_success)
+        {
+            return false;
+        }
     }
 
     CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
@@ -216,6 +241,8 @@ void DashAclGroupMgr::remove(DashAclGroup& group)
     gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
     group.m_dash_acl_group_id = SAI_NULL_OBJECT_ID;
+
+    return true;
 }
 
 task_process_status DashAclGroupMgr::remove(const string& group_id)
@@ -237,10 +264,20 @@ task_process_status DashAclGroupMgr::remove(const string& group_id)
         return task_need_retry;
     }
 
-    remove(group);
+    bool removed = removeRules(group);
+    updateTags(group_id, group);
+    if (!removed)
+    {
+        SWSS_LOG_INFO("ACL group %s still has %zu rules", group_id.c_str(), group.m_dash_acl_rule_table.size());
+        return task_need_retry;
+    }
+
+    if (!remove(group))
+    {
+        return task_need_retry;
+    }
 
-    m_groups_table.erase(group_id);
-    detachTags(group_id, group.m_tags);
+    m_groups_table.erase(group_it);
     SWSS_LOG_INFO("Removed ACL group %s", group_id.c_str());
 
     return task_success;
@@ -253,22 +290,39 @@ bool DashAclGroupMgr::exists(const string& group_id) const
     return m_groups_table.find(group_id) != m_groups_table.end();
 }
 
-DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& rule)
+void DashAclGroupMgr::getRulePrefixes(const DashAclGroup& group, const vector<sai_ip_prefix_t>& rule_prefixes,
+                                      const unordered_set<string>& tags, vector<sai_ip_prefix_t>& prefixes)
 {
     SWSS_LOG_ENTER();
 
-    vector<sai_attribute_t> attrs;
-    vector<sai_ip_prefix_t> src_prefixes = {};
-    vector<sai_ip_prefix_t> dst_prefixes = {};
+    prefixes.insert(prefixes.end(), rule_prefixes.begin(), rule_prefixes.end());
 
-    DashAclRuleInfo rule_info = rule;
+    for (const auto &tag : tags)
+    {
+        const auto& tag_prefixes = m_dash_acl_orch->getDashAclTagMgr().getPrefixes(tag);
+        prefixes.insert(prefixes.end(),
+            tag_prefixes.begin(), tag_prefixes.end());
+    }
 
-    auto any_ip = [] (const auto& g)
+    if (prefixes.empty())
     {
-        sai_ip_prefix_t ip_prefix = {};
-        ip_prefix.addr_family = g.isIpV4() ? SAI_IP_ADDR_FAMILY_IPV4 : SAI_IP_ADDR_FAMILY_IPV6;
-        return ip_prefix;
-    };
+        sai_ip_prefix_t any_ip = {};
+        any_ip.addr_family = group.isIpV4() ? SAI_IP_ADDR_FAMILY_IPV4 : SAI_IP_ADDR_FAMILY_IPV6;
+        prefixes.push_back(any_ip);
+    }
+}
+
+void DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto& rule = ctxt.rule;
+    auto& attrs = ctxt.attrs;
+    auto& protocols = ctxt.protocols;
+    auto& src_prefixes = ctxt.src_prefixes;
+    auto& dst_prefixes = ctxt.dst_prefixes;
+
+    ctxt.rule_info = rule;
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PRIORITY;
@@ -291,7 +345,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
 
-    vector<uint8_t> protocols;
     if (rule.m_protocols.size()) {
         protocols = rule.m_protocols;
     } else {
@@ -301,44 +354,8 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.back().value.u8list.count = static_cast<uint32_t>(protocols.size());
     attrs.back().value.u8list.list = protocols.data();
 
-    if (!rule.m_src_prefixes.empty())
-    {
-        src_prefixes.insert(src_prefixes.end(),
-                 rule.m_src_prefixes.begin(),  rule.m_src_prefixes.end());
-    }
-
-    if (!rule.m_dst_prefixes.empty())
-    {
-        dst_prefixes.insert(dst_prefixes.end(),
-                rule.m_dst_prefixes.begin(), rule.m_dst_prefixes.end());
-    }
-
-    for (const auto &tag : rule.m_src_tags)
-    {
-        const auto& prefixes = m_dash_acl_orch->getDashAclTagMgr().getPrefixes(tag);
-        src_prefixes.insert(src_prefixes.end(),
-            prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
-    }
-
-    for (const auto &tag : rule.m_dst_tags)
-    {
-        const auto& prefixes = m_dash_acl_orch->getDashAclTagMgr().getPrefixes(tag);
-
-        dst_prefixes.insert(dst_prefixes.end(),
-            prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
-    }
-
-    if (src_prefixes.empty())
-    {
-        src_prefixes.push_back(any_ip(group));
-    }
-
-    if (dst_prefixes.empty())
-    {
-        dst_prefixes.push_back(any_ip(group));
-    }
+    getRulePrefixes(group, rule.m_src_prefixes, rule.m_src_tags, src_prefixes);
+    getRulePrefixes(group, rule.m_dst_prefixes, rule.m_dst_tags, dst_prefixes);
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_SIP;
@@ -364,61 +381,697 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
     attrs.back().value.oid = group.m_dash_acl_group_id;
 
-    auto status = sai_dash_acl_api->create_dash_acl_rule(&rule_info.m_dash_acl_rule_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
+    m_rule_bulker.create_entry(&ctxt.rule_info.m_dash_acl_rule_id, &ctxt.object_status, static_cast<uint32_t>(attrs.size()), attrs.data());
+}
+
+bool DashAclGroupMgr::createRule(DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
     {
-        SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        SWSS_LOG_INFO("ACL group %s doesn't exist, waiting for group creating before creating rule %s", group_id.c_str(), rule_id.c_str());
+        ctxt.status = task_need_retry;
+        return true;
+    }
+    auto& group = group_it->second;
+
+    for (const auto& tag_id : ctxt.rule.m_src_tags)
+    {
+        if (!m_dash_acl_orch->getDashAclTagMgr().exists(tag_id))
+        {
+            SWSS_LOG_INFO("ACL tag %s doesn't exist, waiting for tag creating before creating rule %s", tag_id.c_str(), rule_id.c_str());
+            ctxt.status = task_need_retry;
+            return true;
+        }
+    }
+
+    for (const auto& tag_id : ctxt.rule.m_dst_tags)
+    {
+        if (!m_dash_acl_orch->getDashAclTagMgr().exists(tag_id))
+        {
+            SWSS_LOG_INFO("ACL tag %s doesn't exist, waiting for tag creating before creating rule %s", tag_id.c_str(), rule_id.c_str());
+            ctxt.status = task_need_retry;
+            return true;
+        }
+    }
+
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it != group.m_dash_acl_rule_table.end())
+    {
+        // Rules cannot be updated in place. The existing rule is removed once
+        // the new one is created, so a failed replace leaves it programmed.
+        ctxt.replaced_rule_id = rule_it->second.m_dash_acl_rule_id;
+    }
+
+    createRule(group, ctxt);
+    m_pending_rules.push_back(&ctxt);
+
+    return false;
+}
+
+void DashAclGroupMgr::createRulePost(DashAclGroup& group, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    if (ctxt.rolled_back)
+    {
+        if (ctxt.rollback_status == SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Rolled back ACL rule %s:%s, retrying with the rest of the group", group_id.c_str(), rule_id.c_str());
+            ctxt.status = task_need_retry;
+            return;
+        }
+
+        // The rule is still programmed, keep track of it
+        SWSS_LOG_ERROR("Failed to roll back ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(ctxt.rollback_status).c_str());
     }
+    else if (ctxt.object_status != SAI_STATUS_SUCCESS)
+    {
+        // Not attempted after a failure earlier in the bulk
+        if (ctxt.object_status == SAI_STATUS_NOT_EXECUTED)
+        {
+            ctxt.status = task_need_retry;
+            return;
+        }
+
+        SWSS_LOG_ERROR("Failed to create ACL rule %s:%s: %d, %s", group_id.c_str(), rule_id.c_str(), ctxt.object_status, sai_serialize_status(ctxt.object_status).c_str());
+        auto status = handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, ctxt.object_status);
+        ctxt.status = (status == task_success) ? task_failed : status;
+        return;
+    }
+
+    group.m_dash_acl_rule_table[rule_id] = ctxt.rule_info;
 
     CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
             CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
     gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
-    return rule_info;
+    SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+
+    ctxt.status = task_success;
+
+    if (ctxt.replaced_rule_id == SAI_NULL_OBJECT_ID)
+    {
+        return;
+    }
+
+    if (ctxt.replace_status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove replaced ACL rule %s:%s: %d, %s", group_id.c_str(), rule_id.c_str(), ctxt.replace_status, sai_serialize_status(ctxt.replace_status).c_str());
+        if (handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, ctxt.replace_status) != task_success)
+        {
+            // The new rule is in place, but the old one is still programmed
+            ctxt.status = task_failed;
+            return;
+        }
+    }
+
+    gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 }
 
-task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
+bool DashAclGroupMgr::removeRule(DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    ctxt.remove = true;
+
     auto group_it = m_groups_table.find(group_id);
     if (group_it == m_groups_table.end())
     {
-        SWSS_LOG_INFO("ACL group %s doesn't exist, waiting for group creating before creating rule %s", group_id.c_str(), rule_id.c_str());
-        return task_need_retry;
+        SWSS_LOG_INFO("ACL group %s doesn't exist", group_id.c_str());
+        ctxt.status = task_success;
+        return true;
     }
     auto& group = group_it->second;
 
-    for (const auto& tag_id : rule.m_src_tags)
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it == group.m_dash_acl_rule_table.end())
     {
-        if (!m_dash_acl_orch->getDashAclTagMgr().exists(tag_id))
+        SWSS_LOG_INFO("ACL rule %s:%s doesn't exist", group_id.c_str(), rule_id.c_str());
+        ctxt.status = task_success;
+        return true;
+    }
+
+    if (rule_it->second.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+    {
+        // Taken down by a prefix tag update that failed to create it again
+        group.m_dash_acl_rule_table.erase(rule_it);
+        updateTags(group_id, group);
+        ctxt.status = task_success;
+        return true;
+    }
+
+    ctxt.rule_info = rule_it->second;
+    m_rule_bulker.remove_entry(&ctxt.object_status, ctxt.rule_info.m_dash_acl_rule_id);
+    m_pending_rules.push_back(&ctxt);
+
+    return false;
+}
+
+void DashAclGroupMgr::removeRulePost(DashAclGroup& group, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    if (ctxt.object_status != SAI_STATUS_SUCCESS)
+    {
+        // Not attempted after a failure earlier in the bulk
+        if (ctxt.object_status == SAI_STATUS_NOT_EXECUTED)
         {
-            SWSS_LOG_INFO("ACL tag %s doesn't exist, waiting for tag creating before creating rule %s", tag_id.c_str(), rule_id.c_str());
-            return task_need_retry;
+            ctxt.status = task_need_retry;
+            return;
+        }
+
+        SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %d, %s", group_id.c_str(), rule_id.c_str(), ctxt.object_status, sai_serialize_status(ctxt.object_status).c_str());
+        auto status = handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, ctxt.object_status);
+        if (status != task_success)
+        {
+            ctxt.status = status;
+            return;
+        }
+    }
+
+    group.m_dash_acl_rule_table.erase(rule_id);
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+    gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    SWSS_LOG_INFO("Removed ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+
+    ctxt.status = task_success;
+}
+
+void DashAclGroupMgr::rollbackRules(const unordered_set<string>& groups)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto ctxt : m_pending_rules)
+    {
+        if (ctxt->remove || ctxt->object_status != SAI_STATUS_SUCCESS || groups.find(ctxt->group_id) == groups.end())
+        {
+            continue;
         }
+
+        m_rule_bulker.remove_entry(&ctxt->rollback_status, ctxt->rule_info.m_dash_acl_rule_id);
+        ctxt->rolled_back = true;
     }
 
-    for (const auto& tag_id : rule.m_dst_tags)
+    m_rule_bulker.flush();
+}
+
+void DashAclGroupMgr::removeReplacedRules()
+{
+    SWSS_LOG_ENTER();
+
+    // Remove the rules replaced by a rule that is now programmed.
+    // Rules not attempted after a failure are given another bulk.
+    vector<DashAclRuleBulkContext*> replaced;
+    for (auto ctxt : m_pending_rules)
     {
-        if (!m_dash_acl_orch->getDashAclTagMgr().exists(tag_id))
+        if (ctxt->remove || ctxt->replaced_rule_id == SAI_NULL_OBJECT_ID || ctxt->object_status != SAI_STATUS_SUCCESS)
         {
-            SWSS_LOG_INFO("ACL tag %s doesn't exist, waiting for tag creating before creating rule %s", tag_id.c_str(), rule_id.c_str());
-            return task_need_retry;
+            continue;
+        }
+
+        if (ctxt->rolled_back && ctxt->rollback_status == SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        replaced.push_back(ctxt);
+    }
+
+    while (!replaced.empty())
+    {
+        size_t count = replaced.size();
+
+        for (auto ctxt : replaced)
+        {
+            m_rule_bulker.remove_entry(&ctxt->replace_status, ctxt->replaced_rule_id);
+        }
+
+        m_rule_bulker.flush();
+
+        replaced.erase(remove_if(replaced.begin(), replaced.end(),
+                                 [](const DashAclRuleBulkContext* ctxt) { return ctxt->replace_status != SAI_STATUS_NOT_EXECUTED; }),
+                       replaced.end());
+
+        if (replaced.size() == count)
+        {
+            break;
         }
     }
+}
+
+void DashAclGroupMgr::flushRules()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pending_rules.empty())
+    {
+        return;
+    }
 
-    auto rule_info = createRule(group, rule);
+    m_rule_bulker.flush();
 
-    group.m_rule_count++;
-    attachTags(group_id, group.m_tags);
+    // Don't leave a group with part of the rules of the batch, remove the
+    // ones that were created and retry them along with the failed ones
+    unordered_set<string> failed_groups;
+    for (auto ctxt : m_pending_rules)
+    {
+        if (!ctxt->remove && ctxt->object_status != SAI_STATUS_SUCCESS)
+        {
+            failed_groups.insert(ctxt->group_id);
+        }
+    }
 
-    SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+    if (!failed_groups.empty())
+    {
+        rollbackRules(failed_groups);
+    }
+
+    removeReplacedRules();
+
+    unordered_set<string> groups;
+    for (auto ctxt : m_pending_rules)
+    {
+        auto& group = m_groups_table.at(ctxt->group_id);
+
+        if (ctxt->remove)
+        {
+            removeRulePost(group, *ctxt);
+        }
+        else
+        {
+            createRulePost(group, *ctxt);
+        }
+
+        groups.insert(ctxt->group_id);
+    }
+
+    for (const auto& group_id : groups)
+    {
+        updateTags(group_id, m_groups_table.at(group_id));
+    }
+
+    m_pending_rules.clear();
+}
+
+bool DashAclGroupMgr::removeRules(DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    // The ACL rule CRM counters of the group are cleared along with the group.
+    // Rules not attempted after a failure are given another bulk.
+    auto& rules = group.m_dash_acl_rule_table;
+    size_t count;
+    do
+    {
+        count = rules.size();
+
+        deque<sai_status_t> statuses;
+        for (const auto& rule : rules)
+        {
+            statuses.emplace_back(SAI_STATUS_SUCCESS);
+            if (rule.second.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+            {
+                m_rule_bulker.remove_entry(&statuses.back(), rule.second.m_dash_acl_rule_id);
+            }
+        }
+
+        m_rule_bulker.flush();
+
+        auto status_it = statuses.begin();
+        auto rule_it = rules.begin();
+        while (rule_it != rules.end())
+        {
+            auto status = *status_it++;
+            if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_NOT_EXECUTED)
+            {
+                SWSS_LOG_ERROR("Failed to remove ACL rule %s: %d, %s", rule_it->first.c_str(), status, sai_serialize_status(status).c_str());
+                if (handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status) == task_success)
+                {
+                    status = SAI_STATUS_SUCCESS;
+                }
+            }
+
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                rule_it = rules.erase(rule_it);
+            }
+            else
+            {
+                ++rule_it;
+            }
+        }
+    } while (!rules.empty() && rules.size() < count);
+
+    return rules.empty();
+}
+
+void DashAclGroupMgr::updateTags(const string& group_id, DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    unordered_set<string> tags;
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        const auto& rule_def = rule.second.m_rule;
+        tags.insert(rule_def.m_src_tags.begin(), rule_def.m_src_tags.end());
+        tags.insert(rule_def.m_dst_tags.begin(), rule_def.m_dst_tags.end());
+    }
+
+    unordered_set<string> unused_tags;
+    for (const auto& tag_id : group.m_tags)
+    {
+        if (tags.find(tag_id) == tags.end())
+        {
+            unused_tags.insert(tag_id);
+        }
+    }
+
+    detachTags(group_id, unused_tags);
+    attachTags(group_id, tags);
+
+    group.m_tags = move(tags);
+}
+
+task_process_status DashAclGroupMgr::onTagUpdate(const string& group_id, const string& tag_id)
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        return task_success;
+    }
+    auto& group = group_it->second;
+
+    vector<string> rule_ids;
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        if (rule.second.isTagUsed(tag_id))
+        {
+            rule_ids.push_back(rule.first);
+        }
+    }
+
+    if (rule_ids.empty())
+    {
+        return task_success;
+    }
+
+    SWSS_LOG_INFO("Updating %zu rules of ACL group %s using prefix tag %s", rule_ids.size(), group_id.c_str(), tag_id.c_str());
+
+    if (m_rule_prefix_set_supported)
+    {
+        return setRulePrefixes(group, rule_ids, tag_id);
+    }
+
+    if (!isBound(group))
+    {
+        return replaceRules(group_id, group, rule_ids);
+    }
+
+    // The rules of a bound group can't be taken down, swap in an updated copy of the group
+    return refreshGroup(group_id, group);
+}
+
+task_process_status DashAclGroupMgr::setRulePrefixes(DashAclGroup& group, const vector<string>& rule_ids, const string& tag_id)
+{
+    SWSS_LOG_ENTER();
+
+    auto set_prefixes = [&] (sai_object_id_t rule_oid, sai_attr_id_t attr_id, const vector<sai_ip_prefix_t>& rule_prefixes, const unordered_set<string>& tags)
+    {
+        vector<sai_ip_prefix_t> prefixes;
+        getRulePrefixes(group, rule_prefixes, tags, prefixes);
+
+        sai_attribute_t attr;
+        attr.id = attr_id;
+        attr.value.ipprefixlist.count = static_cast<uint32_t>(prefixes.size());
+        attr.value.ipprefixlist.list = prefixes.data();
+
+        return sai_dash_acl_api->set_dash_acl_rule_attribute(rule_oid, &attr);
+    };
+
+    for (const auto& rule_id : rule_ids)
+    {
+        const auto& rule_info = group.m_dash_acl_rule_table.at(rule_id);
+        const auto& rule = rule_info.m_rule;
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        if (rule.m_src_tags.find(tag_id) != rule.m_src_tags.end())
+        {
+            status = set_prefixes(rule_info.m_dash_acl_rule_id, SAI_DASH_ACL_RULE_ATTR_SIP, rule.m_src_prefixes, rule.m_src_tags);
+        }
+
+        if (status == SAI_STATUS_SUCCESS && rule.m_dst_tags.find(tag_id) != rule.m_dst_tags.end())
+        {
+            status = set_prefixes(rule_info.m_dash_acl_rule_id, SAI_DASH_ACL_RULE_ATTR_DIP, rule.m_dst_prefixes, rule.m_dst_tags);
+        }
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to update prefixes of ACL rule %s: %d, %s", rule_id.c_str(), status, sai_serialize_status(status).c_str());
+            auto handle_status = handleSaiSetStatus((sai_api_t)SAI_API_DASH_ACL, status);
+            if (handle_status != task_success)
+            {
+                return handle_status;
+            }
+        }
+    }
 
     return task_success;
 }
 
-void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
+task_process_status DashAclGroupMgr::replaceRules(const string& group_id, DashAclGroup& group, const vector<string>& rule_ids)
+{
+    SWSS_LOG_ENTER();
+
+    auto& rules = group.m_dash_acl_rule_table;
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+    // The group is not in use, take the rules down before creating them again
+    deque<sai_status_t> statuses;
+    for (const auto& rule_id : rule_ids)
+    {
+        statuses.emplace_back(SAI_STATUS_SUCCESS);
+        auto rule_oid = rules.at(rule_id).m_dash_acl_rule_id;
+        if (rule_oid != SAI_NULL_OBJECT_ID)
+        {
+            m_rule_bulker.remove_entry(&statuses.back(), rule_oid);
+        }
+    }
+
+    m_rule_bulker.flush();
+
+    task_process_status result = task_success;
+    deque<DashAclRuleBulkContext> contexts;
+    auto status_it = statuses.begin();
+    for (const auto& rule_id : rule_ids)
+    {
+        auto& rule_info = rules.at(rule_id);
+        auto status = *status_it++;
+
+        if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_NOT_EXECUTED)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %d, %s", group_id.c_str(), rule_id.c_str(), status, sai_serialize_status(status).c_str());
+            auto handle_status = handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+            if (handle_status == task_success)
+            {
+                status = SAI_STATUS_SUCCESS;
+            }
+            else if (result == task_success)
+            {
+                result = handle_status;
+            }
+        }
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            if (result == task_success)
+            {
+                result = task_need_retry;
+            }
+            continue;
+        }
+
+        // Kept with a null id until it is created again
+        if (rule_info.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+        {
+            gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+            rule_info.m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
+        }
+
+        contexts.emplace_back();
+        auto& ctxt = contexts.back();
+        ctxt.group_id = group_id;
+        ctxt.rule_id = rule_id;
+        ctxt.rule = rule_info.m_rule;
+        createRule(group, ctxt);
+    }
+
+    m_rule_bulker.flush();
+
+    for (auto& ctxt : contexts)
+    {
+        createRulePost(group, ctxt);
+        if (ctxt.status != task_success && result == task_success)
+        {
+            result = ctxt.status;
+        }
+    }
+
+    return result;
+}
+
+task_process_status DashAclGroupMgr::refreshGroup(const string& group_id, DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    DashAclGroup shadow = {};
+    shadow.m_ip_version = group.m_ip_version;
+    if (!create(shadow))
+    {
+        return task_need_retry;
+    }
+
+    deque<DashAclRuleBulkContext> contexts;
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        contexts.emplace_back();
+        auto& ctxt = contexts.back();
+        ctxt.group_id = group_id;
+        ctxt.rule_id = rule.first;
+        ctxt.rule = rule.second.m_rule;
+        createRule(shadow, ctxt);
+    }
+
+    m_rule_bulker.flush();
+
+    task_process_status result = task_success;
+    for (auto& ctxt : contexts)
+    {
+        createRulePost(shadow, ctxt);
+        if (ctxt.status != task_success && result == task_success)
+        {
+            result = ctxt.status;
+        }
+    }
+
+    if (result != task_success)
+    {
+        // Keep the current group and drop the partial copy
+        SWSS_LOG_WARN("Failed to create an updated copy of ACL group %s", group_id.c_str());
+        removeOutdated(shadow);
+        return result;
+    }
+
+    // Binding the copy replaces the current group on the ENIs
+    vector<tuple<const EniEntry*, DashAclDirection, DashAclStage>> swapped;
+    auto bind_copy = [&] ()
+    {
+        for (auto direction : { DashAclDirection::IN, DashAclDirection::OUT })
+        {
+            const auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
+            for (const auto& eni_stages : table)
+            {
+                auto eni = m_dash_orch->getEni(eni_stages.first);
+                if (!eni)
+                {
+                    SWSS_LOG_WARN("eni %s cannot be found", eni_stages.first.c_str());
+                    continue;
+                }
+
+                for (auto stage : eni_stages.second)
+                {
+                    auto status = bind(shadow, *eni, direction, stage);
+                    if (status != task_success)
+                    {
+                        return status;
+                    }
+                    swapped.emplace_back(eni, direction, stage);
+                }
+            }
+        }
+
+        return task_success;
+    };
+
+    result = bind_copy();
+    if (result != task_success)
+    {
+        // Put the current group back where the copy was bound and drop the copy
+        SWSS_LOG_WARN("Failed to bind the updated copy of ACL group %s, keeping the current group", group_id.c_str());
+        for (const auto& binding : swapped)
+        {
+            if (bind(group, *get<0>(binding), get<1>(binding), get<2>(binding)) != task_success)
+            {
+                unbind(shadow, *get<0>(binding), get<1>(binding), get<2>(binding));
+            }
+        }
+        removeOutdated(shadow);
+        return result;
+    }
+
+    shadow.m_in_tables = move(group.m_in_tables);
+    shadow.m_out_tables = move(group.m_out_tables);
+    shadow.m_tags = move(group.m_tags);
+
+    // The copy takes the place of the group, which is removed now or by removeOutdatedGroups()
+    swap(group, shadow);
+    removeOutdated(shadow);
+
+    SWSS_LOG_INFO("Swapped ACL group %s with an updated copy", group_id.c_str());
+
+    return task_success;
+}
+
+void DashAclGroupMgr::removeOutdated(DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    if (!removeRules(group) || !remove(group))
+    {
+        SWSS_LOG_WARN("Failed to remove an outdated ACL group with %zu rules, retrying later", group.m_dash_acl_rule_table.size());
+        m_outdated_groups.push_back(move(group));
+    }
+}
+
+void DashAclGroupMgr::removeOutdatedGroups()
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_outdated_groups.begin();
+    while (group_it != m_outdated_groups.end())
+    {
+        if (removeRules(*group_it) && remove(*group_it))
+        {
+            group_it = m_outdated_groups.erase(group_it);
+        }
+        else
+        {
+            ++group_it;
+        }
+    }
+}
+
+task_process_status DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
 
@@ -431,8 +1084,10 @@ void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashA
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to bind ACL group to ENI: %d", status);
-        handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
+        return handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
     }
+
+    return task_success;
 }
 
 task_process_status DashAclGroupMgr::bind(const string& group_id, const string& eni_id, DashAclDirection direction, DashAclStage stage)
@@ -448,12 +1103,21 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
 
     auto& group = group_it->second;
 
-    if (group.m_rule_count == 0)
+    if (group.m_dash_acl_rule_table.empty())
     {
         SWSS_LOG_INFO("Failed to bind ACL group %s to ENI %s. ACL group has no rules attached.", group_id.c_str(), eni_id.c_str());
         return task_failed;
     }
 
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        if (rule.second.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_INFO("ACL rule %s:%s is not programmed, waiting before binding the group to ENI %s", group_id.c_str(), rule.first.c_str(), eni_id.c_str());
+            return task_need_retry;
+        }
+    }
+
     auto eni = m_dash_orch->getEni(eni_id);
     if (!eni)
     {
@@ -461,7 +1125,11 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
         return task_need_retry;
     }
 
-    bind(group, *eni, direction, stage);
+    auto status = bind(group, *eni, direction, stage);
+    if (status != task_success)
+    {
+        return status;
+    }
 
     auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
     auto& eni_stages = table[eni_id];
@@ -473,7 +1141,7 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
     return task_success;
 }
 
-void DashAclGroupMgr::unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
+task_process_status DashAclGroupMgr::unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
 
@@ -486,8 +1154,10 @@ void DashAclGroupMgr::unbind(const DashAclGroup& group, const EniEntry& eni, Das
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to unbind ACL group from ENI: %d", status);
-        handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
+        return handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
     }
+
+    return task_success;
 }
 
 task_process_status DashAclGroupMgr::unbind(const string& group_id, const string& eni_id, DashAclDirection direction, DashAclStage stage)
@@ -525,7 +1195,11 @@ task_process_status DashAclGroupMgr::unbind(const string& group_id, const string
         return task_success;
     }
 
-    unbind(group, *eni_entry, direction, stage);
+    auto status = unbind(group, *eni_entry, direction, stage);
+    if (status != task_success)
+    {
+        return status;
+    }
 
     eni_stages.erase(stage);
     if (eni_stages.empty())
@@ -7,6 +7,7 @@
 #include <sai.h>
 #include <logger.h>
 
+#include "bulker.h"
 #include "dashorch.h"
 #include "dashtagmgr.h"
 #include "table.h"
@@ -55,8 +56,8 @@ struct DashAclRuleInfo
 {
     sai_object_id_t m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
 
-    std::unordered_set<std::string> m_src_tags;
-    std::unordered_set<std::string> m_dst_tags;
+    // Kept to program the rule again when the prefixes of its tags change
+    DashAclRule m_rule;
 
     DashAclRuleInfo() = default;
     DashAclRuleInfo(const DashAclRule &rule);
@@ -64,12 +65,45 @@ struct DashAclRuleInfo
     bool isTagUsed(const std::string &tag_id) const;
 };
 
+struct DashAclRuleBulkContext
+{
+    std::string group_id;
+    std::string rule_id;
+    bool remove = false;
+
+    DashAclRule rule;
+    DashAclRuleInfo rule_info;
+
+    // The attribute lists point here until the rule bulker is flushed
+    std::vector<sai_attribute_t> attrs;
+    std::vector<std::uint8_t> protocols;
+    std::vector<sai_ip_prefix_t> src_prefixes;
+    std::vector<sai_ip_prefix_t> dst_prefixes;
+
+    sai_status_t object_status = SAI_STATUS_NOT_EXECUTED;
+    sai_status_t rollback_status = SAI_STATUS_NOT_EXECUTED;
+    bool rolled_back = false;
+
+    // Existing rule with the same key, removed once this one is created
+    sai_object_id_t replaced_rule_id = SAI_NULL_OBJECT_ID;
+    sai_status_t replace_status = SAI_STATUS_NOT_EXECUTED;
+
+    // Result of the task, set once the rule bulker is flushed
+    task_process_status status = task_need_retry;
+
+    DashAclRuleBulkContext() {}
+
+    DashAclRuleBulkContext(const DashAclRuleBulkContext&) = delete;
+    DashAclRuleBulkContext(DashAclRuleBulkContext&&) = delete;
+};
+
 struct DashAclGroup
 {
     using EniTable = std::unordered_map<std::string, std::unordered_set<DashAclStage>>;
+    using RuleTable = std::unordered_map<std::string, DashAclRuleInfo>;
     sai_object_id_t m_dash_acl_group_id = SAI_NULL_OBJECT_ID;
     std::unordered_set<std::string> m_tags;
-    int m_rule_count = 0;
+    RuleTable m_dash_acl_rule_table;
 
     sai_ip_addr_family_t m_ip_version;
     
@@ -99,6 +133,13 @@ class DashAclGroupMgr
     std::unordered_map<std::string, DashAclGroup> m_groups_table;
     std::unique_ptr<swss::Table> m_dash_acl_rules_table;
 
+    ObjectBulker<sai_dash_acl_api_t> m_rule_bulker;
+    std::vector<DashAclRuleBulkContext*> m_pending_rules;
+    bool m_rule_prefix_set_supported;
+
+    // Groups replaced by an updated copy that could not be removed yet
+    std::vector<DashAclGroup> m_outdated_groups;
+
 public:
     DashAclGroupMgr(swss::DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch);
 
@@ -107,20 +148,45 @@ public:
     bool exists(const std::string& group_id) const;
     bool isBound(const std::string& group_id);
 
-    task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRule& rule);
+    /*
+     * Rules are created and removed in bulk. createRule() and removeRule()
+     * return true when the task is done with its result in ctxt.status, or
+     * false when the rule is queued and ctxt.status is set by flushRules().
+     */
+    bool createRule(DashAclRuleBulkContext& ctxt);
+    bool removeRule(DashAclRuleBulkContext& ctxt);
+    void flushRules();
+
+    // Program the new prefixes of a tag in the rules of the group using it
+    task_process_status onTagUpdate(const std::string& group_id, const std::string& tag_id);
 
     task_process_status bind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
     task_process_status unbind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
 
+    // Retry removing the groups left over by the tag updates
+    void removeOutdatedGroups();
+
 private:
     void init(DashAclGroup& group);
-    void create(DashAclGroup& group);
-    void remove(DashAclGroup& group);
-
-    DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
-
-    void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
-    void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
+    bool create(DashAclGroup& group);
+    bool remove(DashAclGroup& group);
+
+    void getRulePrefixes(const DashAclGroup& group, const std::vector<sai_ip_prefix_t>& rule_prefixes,
+                         const std::unordered_set<std::string>& tags, std::vector<sai_ip_prefix_t>& prefixes);
+    void createRule(DashAclGroup& group, DashAclRuleBulkContext& ctxt);
+    void createRulePost(DashAclGroup& group, DashAclRuleBulkContext& ctxt);
+    void removeRulePost(DashAclGroup& group, DashAclRuleBulkContext& ctxt);
+    void rollbackRules(const std::unordered_set<std::string>& groups);
+    void removeReplacedRules();
+    bool removeRules(DashAclGroup& group);
+    void updateTags(const std::string& group_id, DashAclGroup& group);
+    task_process_status setRulePrefixes(DashAclGroup& group, const std::vector<std::string>& rule_ids, const std::string& tag_id);
+    task_process_status replaceRules(const std::string& group_id, DashAclGroup& group, const std::vector<std::string>& rule_ids);
+    task_process_status refreshGroup(const std::string& group_id, DashAclGroup& group);
+    void removeOutdated(DashAclGroup& group);
+
+    task_process_status bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
+    task_process_status unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     bool isBound(const DashAclGroup& group);
     void attachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
     void detachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
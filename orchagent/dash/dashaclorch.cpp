@@ -107,12 +107,20 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_OUT_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclOut, this),
         PbWorker<AclGroup>::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclGroup, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclGroup, this),
-        PbWorker<AclRule>::makeMemberTask(APP_DASH_ACL_RULE_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclRule, this),
         PbWorker<PrefixTag>::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashPrefixTag, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashPrefixTag, this),
      };
 
+    // ACL groups replaced on a prefix tag update are removed once the SAI lets go of them
+    m_group_mgr.removeOutdatedGroups();
+
     const string &table_name = consumer.getTableName();
+    if (table_name == APP_DASH_ACL_RULE_TABLE_NAME)
+    {
+        doTaskAclRuleTable(consumer);
+        return;
+    }
+
     auto itr = consumer.m_toSync.begin();
     while (itr != consumer.m_toSync.end())
     {
@@ -162,6 +170,111 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
     }
 }
 
+void DashAclOrch::doTaskAclRuleTable(ConsumerBase &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    const string &table_name = consumer.getTableName();
+
+    // Rules with a task to retry keep their later tasks for the next run
+    set<string> retried;
+
+    auto it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        deque<DashAclRuleBulkContext> contexts;
+        vector<decltype(it)> tasks;
+        set<string> keys;
+
+        while (it != consumer.m_toSync.end())
+        {
+            auto &message = it->second;
+            const string &key = kfvKey(message);
+            const string &op = kfvOp(message);
+
+            if (retried.find(key) != retried.end())
+            {
+                ++it;
+                continue;
+            }
+
+            // A rule is only programmed once per bulk to keep its tasks in order
+            if (!keys.insert(key).second)
+            {
+                break;
+            }
+
+            contexts.emplace_back();
+            tasks.push_back(it);
+            auto &ctxt = contexts.back();
+
+            if (op == SET_COMMAND)
+            {
+                AclRule data;
+                if (parsePbMessage(kfvFieldsValues(message), data))
+                {
+                    taskUpdateDashAclRule(key, data, ctxt);
+                }
+                else
+                {
+                    SWSS_LOG_WARN("This orch requires protobuff message at :%s", key.c_str());
+                    ctxt.status = task_invalid_entry;
+                }
+            }
+            else if (op == DEL_COMMAND)
+            {
+                taskRemoveDashAclRule(key, ctxt);
+            }
+            else
+            {
+                SWSS_LOG_ERROR(
+                    "Unknown task : %s - %s",
+                    table_name.c_str(),
+                    op.c_str());
+                ctxt.status = task_failed;
+            }
+
+            ++it;
+        }
+
+        m_group_mgr.flushRules();
+
+        auto ctxt_it = contexts.begin();
+        for (auto itr : tasks)
+        {
+            const auto &message = itr->second;
+            const string &op = kfvOp(message);
+            task_process_status task_status = (ctxt_it++)->status;
+
+            if (task_status == task_need_retry)
+            {
+                SWSS_LOG_DEBUG(
+                    "Task %s - %s need retry",
+                    table_name.c_str(),
+                    op.c_str());
+                retried.insert(kfvKey(message));
+                continue;
+            }
+
+            if (task_status != task_success)
+            {
+                SWSS_LOG_WARN("Task %s - %s fail",
+                              table_name.c_str(),
+                              op.c_str());
+            }
+            else
+            {
+                SWSS_LOG_DEBUG(
+                    "Task %s - %s success",
+                    table_name.c_str(),
+                    op.c_str());
+            }
+
+            consumer.m_toSync.erase(itr);
+        }
+    }
+}
+
 task_process_status DashAclOrch::taskUpdateDashAclIn(
     const string &key,
     const AclIn &data)
@@ -251,33 +364,57 @@ task_process_status DashAclOrch::taskRemoveDashAclGroup(
     return m_group_mgr.remove(key);
 }
 
-task_process_status DashAclOrch::taskUpdateDashAclRule(
+bool DashAclOrch::taskUpdateDashAclRule(
     const string &key,
-    const AclRule &data)
+    const AclRule &data,
+    DashAclRuleBulkContext &ctxt)
 {
     SWSS_LOG_ENTER();
 
-    string group_id, rule_id;
-    if (!extractVariables(key, ':', group_id, rule_id))
+    if (!extractVariables(key, ':', ctxt.group_id, ctxt.rule_id))
     {
         SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
-        return task_failed;
+        ctxt.status = task_failed;
+        return true;
     }
 
-    DashAclRule rule = {};
+    if (!from_pb(data, ctxt.rule))
+    {
+        ctxt.status = task_failed;
+        return true;
+    }
 
-    if (!from_pb(data, rule))
+    if (m_group_mgr.isBound(ctxt.group_id))
     {
-        return task_failed;
+        SWSS_LOG_INFO("Failed to set dash ACL rule %s:%s, ACL group is bound to the ENI", ctxt.group_id.c_str(), ctxt.rule_id.c_str());
+        ctxt.status = task_failed;
+        return true;
+    }
+
+    return m_group_mgr.createRule(ctxt);
+}
+
+bool DashAclOrch::taskRemoveDashAclRule(
+    const string &key,
+    DashAclRuleBulkContext &ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    if (!extractVariables(key, ':', ctxt.group_id, ctxt.rule_id))
+    {
+        SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
+        ctxt.status = task_failed;
+        return true;
     }
 
-    if (m_group_mgr.isBound(group_id))
+    if (m_group_mgr.isBound(ctxt.group_id))
     {
-        SWSS_LOG_INFO("Failed to set dash ACL rule %s:%s, ACL group is bound to the ENI", group_id.c_str(), rule_id.c_str());
-        return task_failed;
+        SWSS_LOG_INFO("Failed to remove dash ACL rule %s:%s, ACL group is bound to the ENI", ctxt.group_id.c_str(), ctxt.rule_id.c_str());
+        ctxt.status = task_failed;
+        return true;
     }
 
-    return m_group_mgr.createRule(group_id, rule_id, rule);
+    return m_group_mgr.removeRule(ctxt);
 }
 
 task_process_status DashAclOrch::taskUpdateDashPrefixTag(
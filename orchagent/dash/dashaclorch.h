@@ -6,6 +6,7 @@
 #include <string>
 #include <deque>
 #include <functional>
+#include <set>
 
 #include <saitypes.h>
 #include <sai.h>
@@ -41,6 +42,7 @@ public:
 
 private:
     void doTask(ConsumerBase &consumer);
+    void doTaskAclRuleTable(ConsumerBase &consumer);
 
     task_process_status taskUpdateDashAclIn(
         const std::string &key,
@@ -60,9 +62,13 @@ private:
     task_process_status taskRemoveDashAclGroup(
         const std::string &key);
 
-    task_process_status taskUpdateDashAclRule(
+    bool taskUpdateDashAclRule(
         const std::string &key,
-        const dash::acl_rule::AclRule &data);
+        const dash::acl_rule::AclRule &data,
+        DashAclRuleBulkContext &ctxt);
+    bool taskRemoveDashAclRule(
+        const std::string &key,
+        DashAclRuleBulkContext &ctxt);
 
     task_process_status taskUpdateDashPrefixTag(
         const std::string &key,
@@ -21,6 +21,49 @@ bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag)
     return true;
 }
 
+static string getPrefixKey(const sai_ip_prefix_t& prefix)
+{
+    size_t len = (prefix.addr_family == SAI_IP_ADDR_FAMILY_IPV4) ? sizeof(prefix.addr.ip4) : sizeof(prefix.addr.ip6);
+
+    string key(1, static_cast<char>(prefix.addr_family));
+    key.append(reinterpret_cast<const char*>(&prefix.addr), len);
+    key.append(reinterpret_cast<const char*>(&prefix.mask), len);
+
+    return key;
+}
+
+static void getPrefixesDelta(const vector<sai_ip_prefix_t>& old_prefixes, const vector<sai_ip_prefix_t>& new_prefixes, size_t& added, size_t& removed)
+{
+    unordered_set<string> old_keys;
+    for (const auto& prefix : old_prefixes)
+    {
+        old_keys.insert(getPrefixKey(prefix));
+    }
+
+    added = 0;
+    size_t kept = 0;
+    unordered_set<string> new_keys;
+    for (const auto& prefix : new_prefixes)
+    {
+        auto key = getPrefixKey(prefix);
+        if (!new_keys.insert(key).second)
+        {
+            continue;
+        }
+
+        if (old_keys.find(key) != old_keys.end())
+        {
+            kept++;
+        }
+        else
+        {
+            added++;
+        }
+    }
+
+    removed = old_keys.size() - kept;
+}
+
 DashTagMgr::DashTagMgr(DashAclOrch *aclorch) :
     m_dash_acl_orch(aclorch)
 {
@@ -64,10 +107,35 @@ task_process_status DashTagMgr::update(const string& tag_id, const DashTag& new_
         return task_failed;
     }
 
-    // Update tag prefixes
-    tag.m_prefixes = new_tag.m_prefixes;
+    size_t added, removed;
+    getPrefixesDelta(tag.m_prefixes, new_tag.m_prefixes, added, removed);
+    if (added || removed)
+    {
+        SWSS_LOG_INFO("Prefix tag %s: %zu prefixes added, %zu removed", tag_id.c_str(), added, removed);
 
-    return task_success;
+        tag.m_prefixes = new_tag.m_prefixes;
+        tag.m_outdated_groups = tag.m_groups;
+    }
+
+    // Only the rules using the tag are updated, a group that fails is retried with the next update
+    auto status = task_success;
+    auto& group_mgr = m_dash_acl_orch->getDashAclGroupMgr();
+    auto group_it = tag.m_outdated_groups.begin();
+    while (group_it != tag.m_outdated_groups.end())
+    {
+        auto group_status = group_mgr.onTagUpdate(*group_it, tag_id);
+        if (group_status == task_success)
+        {
+            group_it = tag.m_outdated_groups.erase(group_it);
+            continue;
+        }
+
+        SWSS_LOG_WARN("Failed to update ACL group %s with prefix tag %s", group_it->c_str(), tag_id.c_str());
+        status = group_status;
+        ++group_it;
+    }
+
+    return status;
 }
 
 task_process_status DashTagMgr::remove(const string& tag_id)
@@ -131,6 +199,7 @@ task_process_status DashTagMgr::detach(const string& tag_id, const string& group
     ABORT_IF_NOT(tag_it != m_tag_table.end(), "Tag %s does not exist", tag_id.c_str());
     auto& tag = tag_it->second;
     tag.m_groups.erase(group_id);
+    tag.m_outdated_groups.erase(group_id);
     SWSS_LOG_NOTICE("Tag %s is no longer used by ACL group %s", tag_id.c_str(), group_id.c_str());
     
     return task_success;
@@ -16,6 +16,8 @@ struct DashTag {
     sai_ip_addr_family_t m_ip_version;
     std::vector<sai_ip_prefix_t> m_prefixes;
     std::unordered_set<std::string> m_groups;
+    // Groups with rules not programmed with the current prefixes yet
+    std::unordered_set<std::string> m_outdated_groups;
 };
 
 bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag);
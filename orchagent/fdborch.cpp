@@ -286,7 +286,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
     update.entry.mac = entry->mac_address;
     update.entry.bv_id = entry->bv_id;
     update.type = "dynamic";
-    Port vlan;
+    const Port *vlan = nullptr;
 
     SWSS_LOG_INFO("FDB event:%d, MAC: %s , BVID: 0x%" PRIx64 " , \
                    bridge port ID: 0x%" PRIx64 ".",
@@ -313,7 +313,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
     }
 
     if (entry->bv_id &&
-        !m_portsOrch->getPort(entry->bv_id, vlan))
+        (vlan = m_portsOrch->findPort(entry->bv_id)) == nullptr)
     {
         SWSS_LOG_NOTICE("FdbOrch notification type %d: Failed to locate vlan port from bv_id 0x%" PRIx64, type, entry->bv_id);
         return;
@@ -334,20 +334,21 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 // If the bp is different MOVE the MAC entry.
                 if (existing_entry->second.bridge_port_id != bridge_port_id)
                 {
-                    Port port;
                     SWSS_LOG_NOTICE("FdbOrch LEARN notification: mac %s is already in bv_id 0x%" PRIx64 "with different existing-bp 0x%" PRIx64 " new-bp:0x%" PRIx64,
                             update.entry.mac.to_string().c_str(), entry->bv_id, existing_entry->second.bridge_port_id, bridge_port_id);
-                    if (!m_portsOrch->getPortByBridgePortId(existing_entry->second.bridge_port_id, port))
+                    auto port = m_portsOrch->findPortByBridgePortId(existing_entry->second.bridge_port_id);
+                    if (port == nullptr)
                     {
                         SWSS_LOG_NOTICE("FdbOrch LEARN notification: Failed to get port by bridge port ID 0x%" PRIx64, existing_entry->second.bridge_port_id);
                         return;
                     }
                     else
                     {
-                        port.m_fdb_count--;
-                        m_portsOrch->setPort(port.m_alias, port);
-                        vlan.m_fdb_count--;
-                        m_portsOrch->setPort(vlan.m_alias, vlan);
+                        m_portsOrch->decrFdbCount(port->m_alias, 1);
+                        if (vlan)
+                        {
+                            m_portsOrch->decrFdbCount(vlan->m_alias, 1);
+                        }
                     }
                     // Continue to add (update/move) the MAC
                 }
@@ -407,9 +408,11 @@ void FdbOrch::update(sai_fdb_event_t        type,
         update.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
         update.type = "dynamic";
         update.port.m_fdb_count++;
-        m_portsOrch->setPort(update.port.m_alias, update.port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        m_portsOrch->incrFdbCount(update.port.m_alias, 1);
+        if (vlan)
+        {
+            m_portsOrch->incrFdbCount(vlan->m_alias, 1);
+        }
 
         storeFdbEntryState(update);
         notify(SUBJECT_TYPE_FDB_CHANGE, &update);
@@ -447,7 +450,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
         {
             update.type = "static";
 
-            if (vlan.m_members.find(update.port.m_alias) == vlan.m_members.end())
+            if (!vlan || vlan->m_members.find(update.port.m_alias) == vlan->m_members.end())
             {
                 FdbData fdbData;
                 fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
@@ -457,7 +460,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 fdbData.esi = existing_entry->second.esi;
                 fdbData.vni = existing_entry->second.vni;
                 saved_fdb_entries[update.port.m_alias].push_back(
-                        {existing_entry->first.mac, vlan.m_vlan_info.vlan_id, fdbData});
+                        {existing_entry->first.mac, vlan ? vlan->m_vlan_info.vlan_id : (sai_vlan_id_t)0, fdbData});
             }
             else
             {
@@ -515,7 +518,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
             SWSS_LOG_NOTICE("fdbEvent: MAC age event received, MAC is MCLAG origin, added back"
                 "to HW type %s FDB %s in %s on %s",
                 existing_entry->second.type.c_str(),
-                update.entry.mac.to_string().c_str(), vlan.m_alias.c_str(),
+                update.entry.mac.to_string().c_str(), vlan ? vlan->m_alias.c_str() : "",
                 update.port.m_alias.c_str());
 
             status = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
@@ -523,7 +526,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
             {
                 SWSS_LOG_ERROR("Failed to create %s FDB %s in %s on %s, rv:%d",
                         existing_entry->second.type.c_str(), update.entry.mac.to_string().c_str(),
-                        vlan.m_alias.c_str(), update.port.m_alias.c_str(), status);
+                        vlan ? vlan->m_alias.c_str() : "", update.port.m_alias.c_str(), status);
             }
             return;
         }
@@ -532,12 +535,11 @@ void FdbOrch::update(sai_fdb_event_t        type,
         if (!update.port.m_alias.empty())
         {
             update.port.m_fdb_count--;
-            m_portsOrch->setPort(update.port.m_alias, update.port);
+            m_portsOrch->decrFdbCount(update.port.m_alias, 1);
         }
-        if (!vlan.m_alias.empty())
+        if (vlan)
         {
-            vlan.m_fdb_count--;
-            m_portsOrch->setPort(vlan.m_alias, vlan);
+            m_portsOrch->decrFdbCount(vlan->m_alias, 1);
         }
         storeFdbEntryState(update);
 
@@ -548,7 +550,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
     }
     case SAI_FDB_EVENT_MOVE:
     {
-        Port port_old;
+        const Port *port_old = nullptr;
         auto existing_entry = m_entries.find(update.entry);
 
         SWSS_LOG_INFO("Received MOVE event for bvid=0x%" PRIx64 " mac=%s port=0x%" PRIx64,
@@ -561,7 +563,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                     update.entry.mac.to_string().c_str(), entry->bv_id);
             break;
         }
-        else if (!m_portsOrch->getPortByBridgePortId(existing_entry->second.bridge_port_id, port_old))
+        else if ((port_old = m_portsOrch->findPortByBridgePortId(existing_entry->second.bridge_port_id)) == nullptr)
         {
             SWSS_LOG_ERROR("FdbOrch MOVE notification: Failed to get port by bridge port ID 0x%" PRIx64, existing_entry->second.bridge_port_id);
             return;
@@ -606,19 +608,15 @@ void FdbOrch::update(sai_fdb_event_t        type,
 
         update.add = true;
 	update.entry.port_name = update.port.m_alias;
-        if (!port_old.m_alias.empty())
-        {
-            port_old.m_fdb_count--;
-            m_portsOrch->setPort(port_old.m_alias, port_old);
-        }
+        m_portsOrch->decrFdbCount(port_old->m_alias, 1);
         update.port.m_fdb_count++;
-        m_portsOrch->setPort(update.port.m_alias, update.port);
+        m_portsOrch->incrFdbCount(update.port.m_alias, 1);
         update.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
         storeFdbEntryState(update);
 
         notify(SUBJECT_TYPE_FDB_CHANGE, &update);
 
-        notifyTunnelOrch(port_old);
+        notifyTunnelOrch(*port_old);
 
         break;
     }
@@ -630,8 +628,8 @@ void FdbOrch::update(sai_fdb_event_t        type,
                        bridge_port_id);
 
         string vlanName = "-";
-        if (!vlan.m_alias.empty()) {
-            vlanName = "Vlan" + to_string(vlan.m_vlan_info.vlan_id);
+        if (vlan) {
+            vlanName = "Vlan" + to_string(vlan->m_vlan_info.vlan_id);
         }
 
         SWSS_LOG_INFO("FDB Flush: [ %s , %s ] = { port: %s }", update.entry.mac.to_string().c_str(),
@@ -1790,7 +1788,7 @@ void FdbOrch::deleteFdbEntryFromSavedFDB(const MacAddress &mac,
 }
 
 // Notify Tunnel Orch when the number of MAC entries
-void FdbOrch::notifyTunnelOrch(Port& port)
+void FdbOrch::notifyTunnelOrch(const Port& port)
 {
     VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
 
@@ -1798,6 +1796,8 @@ void FdbOrch::notifyTunnelOrch(Port& port)
        (port.m_fdb_count != 0))
       return;
 
-    tunnel_orch->deleteTunnelPort(port);
+    /* The port may be owned by PortsOrch, which removes it */
+    Port tunnelPort = port;
+    tunnel_orch->deleteTunnelPort(tunnelPort);
 }
 
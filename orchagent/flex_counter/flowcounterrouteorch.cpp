@@ -9,6 +9,7 @@
 #include "table.h"
 #include "vnetorch.h"
 
+#include <algorithm>
 #include <string>
 
 extern Directory<Orch*>  gDirectory;
@@ -637,26 +638,37 @@ void FlowCounterRouteOrch::createRouteFlowCounterByPattern(const RoutePattern &r
     {
         SWSS_LOG_NOTICE("Creating route flow counter for pattern %s", route_pattern.to_string().c_str());
 
-        for (auto &entry : iter->second)
+        /* Only the routes under the pattern prefix can match it */
+        std::vector<IpPrefix> candidates;
+        iter->second.forEachCovered(route_pattern.ip_prefix, [&](const RouteTable::value_type &entry)
         {
-            if (current_bound_count == route_pattern.max_match_count)
+            if (route_pattern.is_match(route_pattern.vrf_id, entry.first) &&
+                !isRouteAlreadyBound(route_pattern, entry.first))
             {
-                return;
+                candidates.push_back(entry.first);
             }
+        });
 
-            if (route_pattern.is_match(route_pattern.vrf_id, entry.first))
+        /* The trie walks routes in pre-order, bind them in IpPrefix order as the
+         * map based table did so the same routes get counters once max_match_count is hit */
+        std::sort(candidates.begin(), candidates.end());
+        for (const auto &ip_prefix : candidates)
+        {
+            if (current_bound_count == route_pattern.max_match_count)
             {
-                if (isRouteAlreadyBound(route_pattern, entry.first))
-                {
-                    continue;
-                }
+                break;
+            }
 
-                if (bindFlowCounter(route_pattern, route_pattern.vrf_id, entry.first))
-                {
-                    ++current_bound_count;
-                }
+            if (bindFlowCounter(route_pattern, route_pattern.vrf_id, ip_prefix))
+            {
+                ++current_bound_count;
             }
         }
+
+        if (current_bound_count == route_pattern.max_match_count)
+        {
+            return;
+        }
     }
 
     createRouteFlowCounterFromVnetRoutes(route_pattern, current_bound_count);
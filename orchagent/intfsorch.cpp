@@ -14,6 +14,7 @@
 #include "routeorch.h"
 #include "flowcounterrouteorch.h"
 #include "crmorch.h"
+#include "counterratesorch.h"
 #include "bufferorch.h"
 #include "directory.h"
 #include "vnetorch.h"
@@ -38,6 +39,7 @@ extern NeighOrch *gNeighOrch;
 extern string gMySwitchType;
 extern int32_t gVoqMySwitchId;
 extern bool gTraditionalFlexCounter;
+extern bool gNativeCounterRates;
 
 const int intfsorch_pri = 35;
 
@@ -84,8 +86,16 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
 
     try
     {
-        string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
-        rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+        /* RIF rates are computed by CounterRatesOrch then, once told the counters are polled */
+        if (gNativeCounterRates)
+        {
+            rifRateSha = CounterRatesOrch::loadPollPlugin(m_counter_db.get(), "RIF");
+        }
+        else
+        {
+            string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
+            rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+        }
     }
     catch (const runtime_error &e)
     {
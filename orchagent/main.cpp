@@ -30,6 +30,8 @@ extern "C" {
 #include <signal.h>
 #include "warm_restart.h"
 #include "gearboxutils.h"
+#include "routetrace.h"
+#include "bulksizer.h"
 
 using namespace std;
 using namespace swss;
@@ -49,11 +51,14 @@ MacAddress gMacAddress;
 MacAddress gVxlanMacAddress;
 
 extern size_t gMaxBulkSize;
+extern bool gAsyncRouteBulk;
+extern bool gNativeCounterRates;
 
 #define DEFAULT_BATCH_SIZE  128
 extern int gBatchSize;
 
 bool gRingMode = false;
+size_t gRingWorkers = 0;
 bool gSyncMode = false;
 sai_redis_communication_mode_t gRedisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 string gAsicInstance;
@@ -79,7 +84,7 @@ uint32_t create_switch_timeout = 0;
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF] [-I heart_beat_interval] [-R] [-W ring_workers] [-T trace_sample_rate] [-P] [-A bulk_latency_target] [-N] [-B]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -103,7 +108,16 @@ void usage()
     cout << "    -v vrf: VRF name (default empty)" << endl;
     cout << "    -I heart_beat_interval: Heart beat interval in millisecond (default 10)" << endl;
     cout << "    -R enable the ring thread feature" << endl;
+    cout << "    -W ring_workers: number of ring worker threads for independent Orchs, implies -R (default 0)" << endl;
+    cout << "                     CRM and watermark run on the workers; ACL runs on the route ring thread," << endl;
+    cout << "                     serialized with routes, as redirect rules use next hops owned by RouteOrch" << endl;
     cout << "    -D Delay in seconds before flex counter processing begins after orchagent startup (default 0)" << endl;
+    cout << "    -T trace_sample_rate: trace the latency of 1 of every trace_sample_rate routes as routetrace.rec (default 0, disabled)" << endl;
+    cout << "    -P flush route bulks asynchronously while the next batch is read, useful with -z redis_sync (ignored with -R/-W)" << endl;
+    cout << "    -A bulk_latency_target: size bulks per object type to keep bulk calls under bulk_latency_target milliseconds, -k being the maximum (default disabled)" << endl;
+    cout << "                    Requires a synchronous -z mode, in redis_async mode a bulk call only covers its serialization and -A is ignored" << endl;
+    cout << "    -N compute the port, RIF, tunnel and trap rates in orchagent instead of the Redis rate plugins" << endl;
+    cout << "    -B write swss.rec and responsepublisher.rec in the binary format from a background thread, as <file>.bin (see swssrecdump)" << endl;
 }
 
 void sighup_handler(int signo)
@@ -114,6 +128,7 @@ void sighup_handler(int signo)
     Recorder::Instance().swss.setRotate(true);
     Recorder::Instance().sairedis.setRotate(true);
     Recorder::Instance().respub.setRotate(true);
+    Recorder::Instance().routetrace.setRotate(true);
 }
 
 void syncd_apply_view()
@@ -368,9 +383,11 @@ int main(int argc, char **argv)
     string vrf;
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
+    bool binary_record = false;
     long heartBeatInterval = HEART_BEAT_INTERVAL_MSECS_DEFAULT;
+    uint32_t traceSampleRate = 0;
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:t:v:I:R:D:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:t:v:I:R:D:W:T:PA:NB")) != -1)
     {
         switch (opt)
         {
@@ -488,7 +505,59 @@ int main(int argc, char **argv)
         case 'R':
             gRingMode = true;
             break;
+        case 'W':
+            {
+                auto workers = atoi(optarg);
+                if (workers >= 0)
+                {
+                    gRingWorkers = workers;
+                    gRingMode = gRingMode || workers > 0;
+                    SWSS_LOG_NOTICE("Setting ring worker count as %zu", gRingWorkers);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for ring worker count: %d. Ignoring.", workers);
+                }
+            }
+            break;
         case 'D': { gFlexCounterDelaySec = swss::to_int<int>(optarg); } break;
+        case 'P':
+            gAsyncRouteBulk = true;
+            break;
+        case 'N':
+            gNativeCounterRates = true;
+            break;
+        case 'B':
+            binary_record = true;
+            break;
+        case 'A':
+            {
+                auto target = atoi(optarg);
+                if (target > 0)
+                {
+                    BulkSizer::setLatencyTarget(static_cast<uint64_t>(target) * 1000);
+                    BulkSizer::setAdaptive(true);
+                    SWSS_LOG_NOTICE("Adaptive bulk sizing enabled, latency target %d ms", target);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for bulk latency target: %d. Ignoring.", target);
+                }
+            }
+            break;
+        case 'T':
+            {
+                auto rate = atoi(optarg);
+                if (rate >= 0)
+                {
+                    traceSampleRate = static_cast<uint32_t>(rate);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for route trace sample rate: %d. Ignoring.", rate);
+                }
+            }
+            break;
         default: /* '?' */
             exit(EXIT_FAILURE);
         }
@@ -496,6 +565,18 @@ int main(int argc, char **argv)
 
     SWSS_LOG_NOTICE("--- Starting Orchestration Agent ---");
 
+    if (gAsyncRouteBulk && gRingMode)
+    {
+        SWSS_LOG_WARN("Asynchronous route bulk flush is not supported with the ring thread, ignoring -P");
+        gAsyncRouteBulk = false;
+    }
+
+    if (BulkSizer::isAdaptive() && gRedisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC)
+    {
+        SWSS_LOG_WARN("Bulk calls do not wait for syncd in redis_async mode, their latency cannot drive the bulk size, ignoring -A");
+        BulkSizer::setAdaptive(false);
+    }
+
     /* Initialize sairedis recording parameters */
     Recorder::Instance().sairedis.setRecord(
         (record_type & SAIREDIS_RECORD_ENABLE) == SAIREDIS_RECORD_ENABLE
@@ -514,6 +595,7 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().swss.setLocation(record_location);
     Recorder::Instance().swss.setFileName(swss_rec_filename);
+    Recorder::Instance().swss.setBinary(binary_record);
     Recorder::Instance().swss.startRec(true);
 
     Recorder::Instance().respub.setRecord(
@@ -522,13 +604,25 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().respub.setLocation(record_location);
     Recorder::Instance().respub.setFileName(responsepublisher_rec_filename);
+    Recorder::Instance().respub.setBinary(binary_record);
     Recorder::Instance().respub.startRec(false);
 
+    Recorder::Instance().routetrace.setRecord(traceSampleRate > 0);
+    Recorder::Instance().routetrace.setLocation(record_location);
+    Recorder::Instance().routetrace.startRec(false);
+
     // Instantiate database connectors
     DBConnector appl_db("APPL_DB", 0);
     DBConnector config_db("CONFIG_DB", 0);
     DBConnector state_db("STATE_DB", 0);
 
+    // Route traces complete and export from the route ring thread under -R,
+    // give them a connection of their own rather than sharing state_db
+    DBConnector route_trace_db("STATE_DB", 0);
+    Table routeTraceTable(&route_trace_db, RouteTracer::TABLE_NAME);
+    RouteTracer::Instance().setStateTable(&routeTraceTable);
+    RouteTracer::Instance().enable("orchagent", traceSampleRate);
+
     // Instantiate ZMQ server
     shared_ptr<ZmqServer> zmq_server = nullptr;
     if (zmq_server_address.empty())
@@ -839,6 +933,11 @@ int main(int argc, char **argv)
     if (gRingMode) {
         /* Initialize the ring before OrchDaemon initializing Orchs */
         orchDaemon->enableRingBuffer();
+
+        if (gRingWorkers > 0)
+        {
+            orchDaemon->enableRingWorkerPool(gRingWorkers);
+        }
     }
 
     if (!orchDaemon->init())
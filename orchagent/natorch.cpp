@@ -71,6 +71,9 @@ NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_wit
     /* Set NAT default udp timeout as 300 seconds */
     udp_timeout = 300;
 
+    /* Query the NAT entries in bulk until the SAI reports it is not supported */
+    m_natBulkQuerySupported = true;
+
     /* Set entries count to 0 */
     totalEntries = totalSnatEntries = totalDnatEntries = 0;
     totalStaticNatEntries = totalDynamicNatEntries = 0;
@@ -3097,11 +3100,9 @@ void NatOrch::doTask(SelectableTimer &timer)
 
     if (timer.getFd() == m_natQueryTimer->getFd())
     {
-        if (((natTimerTickCntr++) % NAT_HITBIT_QUERY_MULTIPLE) == 0)
-        {
-            queryHitBits();
-        }
+        queryHitBits();
         queryCounters();
+        natTimerTickCntr++;
     }
     else if (timer.getFd() == m_natTimeoutTimer->getFd())
     {
@@ -3114,51 +3115,351 @@ void NatOrch::doTask(SelectableTimer &timer)
     }
 }
 
+/* SAI keys of the NAT entries, the same as the ones they are added to the hardware with */
+static sai_nat_entry_t getNatEntryKey(const IpAddress &ipAddr, const string &nat_type)
+{
+    sai_nat_entry_t  nat_entry;
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id     = gVirtualRouterId;
+    nat_entry.switch_id = gSwitchId;
+
+    if (nat_type == "dnat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip  = ipAddr.getV4Addr();
+        nat_entry.data.mask.dst_ip = 0xffffffff;
+    }
+    else
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        nat_entry.data.key.src_ip  = ipAddr.getV4Addr();
+        nat_entry.data.mask.src_ip = 0xffffffff;
+    }
+
+    return nat_entry;
+}
+
+static sai_nat_entry_t getNaptEntryKey(const NaptEntryKey &naptKey, const string &nat_type)
+{
+    sai_nat_entry_t  nat_entry;
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id     = gVirtualRouterId;
+    nat_entry.switch_id = gSwitchId;
+
+    if (nat_type == "dnat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip       = naptKey.ip_address.getV4Addr();
+        nat_entry.data.key.l4_dst_port  = (uint16_t)(naptKey.l4_port);
+        nat_entry.data.mask.dst_ip      = 0xffffffff;
+        nat_entry.data.mask.l4_dst_port = 0xffff;
+    }
+    else
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        nat_entry.data.key.src_ip       = naptKey.ip_address.getV4Addr();
+        nat_entry.data.key.l4_src_port  = (uint16_t)(naptKey.l4_port);
+        nat_entry.data.mask.src_ip      = 0xffffffff;
+        nat_entry.data.mask.l4_src_port = 0xffff;
+    }
+
+    nat_entry.data.key.proto  = (uint8_t)((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+    nat_entry.data.mask.proto = 0xff;
+
+    return nat_entry;
+}
+
+static sai_nat_entry_t getTwiceNatEntryKey(const TwiceNatEntryKey &twiceNatKey)
+{
+    sai_nat_entry_t  nat_entry;
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id     = gVirtualRouterId;
+    nat_entry.switch_id = gSwitchId;
+    nat_entry.nat_type  = SAI_NAT_TYPE_DOUBLE_NAT;
+    nat_entry.data.key.src_ip  = twiceNatKey.src_ip.getV4Addr();
+    nat_entry.data.mask.src_ip = 0xffffffff;
+    nat_entry.data.key.dst_ip  = twiceNatKey.dst_ip.getV4Addr();
+    nat_entry.data.mask.dst_ip = 0xffffffff;
+
+    return nat_entry;
+}
+
+static sai_nat_entry_t getTwiceNaptEntryKey(const TwiceNaptEntryKey &twiceNaptKey)
+{
+    sai_nat_entry_t  nat_entry;
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id     = gVirtualRouterId;
+    nat_entry.switch_id = gSwitchId;
+    nat_entry.nat_type  = SAI_NAT_TYPE_DOUBLE_NAT;
+    nat_entry.data.key.src_ip       = twiceNaptKey.src_ip.getV4Addr();
+    nat_entry.data.mask.src_ip      = 0xffffffff;
+    nat_entry.data.key.l4_src_port  = (uint16_t)(twiceNaptKey.src_l4_port);
+    nat_entry.data.mask.l4_src_port = 0xffff;
+    nat_entry.data.key.dst_ip       = twiceNaptKey.dst_ip.getV4Addr();
+    nat_entry.data.mask.dst_ip      = 0xffffffff;
+    nat_entry.data.key.l4_dst_port  = (uint16_t)(twiceNaptKey.dst_l4_port);
+    nat_entry.data.mask.l4_dst_port = 0xffff;
+    nat_entry.data.key.proto        = (uint8_t)((twiceNaptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+    nat_entry.data.mask.proto       = 0xff;
+
+    return nat_entry;
+}
+
+/* Hit bit query slice of the NAT entries, see queryHitBits() */
+static inline size_t hashCombine(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+static uint32_t getHitBitSlice(size_t hash)
+{
+    return (uint32_t)(hash % NAT_HITBIT_QUERY_MULTIPLE);
+}
+
+static uint32_t getHitBitSlice(const IpAddress &ipAddr)
+{
+    return getHitBitSlice(hashCombine(0, ipAddr.getV4Addr()));
+}
+
+static uint32_t getHitBitSlice(const NaptEntryKey &naptKey)
+{
+    size_t hash = hashCombine(0, naptKey.ip_address.getV4Addr());
+    hash = hashCombine(hash, (size_t)naptKey.l4_port);
+    return getHitBitSlice(hashCombine(hash, naptKey.prototype == "TCP"));
+}
+
+static uint32_t getHitBitSlice(const TwiceNatEntryKey &twiceNatKey)
+{
+    size_t hash = hashCombine(0, twiceNatKey.src_ip.getV4Addr());
+    return getHitBitSlice(hashCombine(hash, twiceNatKey.dst_ip.getV4Addr()));
+}
+
+static uint32_t getHitBitSlice(const TwiceNaptEntryKey &twiceNaptKey)
+{
+    size_t hash = hashCombine(0, twiceNaptKey.src_ip.getV4Addr());
+    hash = hashCombine(hash, (size_t)twiceNaptKey.src_l4_port);
+    hash = hashCombine(hash, twiceNaptKey.dst_ip.getV4Addr());
+    hash = hashCombine(hash, (size_t)twiceNaptKey.dst_l4_port);
+    return getHitBitSlice(hashCombine(hash, twiceNaptKey.prototype == "TCP"));
+}
+
+/* Cache the counters of an entry, returns true if they differ from the ones in COUNTERS_DB */
+template <typename EntryValue>
+static bool cacheNatCounters(EntryValue &entry, uint64_t nat_translations_pkts, uint64_t nat_translations_bytes)
+{
+    if (entry.countersInDb && (entry.translatedPkts == nat_translations_pkts) &&
+        (entry.translatedBytes == nat_translations_bytes))
+    {
+        return false;
+    }
+
+    entry.translatedPkts  = nat_translations_pkts;
+    entry.translatedBytes = nat_translations_bytes;
+    entry.countersInDb    = true;
+
+    return true;
+}
+
+/* Get the same attributes of all the given NAT entries, NAT_BULK_QUERY_SIZE entries per bulk call.
+ * The entries are queried one by one if the SAI does not support the bulk query. */
+void NatOrch::getNatEntriesAttribute(const vector<sai_nat_entry_t> &keys, const vector<sai_attribute_t> &attrs,
+                                     vector<sai_attribute_t> &attrList, vector<sai_status_t> &statuses)
+{
+    const uint32_t attr_count = (uint32_t)attrs.size();
+
+    attrList.resize(keys.size() * attr_count);
+    statuses.assign(keys.size(), SAI_STATUS_NOT_EXECUTED);
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        copy(attrs.begin(), attrs.end(), attrList.begin() + (long)(idx * attr_count));
+    }
+
+    if (m_natBulkQuerySupported && (sai_nat_api->get_nat_entries_attribute == nullptr))
+    {
+        SWSS_LOG_NOTICE("Bulk query of NAT entries is not available, querying the entries one by one");
+        m_natBulkQuerySupported = false;
+    }
+
+    if (m_natBulkQuerySupported)
+    {
+        vector<uint32_t>          attrCount(NAT_BULK_QUERY_SIZE, attr_count);
+        vector<sai_attribute_t *> attrPtrs(NAT_BULK_QUERY_SIZE);
+
+        for (size_t start = 0; start < keys.size(); start += NAT_BULK_QUERY_SIZE)
+        {
+            uint32_t count = (uint32_t)min(keys.size() - start, (size_t)NAT_BULK_QUERY_SIZE);
+
+            for (uint32_t idx = 0; idx < count; idx++)
+            {
+                attrPtrs[idx] = &attrList[(start + idx) * attr_count];
+            }
+
+            sai_status_t status = sai_nat_api->get_nat_entries_attribute(count, &keys[start], attrCount.data(),
+                                                                         attrPtrs.data(),
+                                                                         SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                                         &statuses[start]);
+            if ((start == 0) && ((status == SAI_STATUS_NOT_IMPLEMENTED) || (status == SAI_STATUS_NOT_SUPPORTED)))
+            {
+                SWSS_LOG_NOTICE("Bulk query of NAT entries is not supported, querying the entries one by one");
+                m_natBulkQuerySupported = false;
+                break;
+            }
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_INFO("Bulk query of %u NAT entries returned rv:%d", count, status);
+            }
+        }
+
+        if (m_natBulkQuerySupported)
+        {
+            return;
+        }
+    }
+
+    for (size_t idx = 0; idx < keys.size(); idx++)
+    {
+        statuses[idx] = sai_nat_api->get_nat_entry_attribute(&keys[idx], attr_count, &attrList[idx * attr_count]);
+    }
+}
+
 void NatOrch::queryCounters(void)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t         queried_entries = 0;
-    struct timespec  time_now, time_end, time_spent;
+    uint32_t                          updated_entries = 0, failed_entries = 0;
+    struct timespec                   time_now, time_end, time_spent;
+    vector<sai_nat_entry_t>           keys;
+    vector<NatEntry::iterator>        natQueried;
+    vector<NaptEntry::iterator>       naptQueried;
+    vector<TwiceNatEntry::iterator>   twiceNatQueried;
+    vector<TwiceNaptEntry::iterator>  twiceNaptQueried;
+    vector<sai_attribute_t>           attrs(2), attrList;
+    vector<sai_status_t>              statuses;
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
         return;
     }
 
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+    for (auto natIter = m_natEntries.begin(); natIter != m_natEntries.end(); natIter++)
+    {
+        if (natIter->second.addedToHw)
+        {
+            keys.push_back(getNatEntryKey(natIter->first, natIter->second.nat_type));
+            natQueried.push_back(natIter);
+        }
+    }
+
+    for (auto naptIter = m_naptEntries.begin(); naptIter != m_naptEntries.end(); naptIter++)
     {
-        getNatCounters(natIter);
+        if (naptIter->second.addedToHw)
+        {
+            keys.push_back(getNaptEntryKey(naptIter->first, naptIter->second.nat_type));
+            naptQueried.push_back(naptIter);
+        }
+    }
 
-        queried_entries++;
-        natIter++;
+    for (auto tnatIter = m_twiceNatEntries.begin(); tnatIter != m_twiceNatEntries.end(); tnatIter++)
+    {
+        if (tnatIter->second.addedToHw)
+        {
+            keys.push_back(getTwiceNatEntryKey(tnatIter->first));
+            twiceNatQueried.push_back(tnatIter);
+        }
     }
 
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+    for (auto tnaptIter = m_twiceNaptEntries.begin(); tnaptIter != m_twiceNaptEntries.end(); tnaptIter++)
     {
-        getNaptCounters(naptIter);
+        if (tnaptIter->second.addedToHw)
+        {
+            keys.push_back(getTwiceNaptEntryKey(tnaptIter->first));
+            twiceNaptQueried.push_back(tnaptIter);
+        }
+    }
 
-        queried_entries++;
-        naptIter++;
+    if (keys.empty())
+    {
+        return;
+    }
+
+    attrs[0].id = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
+    attrs[1].id = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
+
+    getNatEntriesAttribute(keys, attrs, attrList, statuses);
+
+    /* Counters of the entries that could not be queried are reported as 0 */
+    size_t idx = 0;
+    auto getCounters = [&](uint64_t &nat_translations_pkts, uint64_t &nat_translations_bytes)
+    {
+        nat_translations_pkts = nat_translations_bytes = 0;
+        if (statuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            nat_translations_bytes = attrList[idx * 2].value.u64;
+            nat_translations_pkts  = attrList[idx * 2 + 1].value.u64;
+        }
+        else
+        {
+            failed_entries++;
+        }
+        idx++;
+    };
+
+    /* Only the counters that changed since the last query are written to COUNTERS_DB */
+    uint64_t nat_translations_pkts, nat_translations_bytes;
+
+    for (const auto &natIter : natQueried)
+    {
+        getCounters(nat_translations_pkts, nat_translations_bytes);
+        if (cacheNatCounters(natIter->second, nat_translations_pkts, nat_translations_bytes))
+        {
+            updateNatCounters(natIter->first, nat_translations_pkts, nat_translations_bytes);
+            updated_entries++;
+        }
     }
-    TwiceNatEntry::iterator tnatIter = m_twiceNatEntries.begin();
-    while (tnatIter != m_twiceNatEntries.end())
+
+    for (const auto &naptIter : naptQueried)
     {
-        getTwiceNatCounters(tnatIter);
+        getCounters(nat_translations_pkts, nat_translations_bytes);
+        if (cacheNatCounters(naptIter->second, nat_translations_pkts, nat_translations_bytes))
+        {
+            updateNaptCounters(naptIter->first.prototype, naptIter->first.ip_address, naptIter->first.l4_port,
+                               nat_translations_pkts, nat_translations_bytes);
+            updated_entries++;
+        }
+    }
 
-        queried_entries++;
-        tnatIter++;
+    for (const auto &tnatIter : twiceNatQueried)
+    {
+        getCounters(nat_translations_pkts, nat_translations_bytes);
+        if (cacheNatCounters(tnatIter->second, nat_translations_pkts, nat_translations_bytes))
+        {
+            updateTwiceNatCounters(tnatIter->first, nat_translations_pkts, nat_translations_bytes);
+            updated_entries++;
+        }
     }
 
-    TwiceNaptEntry::iterator tnaptIter = m_twiceNaptEntries.begin();
-    while (tnaptIter != m_twiceNaptEntries.end())
+    for (const auto &tnaptIter : twiceNaptQueried)
     {
-        getTwiceNaptCounters(tnaptIter);
+        getCounters(nat_translations_pkts, nat_translations_bytes);
+        if (cacheNatCounters(tnaptIter->second, nat_translations_pkts, nat_translations_bytes))
+        {
+            updateTwiceNaptCounters(tnaptIter->first, nat_translations_pkts, nat_translations_bytes);
+            updated_entries++;
+        }
+    }
 
-        queried_entries++;
-        tnaptIter++;
+    if (failed_entries)
+    {
+        SWSS_LOG_ERROR("Failed to get Counters for %u of %zu NAT/NAPT entries", failed_entries, keys.size());
     }
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
@@ -3167,11 +3468,8 @@ void NatOrch::queryCounters(void)
     }
     time_spent = getTimeDiff(time_now, time_end);
 
-    if (queried_entries)
-    {
-        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
-    }
+    SWSS_LOG_DEBUG("Time spent in querying counters for %zu NAT/NAPT entries (%u updated) = %lu secs, %lu msecs",
+                   keys.size(), updated_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
 }
 
 void NatOrch::addAllNatEntries(void)
@@ -3304,324 +3602,296 @@ void NatOrch::queryHitBits(void)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t         queried_entries = 0;
-    struct timespec  time_now, time_end, time_spent;
+    struct timespec                   time_now, time_end, time_spent;
+    vector<sai_nat_entry_t>           keys, reverseKeys;
+    vector<size_t>                    reverseOf;
+    vector<NatEntry::iterator>        natQueried;
+    vector<NaptEntry::iterator>       naptQueried;
+    vector<TwiceNatEntry::iterator>   twiceNatQueried;
+    vector<TwiceNaptEntry::iterator>  twiceNaptQueried;
+    vector<sai_attribute_t>           attrs(2), attrList;
+    vector<sai_status_t>              statuses;
+    vector<bool>                      active;
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
         return;
     }
 
-    /* Remove the NAT entries that are aged out.
-     * Query the NAT entries for their activity in the hardware
-     * and update the active timeout. */
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+    /* The entries are split in NAT_HITBIT_QUERY_MULTIPLE slices and one slice is queried
+     * per timer tick, so each entry is still queried every NAT_HITBIT_QUERY_MULTIPLE ticks.
+     * The slice of an entry is a hash of its key, so it does not move when other entries
+     * are added or removed. */
+    uint32_t slice = natTimerTickCntr % NAT_HITBIT_QUERY_MULTIPLE;
+    auto inSlice = [&](const auto &key) { return getHitBitSlice(key) == slice; };
+
+    /* Hitbits of the DNAT/DNAPT entries are queried along with their SNAT/SNAPT entries.
+     * Static entries are always treated active. */
+    for (auto natIter = m_natEntries.begin(); natIter != m_natEntries.end(); natIter++)
     {
-        if (checkIfNatEntryIsActive(natIter, time_now.tv_sec))
+        if (!inSlice(natIter->first) || (natIter->second.nat_type != "snat") || (natIter->second.addedToHw == false))
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            natIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+        if (natIter->second.entry_type == "static")
         {
-            if ((natIter->second.nat_type == "snat") and (natIter->second.addedToHw == true) and
-                (natIter->second.entry_type != "static"))
-            {
-                if (time_now.tv_sec - natIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = natIter->first.to_string();
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
-                }
-            } 
+            natIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        queried_entries++;
-        natIter++;
+        keys.push_back(getNatEntryKey(natIter->first, natIter->second.nat_type));
+        natQueried.push_back(natIter);
     }
 
-    /* Remove the NAPT entries that are aged out.
-     * Query the NAPT entries for their activity in the hardware
-     * and update the active timeout. */
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+    for (auto naptIter = m_naptEntries.begin(); naptIter != m_naptEntries.end(); naptIter++)
     {
-        if (checkIfNaptEntryIsActive(naptIter, time_now.tv_sec))
+        if (!inSlice(naptIter->first) || (naptIter->second.nat_type != "snat") || (naptIter->second.addedToHw == false))
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            naptIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+        if (naptIter->second.entry_type == "static")
         {
-            if ((naptIter->second.nat_type == "snat") and (naptIter->second.addedToHw == true) and
-                (naptIter->second.entry_type != "static"))
-            {
-                int timeout = naptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - naptIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
-                }
-            }
+            naptIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        queried_entries++;
-        naptIter++;
+        keys.push_back(getNaptEntryKey(naptIter->first, naptIter->second.nat_type));
+        naptQueried.push_back(naptIter);
     }
 
-    /* Remove the Twice NAT entries that are aged out.
-     * Query the Twice NAT entries for their activity in the hardware
-     * and update the active timeout. */
-    TwiceNatEntry::iterator twiceNatIter = m_twiceNatEntries.begin();
-    while (twiceNatIter != m_twiceNatEntries.end())
+    for (auto twiceNatIter = m_twiceNatEntries.begin(); twiceNatIter != m_twiceNatEntries.end(); twiceNatIter++)
     {
-        if (checkIfTwiceNatEntryIsActive(twiceNatIter, time_now.tv_sec))
+        if (!inSlice(twiceNatIter->first))
+        {
+            continue;
+        }
+        if (twiceNatIter->second.entry_type == "static")
         {
-            /* Since the entry is active in the hardware, reset the active time */
             twiceNatIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+        if (twiceNatIter->second.addedToHw == false)
         {
-            if ((twiceNatIter->second.addedToHw == true) and
-                (twiceNatIter->second.entry_type != "static"))
-            {
-                if (time_now.tv_sec - twiceNatIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNatIter->first.src_ip.to_string() + ":" + twiceNatIter->first.dst_ip.to_string());
-                    setTimeoutNotifier->send("AGEOUT-TWICE-NAT", key, fvVector);
-                }
-            }
+            continue;
         }
-        queried_entries++;
-        twiceNatIter++;
+        keys.push_back(getTwiceNatEntryKey(twiceNatIter->first));
+        twiceNatQueried.push_back(twiceNatIter);
     }
 
-    /* Remove the Twice NAPT entries that are aged out.
-     * Query the Twice NAPT entries for their activity in the hardware
-     * and update the active timeout. */
-    TwiceNaptEntry::iterator twiceNaptIter = m_twiceNaptEntries.begin();
-    while (twiceNaptIter != m_twiceNaptEntries.end())
+    for (auto twiceNaptIter = m_twiceNaptEntries.begin(); twiceNaptIter != m_twiceNaptEntries.end(); twiceNaptIter++)
     {
-        if (checkIfTwiceNaptEntryIsActive(twiceNaptIter, time_now.tv_sec))
+        if (!inSlice(twiceNaptIter->first) || (twiceNaptIter->second.addedToHw == false))
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            twiceNaptIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+        if (twiceNaptIter->second.entry_type == "static")
         {
-            if ((twiceNaptIter->second.addedToHw == true) and
-                (twiceNaptIter->second.entry_type != "static"))
-            {
-                int timeout = twiceNaptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - twiceNaptIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) + 
-                                       ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
-                    setTimeoutNotifier->send("AGEOUT-TWICE-NAPT", key, fvVector);
-                }
-            }
+            twiceNaptIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        queried_entries++;
-        twiceNaptIter++;
+        keys.push_back(getTwiceNaptEntryKey(twiceNaptIter->first));
+        twiceNaptQueried.push_back(twiceNaptIter);
     }
-    if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
+
+    if (keys.empty())
     {
         return;
     }
-    time_spent = getTimeDiff(time_now, time_end);
 
-    if (queried_entries)
-    {
-        SWSS_LOG_DEBUG("Time spent in querying hardware hit-bits for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
-    }
-}
+    attrs[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
+    attrs[0].value.booldata = 0;
+    attrs[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
+    attrs[1].value.booldata = 1;
 
-void NatOrch::updateAllConntrackEntries(void)
-{
-    SWSS_LOG_ENTER();
+    getNatEntriesAttribute(keys, attrs, attrList, statuses);
 
-    /* Send notifications for the Single NAT entries to set timeout */
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+    active.resize(keys.size());
+    for (size_t idx = 0; idx < keys.size(); idx++)
     {
+        active[idx] = (statuses[idx] == SAI_STATUS_SUCCESS) && attrList[idx * 2].value.booldata;
+    }
 
-        if ((natIter->second.nat_type == "snat") and (natIter->second.addedToHw == true) and
-            (natIter->second.entry_type != "static"))
+    /* If SNAT/SNAPT HitBit is not set, check for the HitBit in the reverse direction */
+    size_t idx = 0;
+    for (const auto &natIter : natQueried)
+    {
+        if (!active[idx])
         {
-            SWSS_LOG_ERROR("Update %s NAT entry [ip %s]", natIter->second.nat_type.c_str(), natIter->first.to_string().c_str());
-            std::vector<FieldValueTuple> fvVector;
-            std::string key = natIter->first.to_string();
-            setTimeoutNotifier->send("SET-SINGLE-NAT", key, fvVector);
+            auto dnatIter = m_natEntries.find(natIter->second.translated_ip);
+            if ((dnatIter != m_natEntries.end()) && (dnatIter->second.addedToHw == true))
+            {
+                reverseKeys.push_back(getNatEntryKey(natIter->second.translated_ip, "dnat"));
+                reverseOf.push_back(idx);
+            }
         }
-        natIter++;
+        idx++;
     }
 
-    /* Send notifications for the Single NAPT entries to set timeout */
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+    for (const auto &naptIter : naptQueried)
     {
-        if ((naptIter->second.nat_type == "snat") and (naptIter->second.addedToHw == true) and
-            (naptIter->second.entry_type != "static"))
+        if (!active[idx])
         {
-            std::vector<FieldValueTuple> fvVector;
-            std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
-            setTimeoutNotifier->send("SET-SINGLE-NAPT", key, fvVector);
+            NaptEntryKey dnaptKey;
+            dnaptKey.ip_address = naptIter->second.translated_ip;
+            dnaptKey.l4_port    = naptIter->second.translated_l4_port;
+            dnaptKey.prototype  = naptIter->first.prototype;
+
+            auto dnaptIter = m_naptEntries.find(dnaptKey);
+            if ((dnaptIter != m_naptEntries.end()) && (dnaptIter->second.addedToHw == true))
+            {
+                reverseKeys.push_back(getNaptEntryKey(dnaptKey, "dnat"));
+                reverseOf.push_back(idx);
+            }
         }
-        naptIter++;
+        idx++;
     }
 
-    /* Send notifications for the Twice NAT entries to set timeout */
-    TwiceNatEntry::iterator twiceNatIter = m_twiceNatEntries.begin();
-    while (twiceNatIter != m_twiceNatEntries.end())
+    if (!reverseKeys.empty())
     {
-        if ((twiceNatIter->second.addedToHw == true) and
-            (twiceNatIter->second.entry_type != "static"))
+        getNatEntriesAttribute(reverseKeys, attrs, attrList, statuses);
+
+        for (size_t ridx = 0; ridx < reverseKeys.size(); ridx++)
         {
-            std::vector<FieldValueTuple> fvVector;
-            std::string key = (twiceNatIter->first.src_ip.to_string() + ":" + twiceNatIter->first.dst_ip.to_string());
-            setTimeoutNotifier->send("SET-TWICE-NAT", key, fvVector);
+            active[reverseOf[ridx]] = (statuses[ridx] == SAI_STATUS_SUCCESS) && attrList[ridx * 2].value.booldata;
         }
-        twiceNatIter++;
     }
-   
-    /* Send notifications for the Twice NAPT entries to set timeout */
-    TwiceNaptEntry::iterator twiceNaptIter = m_twiceNaptEntries.begin();
-    while (twiceNaptIter != m_twiceNaptEntries.end())
+
+    /* Update the active time of the entries active in the hardware
+     * and notify the ones that are aged out. */
+    idx = 0;
+    for (const auto &natIter : natQueried)
     {
-        if ((twiceNaptIter->second.addedToHw == true) and
-            (twiceNaptIter->second.entry_type != "static"))
+        if (active[idx++])
+        {
+            natIter->second.activeTime = time_now.tv_sec;
+            natIter->second.ageOutTime = time_now.tv_sec + timeout;
+        }
+        else if (time_now.tv_sec - natIter->second.activeTime >= timeout)
         {
             std::vector<FieldValueTuple> fvVector;
-            std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) +
-                               ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
-            setTimeoutNotifier->send("SET-TWICE-NAPT", key, fvVector);
+            std::string key = natIter->first.to_string();
+            setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
         }
-        twiceNaptIter++;
     }
-}
 
-bool NatOrch::getNatCounters(const NatEntry::iterator &iter)
-{
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   nat_entry = {};
-    sai_status_t      status;
-    uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
+    for (const auto &naptIter : naptQueried)
     {
-        SWSS_LOG_DEBUG("Skip get Counters for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-
-    nat_entry.vr_id       = gVirtualRouterId;
-    nat_entry.switch_id   = gSwitchId;
-
-    if (entry.nat_type == "dnat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
-        nat_entry.data.key.dst_ip = ipAddr.getV4Addr();   
-        nat_entry.data.mask.dst_ip = 0xffffffff;
-    }
-    else
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
-        nat_entry.data.key.src_ip = ipAddr.getV4Addr();
-        nat_entry.data.mask.src_ip = 0xffffffff;
+        int timeout = naptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
+        if (active[idx++])
+        {
+            naptIter->second.activeTime = time_now.tv_sec;
+            naptIter->second.ageOutTime = time_now.tv_sec + timeout;
+        }
+        else if (time_now.tv_sec - naptIter->second.activeTime >= timeout)
+        {
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
+            setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
+        }
     }
 
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
-    if (entry.nat_type == "snat")
+    for (const auto &twiceNatIter : twiceNatQueried)
     {
-        if (status != SAI_STATUS_SUCCESS)
+        if (active[idx++])
         {
-            SWSS_LOG_ERROR("Failed to get Counters for SNAT entry [src-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "", ipAddr.to_string().c_str(),
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
+            twiceNatIter->second.activeTime = time_now.tv_sec;
+            twiceNatIter->second.ageOutTime = time_now.tv_sec + timeout;
         }
-        else
+        else if (time_now.tv_sec - twiceNatIter->second.activeTime >= timeout)
         {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (twiceNatIter->first.src_ip.to_string() + ":" + twiceNatIter->first.dst_ip.to_string());
+            setTimeoutNotifier->send("AGEOUT-TWICE-NAT", key, fvVector);
         }
     }
-    else if (entry.nat_type == "dnat")
+
+    for (const auto &twiceNaptIter : twiceNaptQueried)
     {
-        if (status != SAI_STATUS_SUCCESS)
+        int timeout = twiceNaptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
+        if (active[idx++])
         {
-            SWSS_LOG_ERROR("Failed to get Counters for DNAT entry [dst-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "", ipAddr.to_string().c_str(),
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
+            twiceNaptIter->second.activeTime = time_now.tv_sec;
+            twiceNaptIter->second.ageOutTime = time_now.tv_sec + timeout;
         }
-        else
+        else if (time_now.tv_sec - twiceNaptIter->second.activeTime >= timeout)
         {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) +
+                               ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
+            setTimeoutNotifier->send("AGEOUT-TWICE-NAPT", key, fvVector);
         }
     }
 
-    /* Update the Counter values in the database */
-    updateNatCounters(ipAddr, nat_translations_pkts, nat_translations_bytes);
+    if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
+    {
+        return;
+    }
+    time_spent = getTimeDiff(time_now, time_end);
 
-    return 0;
+    SWSS_LOG_DEBUG("Time spent in querying hardware hit-bits for %zu NAT/NAPT entries = %lu secs, %lu msecs",
+                   keys.size() + reverseKeys.size(), time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
 }
 
-bool NatOrch::getTwiceNatCounters(const TwiceNatEntry::iterator &iter)
+void NatOrch::updateAllConntrackEntries(void)
 {
-    const TwiceNatEntryKey   &key = iter->first;
-    TwiceNatEntryValue       &entry  = iter->second;
-    uint32_t          attr_count;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   dbl_nat_entry = {};
-    sai_status_t      status;
-    uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
+    SWSS_LOG_ENTER();
 
-    if (entry.addedToHw == false)
+    /* Send notifications for the Single NAT entries to set timeout */
+    NatEntry::iterator natIter = m_natEntries.begin();
+    while (natIter != m_natEntries.end())
     {
-        SWSS_LOG_DEBUG("Skip get Counters for Twice NAT entry [src ip %s, dst ip %s], as not yet added to HW",
-                        key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
 
-    attr_count = 2;
+        if ((natIter->second.nat_type == "snat") and (natIter->second.addedToHw == true) and
+            (natIter->second.entry_type != "static"))
+        {
+            SWSS_LOG_ERROR("Update %s NAT entry [ip %s]", natIter->second.nat_type.c_str(), natIter->first.to_string().c_str());
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = natIter->first.to_string();
+            setTimeoutNotifier->send("SET-SINGLE-NAT", key, fvVector);
+        }
+        natIter++;
+    }
 
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
+    /* Send notifications for the Single NAPT entries to set timeout */
+    NaptEntry::iterator naptIter = m_naptEntries.begin();
+    while (naptIter != m_naptEntries.end())
+    {
+        if ((naptIter->second.nat_type == "snat") and (naptIter->second.addedToHw == true) and
+            (naptIter->second.entry_type != "static"))
+        {
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
+            setTimeoutNotifier->send("SET-SINGLE-NAPT", key, fvVector);
+        }
+        naptIter++;
+    }
 
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    /* Send notifications for the Twice NAT entries to set timeout */
+    TwiceNatEntry::iterator twiceNatIter = m_twiceNatEntries.begin();
+    while (twiceNatIter != m_twiceNatEntries.end())
     {
-        SWSS_LOG_ERROR("Failed to get Counters for Twice NAT entry [src-ip %s, dst-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
-                        key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(),
-                        nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
+        if ((twiceNatIter->second.addedToHw == true) and
+            (twiceNatIter->second.entry_type != "static"))
+        {
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (twiceNatIter->first.src_ip.to_string() + ":" + twiceNatIter->first.dst_ip.to_string());
+            setTimeoutNotifier->send("SET-TWICE-NAT", key, fvVector);
+        }
+        twiceNatIter++;
     }
-    else
+   
+    /* Send notifications for the Twice NAPT entries to set timeout */
+    TwiceNaptEntry::iterator twiceNaptIter = m_twiceNaptEntries.begin();
+    while (twiceNaptIter != m_twiceNaptEntries.end())
     {
-        nat_translations_bytes = nat_entry_attr[0].value.u64;
-        nat_translations_pkts  = nat_entry_attr[1].value.u64;
+        if ((twiceNaptIter->second.addedToHw == true) and
+            (twiceNaptIter->second.entry_type != "static"))
+        {
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) +
+                               ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
+            setTimeoutNotifier->send("SET-TWICE-NAPT", key, fvVector);
+        }
+        twiceNaptIter++;
     }
-
-    /* Update the Counter values in the database */
-    updateTwiceNatCounters(key, nat_translations_pkts, nat_translations_bytes);
-
-    return 0;
 }
 
 bool NatOrch::setNatCounters(const NatEntry::iterator &iter)
@@ -3698,150 +3968,11 @@ bool NatOrch::setNatCounters(const NatEntry::iterator &iter)
     }
     /* Update the Counter values in the database */
     updateNatCounters(ipAddr, nat_translations_pkts, nat_translations_bytes);
+    cacheNatCounters(entry, nat_translations_pkts, nat_translations_bytes);
 
     return 0;
 }
 
-bool NatOrch::getNaptCounters(const NaptEntry::iterator &iter)
-{
-    const NaptEntryKey &naptKey    = iter->first;
-    NaptEntryValue     &entry      = iter->second;
-    uint8_t            protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    nat_entry = {};
-    sai_status_t       status;
-    uint64_t           nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    nat_entry.vr_id       = gVirtualRouterId;
-    nat_entry.switch_id   = gSwitchId;
-
-    if (entry.nat_type == "dnat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
-        nat_entry.data.key.dst_ip      = naptKey.ip_address.getV4Addr();
-        nat_entry.data.key.l4_dst_port = (uint16_t)(naptKey.l4_port);
-        nat_entry.data.mask.dst_ip      = 0xffffffff;
-        nat_entry.data.mask.l4_dst_port = 0xffff;
-    }
-    else if (entry.nat_type == "snat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
-        nat_entry.data.key.src_ip      = naptKey.ip_address.getV4Addr();
-        nat_entry.data.key.l4_src_port = (uint16_t)(naptKey.l4_port);
-        nat_entry.data.mask.src_ip      = 0xffffffff;
-        nat_entry.data.mask.l4_src_port = 0xffff;
-    }
-
-    nat_entry.data.key.proto        = protoType;
-    nat_entry.data.mask.proto       = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
-
-    if (entry.nat_type == "snat")
-    { 
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to get Counters for SNAPT entry for [proto %s, src-ip %s, src-port %d], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
-                           naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port,
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-        }
-        else
-        {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
-        }
-    }
-    else if (entry.nat_type == "dnat")
-    {
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to get Counters for DNAPT entry for [proto %s, dst-ip %s, dst-port %d], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
-                           naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port,
-                           nat_entry_attr[0].value.u64, nat_entry_attr[1].value.u64);
-        }
-        else
-        {
-            nat_translations_bytes = nat_entry_attr[0].value.u64;
-            nat_translations_pkts  = nat_entry_attr[1].value.u64;
-        }
-    }
-
-    /* Update the Counter values in the database */
-    updateNaptCounters(naptKey.prototype, naptKey.ip_address, naptKey.l4_port,
-                       nat_translations_pkts, nat_translations_bytes);
-    return 0;
-}
-
-bool NatOrch::getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter)
-{
-    const TwiceNaptEntryKey &key    = iter->first;
-    TwiceNaptEntryValue     &entry      = iter->second;
-    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-    uint64_t           nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
-                       key.dst_l4_port);
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("Failed to get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
-                       key.dst_l4_port);
-    }
-    else
-    {
-        nat_translations_bytes = nat_entry_attr[0].value.u64;
-        nat_translations_pkts  = nat_entry_attr[1].value.u64;
-    }
-
-    /* Update the Counter values in the database */
-    updateTwiceNaptCounters(key, nat_translations_pkts, nat_translations_bytes);
-    return 0;
-}
-
 bool NatOrch::setNaptCounters(const NaptEntry::iterator &iter)
 {
     const NaptEntryKey &naptKey    = iter->first;
@@ -3931,6 +4062,7 @@ bool NatOrch::setNaptCounters(const NaptEntry::iterator &iter)
     /* Update the Counter values in the database */
     updateNaptCounters(naptKey.prototype, naptKey.ip_address, naptKey.l4_port,
                        nat_translations_pkts, nat_translations_bytes);
+    cacheNatCounters(entry, nat_translations_pkts, nat_translations_bytes);
     return 0;
 }
 
@@ -3982,6 +4114,7 @@ bool NatOrch::setTwiceNatCounters(const TwiceNatEntry::iterator &iter)
 
     /* Update the Counter values in the database */
     updateTwiceNatCounters(key, nat_translations_pkts, nat_translations_bytes);
+    cacheNatCounters(entry, nat_translations_pkts, nat_translations_bytes);
 
     return 0;
 }
@@ -4041,6 +4174,7 @@ bool NatOrch::setTwiceNaptCounters(const TwiceNaptEntry::iterator &iter)
 
     /* Update the Counter values in the database */
     updateTwiceNaptCounters(key, nat_translations_pkts, nat_translations_bytes);
+    cacheNatCounters(entry, nat_translations_pkts, nat_translations_bytes);
 
     return 0;
 }
@@ -4064,6 +4198,12 @@ void NatOrch::deleteNatCounters(const IpAddress &ipAddr)
     string key = ipAddr.to_string();
 
     m_countersNatTable.del(key);
+
+    auto natIter = m_natEntries.find(ipAddr);
+    if (natIter != m_natEntries.end())
+    {
+        natIter->second.countersInDb = false;
+    }
 }
 
 void NatOrch::deleteTwiceNatCounters(const TwiceNatEntryKey &key)
@@ -4071,6 +4211,12 @@ void NatOrch::deleteTwiceNatCounters(const TwiceNatEntryKey &key)
     string natKey = key.src_ip.to_string() + ":" + key.dst_ip.to_string();
 
     m_countersTwiceNatTable.del(natKey);
+
+    auto twiceNatIter = m_twiceNatEntries.find(key);
+    if (twiceNatIter != m_twiceNatEntries.end())
+    {
+        twiceNatIter->second.countersInDb = false;
+    }
 }
 
 void NatOrch::updateNaptCounters(const string &protocol, const IpAddress &ipAddr, int l4_port,
@@ -4094,6 +4240,17 @@ void NatOrch::deleteNaptCounters(const string &protocol, const IpAddress &ipAddr
     string key = (protoStr + ":" + ipStr + ":" + portStr);
 
     m_countersNaptTable.del(key);
+
+    NaptEntryKey naptKey;
+    naptKey.ip_address = ipAddr;
+    naptKey.l4_port    = l4_port;
+    naptKey.prototype  = protocol;
+
+    auto naptIter = m_naptEntries.find(naptKey);
+    if (naptIter != m_naptEntries.end())
+    {
+        naptIter->second.countersInDb = false;
+    }
 }
 
 void NatOrch::deleteTwiceNaptCounters(const TwiceNaptEntryKey &key)
@@ -4102,6 +4259,12 @@ void NatOrch::deleteTwiceNaptCounters(const TwiceNaptEntryKey &key)
                       ":" + key.dst_ip.to_string() + ":" + std::to_string(key.dst_l4_port));
 
     m_countersTwiceNaptTable.del(naptKey);
+
+    auto twiceNaptIter = m_twiceNaptEntries.find(key);
+    if (twiceNaptIter != m_twiceNaptEntries.end())
+    {
+        twiceNaptIter->second.countersInDb = false;
+    }
 }
 
 void NatOrch::updateTwiceNatCounters(const TwiceNatEntryKey &key,
@@ -4133,319 +4296,6 @@ void NatOrch::updateTwiceNaptCounters(const TwiceNaptEntryKey &key,
     m_countersTwiceNaptTable.set(naptKey, values);
 }
 
-bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now)
-{
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    IpAddress         srcIp;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   snat_entry = {};
-    sai_nat_entry_t   dnat_entry;
-    sai_status_t      status;
-
-    if (entry.nat_type == "dnat")
-    {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAT entries are always treated active */ 
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-    srcIp     = ipAddr;
-    snat_entry.data.key.src_ip   = srcIp.getV4Addr();
-    snat_entry.data.mask.src_ip  = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", srcIp.to_string().c_str(),
-                      nat_entry_attr[0].value.booldata);
-
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + timeout;
-            return 1;
-        }
-        else
-        {
-            auto dnatIter = m_natEntries.find(entry.translated_ip);
-            if (dnatIter == m_natEntries.end())
-            {
-                return 0;
-            }
-            if ((dnatIter->second).addedToHw == false)
-            {
-                return 0;
-            }
-
-            /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id             = gVirtualRouterId;
-            dnat_entry.switch_id         = gSwitchId;
-            dnat_entry.nat_type          = SAI_NAT_TYPE_DESTINATION_NAT;
-            dnat_entry.data.key.dst_ip   = entry.translated_ip.getV4Addr();
-            dnat_entry.data.mask.dst_ip  = 0xffffffff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entry.translated_ip.to_string().c_str(),
-                                nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + timeout;
-                    return 1;
-                }
-            }
-        }
-    }
-    return 0;
-}
-
-bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now)
-{
-    const NaptEntryKey &naptKey    = iter->first;
-    NaptEntryValue     &entry      = iter->second;
-    int                protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    IpAddress          srcIp;
-    uint16_t           srcPort;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    snat_entry = {};
-    sai_nat_entry_t    dnat_entry;
-    sai_status_t       status;
-
-    if (entry.nat_type == "dnat")
-    {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-
-    srcIp     = naptKey.ip_address;
-    srcPort   = (uint16_t)(naptKey.l4_port);
-    snat_entry.data.key.src_ip       = srcIp.getV4Addr();
-    snat_entry.data.key.l4_src_port  = srcPort;
-
-    snat_entry.data.mask.src_ip      = 0xffffffff;
-    snat_entry.data.mask.l4_src_port = 0xffff;
-    snat_entry.data.key.proto        = (uint8_t)protoType;
-    snat_entry.data.mask.proto       = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
-                      srcIp.to_string().c_str(), srcPort, nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
-        }
-        else
-        {
-            NaptEntryKey dnaptKey;
-            dnaptKey.ip_address = entry.translated_ip;
-            dnaptKey.l4_port    = entry.translated_l4_port;
-            dnaptKey.prototype  = naptKey.prototype;
-
-            auto dnaptIter = m_naptEntries.find(dnaptKey);
-            if (dnaptIter == m_naptEntries.end())
-            {
-                return 0;
-            }
-            if ((dnaptIter->second).addedToHw == false)
-            {
-                return 0;
-            }
-
-
-            /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id                 = gVirtualRouterId;
-            dnat_entry.switch_id             = gSwitchId;
-            dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
-
-            dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
-            dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
-
-            dnat_entry.data.mask.dst_ip      = 0xffffffff;
-            dnat_entry.data.mask.l4_dst_port = 0xffff;
-            dnat_entry.data.key.proto        = (uint8_t)protoType;
-            dnat_entry.data.mask.proto       = 0xff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", naptKey.prototype.c_str(),
-                              entry.translated_ip.to_string().c_str(), entry.translated_l4_port, nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-                    return 1;
-                }
-            }
-        }
-    }
-    return 0;
-}
-
-bool NatOrch::checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now)
-{
-    const TwiceNatEntryKey &key    = iter->first;
-    TwiceNatEntryValue     &entry  = iter->second;
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for Twice NAPT entry for [src ip %s, dst-ip %s], as not yet added to HW",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("Twice NAT HIT BIT for src-ip %s, dst-ip %s = %d",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + timeout;
-            return 1;
-        }
-    }
-    return 0;
-}
-
-bool NatOrch::checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now)
-{
-    const TwiceNaptEntryKey &key   = iter->first;
-    TwiceNaptEntryValue     &entry = iter->second;
-    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                        key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port);
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("Twice NAPT HIT BIT for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d] = %d",
-                        key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port,
-                        nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
-        }
-    }
-    return 0;
-}
-
 void NatOrch::doTask(NotificationConsumer& consumer)
 {
     SWSS_LOG_ENTER();
@@ -37,6 +37,7 @@
 #define NAT_HITBIT_N_CNTRS_QUERY_PERIOD   5        // 5 secs
 #define NAT_CONNTRACK_TIMEOUT_PERIOD      86400    // 1 day
 #define NAT_HITBIT_QUERY_MULTIPLE         6        // Hit bits are queried every 30 secs
+#define NAT_BULK_QUERY_SIZE               1024     // NAT entries queried per bulk call
 
 struct NatEntryValue
 {
@@ -46,6 +47,9 @@ struct NatEntryValue
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
     bool           addedToHw;          // Boolean to represent added to hardware
+    uint64_t       translatedPkts = 0;    // Translated packets last written to COUNTERS_DB
+    uint64_t       translatedBytes = 0;   // Translated bytes last written to COUNTERS_DB
+    bool           countersInDb = false;  // Boolean to represent counters written to COUNTERS_DB
 
     bool operator<(const NatEntryValue& other) const
     {
@@ -74,6 +78,9 @@ struct NaptEntryValue
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
     bool           addedToHw;          // Boolean to represent added to hardware
+    uint64_t       translatedPkts = 0;    // Translated packets last written to COUNTERS_DB
+    uint64_t       translatedBytes = 0;   // Translated bytes last written to COUNTERS_DB
+    bool           countersInDb = false;  // Boolean to represent counters written to COUNTERS_DB
 
     bool operator<(const NaptEntryValue& other) const
     {
@@ -100,6 +107,9 @@ struct TwiceNatEntryValue
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
     bool           addedToHw;          // Boolean to represent added to hardware
+    uint64_t       translatedPkts = 0;    // Translated packets last written to COUNTERS_DB
+    uint64_t       translatedBytes = 0;   // Translated bytes last written to COUNTERS_DB
+    bool           countersInDb = false;  // Boolean to represent counters written to COUNTERS_DB
 
     bool operator<(const TwiceNatEntryValue& other) const
     {
@@ -131,6 +141,9 @@ struct TwiceNaptEntryValue
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
     bool           addedToHw;          // Boolean to represent added to hardware
+    uint64_t       translatedPkts = 0;    // Translated packets last written to COUNTERS_DB
+    uint64_t       translatedBytes = 0;   // Translated bytes last written to COUNTERS_DB
+    bool           countersInDb = false;  // Boolean to represent counters written to COUNTERS_DB
 
     bool operator<(const TwiceNaptEntryValue& other) const
     {
@@ -241,6 +254,7 @@ private:
     int              totalDnatEntries;
     int              maxAllowedSNatEntries;
     string           admin_mode;
+    bool             m_natBulkQuerySupported;
 
     void doTask(Consumer& consumer);
     void doTask(SelectableTimer &timer);
@@ -289,11 +303,6 @@ private:
     bool addHwDnatPoolEntry(const IpAddress &dstIp);
     bool removeHwDnatPoolEntry(const IpAddress &dstIp);
 
-    bool checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now);
-    bool checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now);
-    bool checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now);
-    bool checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now);
-
     void enableNatFeature(void);
     void disableNatFeature(void);
     void addAllNatEntries(void);
@@ -304,10 +313,8 @@ private:
     void queryCounters(void);
     void queryHitBits(void);
     bool isNatEnabled(void);
-    bool getNatCounters(const NatEntry::iterator &iter);
-    bool getTwiceNatCounters(const TwiceNatEntry::iterator &iter);
-    bool getNaptCounters(const NaptEntry::iterator &iter);
-    bool getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter);
+    void getNatEntriesAttribute(const vector<sai_nat_entry_t> &keys, const vector<sai_attribute_t> &attrs,
+                                vector<sai_attribute_t> &attrList, vector<sai_status_t> &statuses);
     bool setNatCounters(const NatEntry::iterator &iter);
     bool setTwiceNatCounters(const TwiceNatEntry::iterator &iter);
     bool setNaptCounters(const NaptEntry::iterator &iter);
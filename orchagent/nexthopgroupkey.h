@@ -2,29 +2,91 @@
 #define SWSS_NEXTHOPGROUPKEY_H
 
 #include "nexthopkey.h"
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 #include <boost/functional/hash.hpp>
 
+/*
+ * Next hop sets are hash-consed: all keys holding the same next hops (weights
+ * included) share a single interned group which carries a precomputed hash and
+ * a unique id, so equality and hashing do not walk the set. The overlay/SRv6
+ * flags stay on the key and, as before, do not take part in comparisons.
+ */
 class NextHopGroupKey
 {
 public:
     NextHopGroupKey() = default;
 
+    NextHopGroupKey(const NextHopGroupKey &o) :
+        m_group(acquire(o.m_group)),
+        m_overlay_nexthops(o.m_overlay_nexthops),
+        m_srv6_nexthops(o.m_srv6_nexthops),
+        m_srv6_vpn(o.m_srv6_vpn)
+    {
+    }
+
+    NextHopGroupKey(NextHopGroupKey &&o) :
+        m_group(o.m_group),
+        m_overlay_nexthops(o.m_overlay_nexthops),
+        m_srv6_nexthops(o.m_srv6_nexthops),
+        m_srv6_vpn(o.m_srv6_vpn)
+    {
+        o.m_group = nullptr;
+    }
+
+    NextHopGroupKey &operator=(const NextHopGroupKey &o)
+    {
+        if (this != &o)
+        {
+            Group *group = acquire(o.m_group);
+            release(m_group);
+            m_group = group;
+            m_overlay_nexthops = o.m_overlay_nexthops;
+            m_srv6_nexthops = o.m_srv6_nexthops;
+            m_srv6_vpn = o.m_srv6_vpn;
+        }
+        return *this;
+    }
+
+    NextHopGroupKey &operator=(NextHopGroupKey &&o)
+    {
+        if (this != &o)
+        {
+            release(m_group);
+            m_group = o.m_group;
+            o.m_group = nullptr;
+            m_overlay_nexthops = o.m_overlay_nexthops;
+            m_srv6_nexthops = o.m_srv6_nexthops;
+            m_srv6_vpn = o.m_srv6_vpn;
+        }
+        return *this;
+    }
+
+    ~NextHopGroupKey()
+    {
+        release(m_group);
+    }
+
     /* ip_string@if_alias separated by ',' */
     NextHopGroupKey(const std::string &nexthops)
     {
         m_overlay_nexthops = false;
         m_srv6_nexthops = false;
         m_srv6_vpn = false;
+        std::set<NextHopKey> nhs;
         auto nhv = tokenize(nexthops, NHG_DELIMITER);
         for (const auto &nh : nhv)
         {
-            m_nexthops.insert(nh);
+            nhs.insert(nh);
         }
+        m_group = intern(std::move(nhs));
     }
 
     /* ip_string|if_alias|vni|router_mac separated by ',' */
     NextHopGroupKey(const std::string &nexthops, bool overlay_nh, bool srv6_nh = false)
     {
+        std::set<NextHopKey> nhs;
         if (overlay_nh)
         {
             m_overlay_nexthops = true;
@@ -34,7 +96,7 @@ public:
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs.insert(nh);
             }
         }
         else if (srv6_nh)
@@ -46,13 +108,14 @@ public:
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs.insert(nh);
                 if (nh.isSrv6Vpn())
                 {
                     m_srv6_vpn = true;
                 }
             }
         }
+        m_group = intern(std::move(nhs));
     }
 
     NextHopGroupKey(const std::string &nexthops, const std::string &weights)
@@ -60,6 +123,7 @@ public:
         m_overlay_nexthops = false;
         m_srv6_nexthops = false;
         m_srv6_vpn = false;
+        std::set<NextHopKey> nhs;
         std::vector<std::string> nhv = tokenize(nexthops, NHG_DELIMITER);
         std::vector<std::string> wtv = tokenize(weights, NHG_DELIMITER);
         bool set_weight = wtv.size() == nhv.size();
@@ -67,30 +131,44 @@ public:
         {
             NextHopKey nh(nhv[i]);
             nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
-            m_nexthops.insert(nh);
+            nhs.insert(nh);
         }
+        m_group = intern(std::move(nhs));
     }
 
     inline const std::set<NextHopKey> &getNextHops() const
     {
-        return m_nexthops;
+        return m_group ? m_group->nexthops : emptyNextHops();
     }
 
     inline size_t getSize() const
     {
-        return m_nexthops.size();
+        return getNextHops().size();
+    }
+
+    /* Unique id of the next hop set, 0 for the empty set */
+    inline uint64_t getId() const
+    {
+        return m_group ? m_group->id : 0;
     }
 
     inline bool operator<(const NextHopGroupKey &o) const
     {
-        if (m_nexthops < o.m_nexthops)
+        if (m_group == o.m_group)
+        {
+            return false;
+        }
+
+        const auto &nhs = getNextHops();
+        const auto &o_nhs = o.getNextHops();
+        if (nhs < o_nhs)
         {
             return true;
         }
-        else if (m_nexthops == o.m_nexthops)
+        else if (nhs == o_nhs)
         {
-            auto it1 = m_nexthops.begin();
-            for (auto& it2 : o.m_nexthops)
+            auto it1 = nhs.begin();
+            for (auto& it2 : o_nhs)
             {
                 if (it1->weight < it2.weight)
                 {
@@ -108,20 +186,8 @@ public:
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
-        if (m_nexthops != o.m_nexthops)
-        {
-            return false;
-        }
-        auto it1 = m_nexthops.begin();
-        for (auto& it2 : o.m_nexthops)
-        {
-            if (it2.weight != it1->weight)
-            {
-                return false;
-            }
-            it1++;
-        }
-        return true;
+        /* Equal next hop sets are interned to the same group */
+        return m_group == o.m_group;
     }
 
     inline bool operator!=(const NextHopGroupKey &o) const
@@ -131,33 +197,43 @@ public:
 
     void add(const std::string &ip, const std::string &alias)
     {
-        m_nexthops.emplace(ip, alias);
+        update([&](std::set<NextHopKey> &nhs) { nhs.emplace(ip, alias); });
     }
 
     void add(const std::string &nh)
     {
-        m_nexthops.insert(nh);
+        update([&](std::set<NextHopKey> &nhs) { nhs.insert(nh); });
     }
 
     void add(const NextHopKey &nh)
     {
-        m_nexthops.insert(nh);
+        update([&](std::set<NextHopKey> &nhs) { nhs.insert(nh); });
+    }
+
+    /* Add a batch of next hops, the updated set is interned once */
+    void add(const std::set<NextHopKey> &nhs)
+    {
+        if (nhs.empty())
+        {
+            return;
+        }
+        update([&](std::set<NextHopKey> &cur) { cur.insert(nhs.begin(), nhs.end()); });
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
     {
         NextHopKey nh(ip, alias);
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const std::string &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const NextHopKey &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const NextHopGroupKey &nhs) const
@@ -174,7 +250,7 @@ public:
 
     bool hasIntfNextHop() const
     {
-        for (const auto &nh : m_nexthops)
+        for (const auto &nh : getNextHops())
         {
             if (nh.isIntfNextHop())
             {
@@ -187,26 +263,27 @@ public:
     void remove(const std::string &ip, const std::string &alias)
     {
         NextHopKey nh(ip, alias);
-        m_nexthops.erase(nh);
+        update([&](std::set<NextHopKey> &nhs) { nhs.erase(nh); });
     }
 
     void remove(const std::string &nh)
     {
-        m_nexthops.erase(nh);
+        update([&](std::set<NextHopKey> &nhs) { nhs.erase(nh); });
     }
 
     void remove(const NextHopKey &nh)
     {
-        m_nexthops.erase(nh);
+        update([&](std::set<NextHopKey> &nhs) { nhs.erase(nh); });
     }
 
     const std::string to_string() const
     {
         string nhs_str;
+        const auto &nhs = getNextHops();
 
-        for (auto it = m_nexthops.begin(); it != m_nexthops.end(); ++it)
+        for (auto it = nhs.begin(); it != nhs.end(); ++it)
         {
-            if (it != m_nexthops.begin())
+            if (it != nhs.begin())
             {
                 nhs_str += NHG_DELIMITER;
             }
@@ -237,11 +314,142 @@ public:
 
     void clear()
     {
-        m_nexthops.clear();
+        release(m_group);
+        m_group = nullptr;
     }
 
 private:
-    std::set<NextHopKey> m_nexthops;
+    struct Group
+    {
+        std::set<NextHopKey> nexthops;
+        size_t hash;
+        uint64_t id;
+        std::atomic<size_t> refs;
+    };
+
+    struct GroupHash
+    {
+        size_t operator()(const Group *group) const
+        {
+            return group->hash;
+        }
+    };
+
+    struct GroupEqual
+    {
+        bool operator()(const Group *a, const Group *b) const
+        {
+            if (a->nexthops != b->nexthops)
+            {
+                return false;
+            }
+            auto it1 = a->nexthops.begin();
+            for (auto& it2 : b->nexthops)
+            {
+                if (it2.weight != it1->weight)
+                {
+                    return false;
+                }
+                it1++;
+            }
+            return true;
+        }
+    };
+
+    /* Intern table shared by all keys; keys may be built from the ring thread too */
+    struct GroupPool
+    {
+        std::mutex lock;
+        std::unordered_set<Group *, GroupHash, GroupEqual> groups;
+        uint64_t next_id = 1;
+    };
+
+    static GroupPool &pool()
+    {
+        /* Never destroyed so keys outliving static destruction can still release */
+        static GroupPool *p = new GroupPool();
+        return *p;
+    }
+
+    static const std::set<NextHopKey> &emptyNextHops()
+    {
+        static const std::set<NextHopKey> empty;
+        return empty;
+    }
+
+    static Group *intern(std::set<NextHopKey> &&nexthops)
+    {
+        if (nexthops.empty())
+        {
+            return nullptr;
+        }
+
+        Group *group = new Group();
+        group->nexthops = std::move(nexthops);
+        group->hash = boost::hash_range(group->nexthops.begin(), group->nexthops.end());
+        group->refs = 1;
+
+        auto &p = pool();
+        std::lock_guard<std::mutex> guard(p.lock);
+        auto it = p.groups.find(group);
+        if (it != p.groups.end())
+        {
+            delete group;
+            (*it)->refs++;
+            return *it;
+        }
+        group->id = p.next_id++;
+        p.groups.insert(group);
+        return group;
+    }
+
+    static Group *acquire(Group *group)
+    {
+        if (group)
+        {
+            group->refs++;
+        }
+        return group;
+    }
+
+    static void release(Group *group)
+    {
+        if (!group)
+        {
+            return;
+        }
+
+        /* Only drop the last reference under the pool lock, which also guards intern() lookups */
+        size_t refs = group->refs.load();
+        while (refs > 1)
+        {
+            if (group->refs.compare_exchange_weak(refs, refs - 1))
+            {
+                return;
+            }
+        }
+
+        auto &p = pool();
+        std::lock_guard<std::mutex> guard(p.lock);
+        if (--group->refs == 0)
+        {
+            p.groups.erase(group);
+            delete group;
+        }
+    }
+
+    /* Copy the next hop set, apply the change and intern the result */
+    template <typename F>
+    void update(F change)
+    {
+        std::set<NextHopKey> nhs = getNextHops();
+        change(nhs);
+        Group *group = intern(std::move(nhs));
+        release(m_group);
+        m_group = group;
+    }
+
+    Group *m_group = nullptr;
     bool m_overlay_nexthops = false;
     bool m_srv6_nexthops = false;
     bool m_srv6_vpn = false;
@@ -255,7 +463,7 @@ namespace std {
     template <>
     struct hash<NextHopGroupKey> {
         size_t operator()(const NextHopGroupKey& obj) const {
-            return boost::hash_range(obj.m_nexthops.begin(), obj.m_nexthops.end());
+            return obj.m_group ? obj.m_group->hash : 0;
         }
     };
 }
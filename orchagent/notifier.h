@@ -16,12 +16,14 @@ public:
 
     void execute() override
     {
-        auto notificationConsumer = getNotificationConsumer();
-        /* Check before triggering doTask because pop() can throw an exception if there is no data */
-        if (notificationConsumer->hasData())
-        {
-            m_orch->doTask(*notificationConsumer);
-        }
+        processLaneTask([this]() {
+            auto notificationConsumer = getNotificationConsumer();
+            /* Check before triggering doTask because pop() can throw an exception if there is no data */
+            if (notificationConsumer->hasData())
+            {
+                m_orch->doTask(*notificationConsumer);
+            }
+        });
     }
 
     void drain() override
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <inttypes.h>
 #include <stdexcept>
 #include <sys/time.h>
@@ -19,6 +20,8 @@ int gBatchSize = 0;
 
 std::shared_ptr<RingBuffer> Orch::gRingBuffer = nullptr;
 std::shared_ptr<RingBuffer> Executor::gRingBuffer = nullptr;
+std::shared_ptr<RingWorkerPool> Orch::gRingWorkerPool = nullptr;
+std::shared_ptr<RingWorkerPool> Executor::gRingWorkerPool = nullptr;
 
 RingBuffer::RingBuffer(int size): buffer(size)
 {
@@ -90,6 +93,122 @@ bool RingBuffer::serves(const std::string& tableName)
     return m_consumerSet.find(tableName) != m_consumerSet.end();  
 }
 
+RingWorkerPool::RingWorkerPool(std::shared_ptr<RingBuffer> routeRing, size_t workers, int size):
+    m_routeRing(routeRing)
+{
+    if (!routeRing)
+    {
+        throw std::invalid_argument("Route ring must be created before the worker pool");
+    }
+
+    for (size_t i = 0; i < workers; i++)
+    {
+        m_workers.push_back(std::make_shared<RingBuffer>(size));
+    }
+
+    m_lanes[APP_ROUTE_TABLE_NAME] = 0;
+}
+
+size_t RingWorkerPool::addLane(const std::vector<std::string> &executorNames)
+{
+    size_t lane = m_laneCount++;
+
+    for (const auto &name : executorNames)
+    {
+        m_lanes[name] = lane;
+    }
+
+    return lane;
+}
+
+void RingWorkerPool::addRouteLane(const std::vector<std::string> &executorNames)
+{
+    for (const auto &name : executorNames)
+    {
+        m_lanes[name] = 0;
+    }
+}
+
+void RingWorkerPool::addDependency(const std::string &executorName, const std::string &dependsOn)
+{
+    auto it = m_lanes.find(executorName);
+    auto dep = m_lanes.find(dependsOn);
+
+    /*
+     * An executor which is not in any lane runs on the main thread after all rings
+     * are drained, so the order against it is kept without merging lanes.
+     */
+    if (it == m_lanes.end() || dep == m_lanes.end() || it->second == dep->second)
+    {
+        return;
+    }
+
+    /* Merge the higher lane into the lower one so that lane 0 stays the route lane */
+    size_t from = std::max(it->second, dep->second);
+    size_t to = std::min(it->second, dep->second);
+    for (auto &lane : m_lanes)
+    {
+        if (lane.second == from)
+        {
+            lane.second = to;
+        }
+    }
+}
+
+std::shared_ptr<RingBuffer> RingWorkerPool::getRing(const std::string &executorName) const
+{
+    auto it = m_lanes.find(executorName);
+    if (it == m_lanes.end())
+    {
+        return nullptr;
+    }
+
+    if (it->second == 0)
+    {
+        return m_routeRing;
+    }
+
+    if (m_workers.empty())
+    {
+        return nullptr;
+    }
+
+    return m_workers[(it->second - 1) % m_workers.size()];
+}
+
+bool RingWorkerPool::addExecutor(Executor* executor)
+{
+    auto ring = getRing(executor->getName());
+    if (!ring)
+    {
+        return false;
+    }
+
+    ring->addExecutor(executor);
+    return true;
+}
+
+bool RingWorkerPool::IsIdle() const
+{
+    for (const auto &ring : m_workers)
+    {
+        if (!ring->IsEmpty() || !ring->IsIdle())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void RingWorkerPool::notify()
+{
+    for (const auto &ring : m_workers)
+    {
+        ring->notify();
+    }
+}
+
 Orch::Orch(DBConnector *db, const string tableName, int pri)
 {
     addConsumer(db, tableName, pri);
@@ -155,16 +274,20 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
     string op  = kfvOp(entry);
 
     /* Record incoming tasks */
-    Recorder::Instance().swss.record(dumpTuple(entry));
+    if (Recorder::Instance().swss.isRecord())
+    {
+        Recorder::Instance().swss.record(getTableName() + getConsumerTable()->getTableNameSeparator() + key,
+                                         op, kfvFieldsValues(entry));
+    }
 
     /*
-    * m_toSync is a multimap which will allow one key with multiple values,
-    * Also, the order of the key-value pairs whose keys compare equivalent
-    * is the order of insertion and does not change. (since C++11)
+    * m_toSync allows one key with multiple values, and the order of the
+    * values of one key is the order of insertion (see SyncMap).
     */
+    auto range = m_toSync.equal_range(key);
 
     /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
-    if (m_toSync.find(key) == m_toSync.end())
+    if (range.first == range.second)
     {
         m_toSync.emplace(key, entry);
     }
@@ -172,7 +295,7 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
     /* if a DEL task comes, we overwrite the old key */
     else if (op == DEL_COMMAND)
     {
-        m_toSync.erase(key);
+        m_toSync.erase(range.first, range.second);
         m_toSync.emplace(key, entry);
     }
     else
@@ -188,43 +311,36 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
         * in such case, we insert the key-value with SET.
         * If there was a SET already (I,E, the pointer still points to the same key), we combine the kfv.
         */
-        auto ret = m_toSync.equal_range(key);
-        auto iter = ret.first;
-        for (; iter != ret.second; ++iter)
+        auto iter = range.first;
+        for (; iter != range.second; ++iter)
         {
             auto old_op = kfvOp(iter->second);
             if (old_op == SET_COMMAND)
                 break;
         }
-        if (iter == ret.second)
+        if (iter == range.second)
         {
             m_toSync.emplace(key, entry);
         }
         else
         {
-            KeyOpFieldsValuesTuple existing_data = iter->second;
-
-            auto new_values = kfvFieldsValues(entry);
-            auto existing_values = kfvFieldsValues(existing_data);
-
+            /* Merge the new fields into the pending SET in place */
+            auto &existing_values = kfvFieldsValues(iter->second);
 
-            for (auto it : new_values)
+            for (const auto &it : kfvFieldsValues(entry))
             {
-                string field = fvField(it);
-                string value = fvValue(it);
+                const string &field = fvField(it);
 
                 auto iu = existing_values.begin();
                 while (iu != existing_values.end())
                 {
-                    string ofield = fvField(*iu);
-                    if (field == ofield)
+                    if (field == fvField(*iu))
                         iu = existing_values.erase(iu);
                     else
                         iu++;
                 }
-                existing_values.push_back(FieldValueTuple(field, value));
+                existing_values.push_back(it);
             }
-            iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
         }
     }
 
@@ -345,24 +461,103 @@ void Consumer::execute()
     );
 }
 
+bool Executor::isRingIdle()
+{
+    if (gRingBuffer && (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle()))
+    {
+        return false;
+    }
+
+    return !gRingWorkerPool || gRingWorkerPool->IsIdle();
+}
+
+void Executor::notifyRing()
+{
+    if (gRingBuffer)
+    {
+        gRingBuffer->notify();
+    }
+
+    if (gRingWorkerPool)
+    {
+        gRingWorkerPool->notify();
+    }
+}
+
+static std::vector<AnyTask> gPendingCompletions;
+
+void Executor::addPendingCompletion(AnyTask&& completion)
+{
+    gPendingCompletions.push_back(std::move(completion));
+}
+
+bool Executor::hasPendingCompletions()
+{
+    return !gPendingCompletions.empty();
+}
+
+void Executor::runPendingCompletions()
+{
+    if (gPendingCompletions.empty())
+    {
+        return;
+    }
+
+    // A completion may leave new work in flight, which is picked up by the next task
+    std::vector<AnyTask> completions;
+    completions.swap(gPendingCompletions);
+
+    for (auto &completion : completions)
+    {
+        completion();
+    }
+}
+
+void Executor::processLaneTask(AnyTask&& task)
+{
+    // without the worker pool, timers and notifiers run in place as they always did,
+    // the route ring only serves ROUTE_TABLE which they do not touch
+    if (!gRingWorkerPool)
+    {
+        runPendingCompletions();
+        task();
+        return;
+    }
+
+    processAnyTask(std::move(task));
+}
+
 void Executor::processAnyTask(AnyTask&& task)
 {
+    runPendingCompletions();
+
     // if either gRingBuffer isn't initialized or the ring thread isn't created
     if (!gRingBuffer || !gRingBuffer->thread_created) 
     {
         // execute the input task immediately
         task();
+        return;
     }
 
     // Ring Buffer Logic
 
-    // if this executor isn't served by ring buffer
-    else if (!gRingBuffer->serves(getName()))
+    std::shared_ptr<RingBuffer> ring = nullptr;
+    if (gRingWorkerPool)
+    {
+        ring = gRingWorkerPool->getRing(getName());
+    }
+    else if (gRingBuffer->serves(getName()))
+    {
+        ring = gRingBuffer;
+    }
+
+    // if this executor isn't served by any ring
+    if (!ring || !ring->thread_created)
     {
         // this executor should execute the input task in the main thread
-        // but to avoid thread issue, it should wait when the ring buffer is actively working
-        while (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle()) {
-            gRingBuffer->notify();
+        // but to avoid thread issue, it should wait when the rings are actively working
+        while (!isRingIdle()) {
+            notifyRing();
             std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
         }
         // execute task()
@@ -370,14 +565,14 @@ void Executor::processAnyTask(AnyTask&& task)
     }
     else
     {
-        // if this executor is served by ring buffer, 
-        // push the task to gRingBuffer
+        // if this executor is served by a ring,
+        // push the task to that ring
         // this task would be executed in the ring thread, not here
-        while (!gRingBuffer->push(task)) {
-            gRingBuffer->notify();
+        while (!ring->push(task)) {
+            ring->notify();
             SWSS_LOG_WARN("ring is full...push again");
         }
-        gRingBuffer->notify();
+        ring->notify();
     }
 }
 
@@ -435,29 +630,17 @@ bool Orch::bake()
 }
 
 /*
-- Validates reference has proper format which is object_name
-- validates table_name exists
-- validates object with object_name exists
-
-- Special case:
-- Deem reference format [] as valid, and return true. But in such a case,
-- both type_name and object_name are cleared to empty strings as an
-- indication to the caller of the special case
-*/
-bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &type_name, string &object_name)
+ * Find the object of reference ref_in in the type_name table. An empty
+ * reference is valid and gives a null object.
+ */
+static bool findReference(type_map &type_maps, const string &ref_in, const string &type_name, referenced_object *&object)
 {
-    SWSS_LOG_ENTER();
-
-    SWSS_LOG_DEBUG("input:%s", ref_in.c_str());
+    object = nullptr;
 
     if (ref_in.size() == 0)
     {
         // value set by user is ""
         // Deem it as a valid format
-        // clear both type_name and object_name
-        // as an indication to the caller that
-        // such a case has been encountered
-        object_name.clear();
         return true;
     }
 
@@ -472,9 +655,8 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         SWSS_LOG_ERROR("not recognized type:%s\n", type_name.c_str());
         return false;
     }
-    auto obj_map = type_maps[type_name];
-    auto obj_it = obj_map->find(ref_in);
-    if (obj_it == obj_map->end())
+    auto obj_it = type_it->second->find(ref_in);
+    if (obj_it == type_it->second->end())
     {
         SWSS_LOG_INFO("map:%s does not contain object with name:%s\n", type_name.c_str(), ref_in.c_str());
         return false;
@@ -484,7 +666,74 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         SWSS_LOG_NOTICE("map:%s contains a pending removed object %s, skip\n", type_name.c_str(), ref_in.c_str());
         return false;
     }
-    object_name = ref_in;
+    object = &obj_it->second;
+    return true;
+}
+
+/*
+ * Resolve the objects of a reference string, e.g. "BUFFER_PROFILE_TABLE:p0,BUFFER_PROFILE_TABLE:p1",
+ * to their tables once, so that they are not parsed again while the reference holds
+ */
+static vector<object_reference> resolveReferencedObjects(type_map &type_maps, const string &referenced_objs)
+{
+    vector<object_reference> refs;
+
+    size_t start = 0;
+    while (start < referenced_objs.size())
+    {
+        size_t end = referenced_objs.find(list_item_delimiter, start);
+        if (end == string::npos)
+        {
+            end = referenced_objs.size();
+        }
+
+        size_t table_end = referenced_objs.find(delimiter, start);
+        if (table_end < end)
+        {
+            size_t name_end = min(referenced_objs.find(delimiter, table_end + 1), end);
+
+            object_reference ref;
+            ref.table = referenced_objs.substr(start, table_end - start);
+            ref.name = referenced_objs.substr(table_end + 1, name_end - table_end - 1);
+
+            auto &objects = type_maps[ref.table];
+            if (!objects)
+            {
+                objects = make_shared<object_reference_map>();
+            }
+            ref.objects = objects.get();
+            refs.push_back(move(ref));
+        }
+
+        start = end + 1;
+    }
+
+    return refs;
+}
+
+/*
+- Validates reference has proper format which is object_name
+- validates table_name exists
+- validates object with object_name exists
+
+- Special case:
+- Deem reference format [] as valid, and return true. But in such a case,
+- both type_name and object_name are cleared to empty strings as an
+- indication to the caller of the special case
+*/
+bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &type_name, string &object_name)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_DEBUG("input:%s", ref_in.c_str());
+
+    referenced_object *object;
+    if (!findReference(type_maps, ref_in, type_name, object))
+    {
+        return false;
+    }
+
+    object_name = object ? ref_in : "";
     SWSS_LOG_DEBUG("parsed: type_name:%s, object_name:%s", type_name.c_str(), object_name.c_str());
     return true;
 }
@@ -510,17 +759,20 @@ ref_resolve_status Orch::resolveFieldRefValue(
                 SWSS_LOG_ERROR("Multiple same fields %s", field_name.c_str());
                 return ref_resolve_status::multiple_instances;
             }
-            string object_name;
-            if (!parseReference(type_maps, fvValue(*i), ref_type_name, object_name))
+            referenced_object *object;
+            if (!findReference(type_maps, fvValue(*i), ref_type_name, object))
             {
                 return ref_resolve_status::not_resolved;
             }
-            else if (object_name.empty())
+            else if (!object)
             {
                 return ref_resolve_status::empty;
             }
-            sai_object = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
-            referenced_object_name = ref_type_name + delimiter + object_name;
+            sai_object = object->m_saiObjectId;
+            referenced_object_name.reserve(ref_type_name.size() + 1 + fvValue(*i).size());
+            referenced_object_name = ref_type_name;
+            referenced_object_name += delimiter;
+            referenced_object_name += fvValue(*i);
             hit = true;
         }
     }
@@ -540,25 +792,44 @@ void Orch::removeMeFromObjsReferencedByMe(
     const string &old_referenced_obj_name,
     bool remove_field)
 {
-    vector<string> objects = tokenize(old_referenced_obj_name, list_item_delimiter);
-    for (auto &obj : objects)
+    auto &objects = *type_maps[table];
+    auto referencing = objects.find(obj_name);
+
+    // Use the objects resolved when the reference was set unless the caller names others
+    vector<object_reference> resolved;
+    const vector<object_reference> *refs = nullptr;
+    if (referencing != objects.end())
+    {
+        auto cached = referencing->second.m_refsByMe.find(field);
+        auto field_ref = referencing->second.m_objsReferencingByMe.find(field);
+        if (cached != referencing->second.m_refsByMe.end() &&
+            field_ref != referencing->second.m_objsReferencingByMe.end() &&
+            field_ref->second == old_referenced_obj_name)
+        {
+            refs = &cached->second;
+        }
+    }
+    if (!refs)
+    {
+        resolved = resolveReferencedObjects(type_maps, old_referenced_obj_name);
+        refs = &resolved;
+    }
+
+    for (auto &ref : *refs)
     {
-        // obj_name references token
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &ref_obj_name = tokens[1];
-        auto &old_referenced_obj = (*type_maps[referenced_table])[ref_obj_name];
+        auto &old_referenced_obj = (*ref.objects)[ref.name];
         old_referenced_obj.m_objsDependingOnMe.erase(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %s)",
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
-                      referenced_table.c_str(), ref_obj_name.c_str(),
-                      to_string(old_referenced_obj.m_objsDependingOnMe.size()).c_str());
+                      ref.table.c_str(), ref.name.c_str(),
+                      old_referenced_obj.m_objsDependingOnMe.size());
     }
 
     if (remove_field)
     {
-        auto &referencing_object = (*type_maps[table])[obj_name];
+        auto &referencing_object = objects[obj_name];
         referencing_object.m_objsReferencingByMe.erase(field);
+        referencing_object.m_refsByMe.erase(field);
     }
 }
 
@@ -571,25 +842,35 @@ void Orch::setObjectReference(
 {
     auto &obj = (*type_maps[table])[obj_name];
     auto field_ref = obj.m_objsReferencingByMe.find(field);
+    auto cached = obj.m_refsByMe.find(field);
+
+    // The same reference set again, only make sure the objects referenced still know
+    if (field_ref != obj.m_objsReferencingByMe.end() && field_ref->second == referenced_obj &&
+        cached != obj.m_refsByMe.end())
+    {
+        for (auto &ref : cached->second)
+        {
+            (*ref.objects)[ref.name].m_objsDependingOnMe.insert(obj_name);
+        }
+        return;
+    }
 
     if (field_ref != obj.m_objsReferencingByMe.end())
         removeMeFromObjsReferencedByMe(type_maps, table, obj_name, field, field_ref->second, false);
 
     obj.m_objsReferencingByMe[field] = referenced_obj;
+    auto &refs = obj.m_refsByMe[field];
+    refs = resolveReferencedObjects(type_maps, referenced_obj);
 
     // Add the reference to the new object being referenced
-    vector<string> objs = tokenize(referenced_obj, list_item_delimiter);
-    for (auto &obj : objs)
+    for (auto &ref : refs)
     {
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &referenced_obj_name = tokens[1];
-        auto &new_obj_being_referenced = (*type_maps[referenced_table])[referenced_obj_name];
+        auto &new_obj_being_referenced = (*ref.objects)[ref.name];
         new_obj_being_referenced.m_objsDependingOnMe.insert(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %s)",
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
-                      referenced_table.c_str(), referenced_obj_name.c_str(),
-                      to_string(new_obj_being_referenced.m_objsDependingOnMe.size()).c_str());
+                      ref.table.c_str(), ref.name.c_str(),
+                      new_obj_being_referenced.m_objsDependingOnMe.size());
     }
 }
 
@@ -600,8 +881,9 @@ bool Orch::doesObjectExist(
     const string &field,
     string &referenced_obj)
 {
-    auto &&searchRef = (*type_maps[table]).find(obj_name);
-    if (searchRef != (*type_maps[table]).end())
+    auto &objects = *type_maps[table];
+    auto searchRef = objects.find(obj_name);
+    if (searchRef != objects.end())
     {
         auto &obj = searchRef->second;
         auto &&searchReferencingObjectRef = obj.m_objsReferencingByMe.find(field);
@@ -620,21 +902,22 @@ void Orch::removeObject(
     const string &table,
     const string &obj_name)
 {
-    auto &&searchRef = (*type_maps[table]).find(obj_name);
-    if (searchRef == (*type_maps[table]).end())
+    auto &objects = *type_maps[table];
+    auto searchRef = objects.find(obj_name);
+    if (searchRef == objects.end())
     {
         return;
     }
 
     auto &obj = searchRef->second;
 
-    for (auto field_ref : obj.m_objsReferencingByMe)
+    for (auto &field_ref : obj.m_objsReferencingByMe)
     {
         removeMeFromObjsReferencedByMe(type_maps, table, obj_name, field_ref.first, field_ref.second, false);
     }
 
     // Update the field store
-    (*type_maps[table]).erase(obj_name);
+    objects.erase(searchRef);
     SWSS_LOG_INFO("Obj %s:%s is removed from store", table.c_str(), obj_name.c_str());
 }
 
@@ -723,12 +1006,14 @@ ref_resolve_status Orch::resolveFieldRefArray(
             }
             for (size_t ind = 0; ind < list_items.size(); ind++)
             {
-                if (!parseReference(type_maps, list_items[ind], ref_type_name, object_name))
+                referenced_object *object;
+                if (!findReference(type_maps, list_items[ind], ref_type_name, object))
                 {
                     SWSS_LOG_NOTICE("Failed to parse profile reference:%s\n", list_items[ind].c_str());
                     return ref_resolve_status::not_resolved;
                 }
-                sai_object_id_t sai_obj = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+                object_name = object ? list_items[ind] : "";
+                sai_object_id_t sai_obj = object ? object->m_saiObjectId : (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
                 SWSS_LOG_DEBUG("Resolved to sai_object:0x%" PRIx64 ", type:%s, name:%s", sai_obj, ref_type_name.c_str(), object_name.c_str());
                 sai_object_arr.push_back(sai_obj);
                 if (!object_name_list.empty())
@@ -932,7 +1217,10 @@ void Orch::addExecutor(Executor* executor)
         SWSS_LOG_THROW("Duplicated executorName in m_consumerMap: %s", executor->getName().c_str());
     }
 
-    if (gRingBuffer && executor->getName() == APP_ROUTE_TABLE_NAME) {
+    if (gRingWorkerPool) {
+        gRingWorkerPool->addExecutor(executor);
+    }
+    else if (gRingBuffer && executor->getName() == APP_ROUTE_TABLE_NAME) {
         gRingBuffer->addExecutor(executor);
     }
 }
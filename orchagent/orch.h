@@ -26,6 +26,7 @@ extern "C" {
 #include "response_publisher.h"
 #include "recorder.h"
 #include "schema.h"
+#include "syncmap.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -66,7 +67,18 @@ typedef enum
     task_duplicated
 } task_process_status;
 
-typedef struct
+struct referenced_object;
+typedef std::map<std::string, referenced_object> object_reference_map;
+
+// One object referenced by a field, resolved when the reference is set
+struct object_reference
+{
+    object_reference_map *objects;
+    std::string table;
+    std::string name;
+};
+
+struct referenced_object
 {
     // m_objsDependingOnMe stores names (without table name) of all objects depending on the current obj
     std::set<std::string> m_objsDependingOnMe;
@@ -74,20 +86,18 @@ typedef struct
     // the object names are with table name
     // multiple objects being referenced are separated by ','
     std::map<std::string, std::string> m_objsReferencingByMe;
+    // m_refsByMe holds the objects of m_objsReferencingByMe already resolved, so that updating
+    // a reference neither parses the names nor looks up the tables again
+    std::map<std::string, std::vector<object_reference>> m_refsByMe;
     sai_object_id_t m_saiObjectId;
     bool m_pendingRemove;
-} referenced_object;
+};
 
-typedef std::map<std::string, referenced_object> object_reference_map;
 typedef std::map<std::string, std::shared_ptr<object_reference_map>> type_map;
 
 typedef std::map<std::string, sai_object_id_t> object_map;
 typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 
-// Use multimap to support multiple OpFieldsValues for the same key (e,g, DEL and SET)
-// The order of the key-value pairs whose keys compare equivalent is the order of
-// insertion and does not change. (since C++11)
-typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> SyncMap;
 
 typedef std::pair<std::string, int> table_name_with_pri_t;
 
@@ -96,6 +106,7 @@ class Orch;
 using AnyTask = std::function<void()>; // represents a function with no argument and returns void
 
 class RingBuffer;
+class RingWorkerPool;
 
 // Design assumption
 // 1. one Orch can have one or more Executor
@@ -135,7 +146,23 @@ public:
 
     Orch *getOrch() const { return m_orch; }
     static std::shared_ptr<RingBuffer> gRingBuffer;
+    static std::shared_ptr<RingWorkerPool> gRingWorkerPool;
     void processAnyTask(AnyTask&& func);
+    // run a timer or notifier task: in place, or through processAnyTask when the worker pool is enabled
+    void processLaneTask(AnyTask&& func);
+
+    // true if no ring (route ring or worker ring) holds or runs a task
+    static bool isRingIdle();
+    // wake up every ring thread which has pending tasks
+    static void notifyRing();
+
+    // Work an Orch left in flight, e.g. the post processing of an asynchronous bulk flush.
+    // Pending completions run in order before the next executed task, which is popped
+    // first, so no task observes the Orch state half updated. The main loop skips its
+    // retry sweep while one is pending. Only used without the ring threads.
+    static void addPendingCompletion(AnyTask&& completion);
+    static void runPendingCompletions();
+    static bool hasPendingCompletions();
 
 protected:
     swss::Selectable *m_selectable;
@@ -218,6 +245,50 @@ public:
     void setIdle(bool idle);
 };
 
+/*
+ * RingWorkerPool spreads executors over several rings, each drained by its own thread.
+ *
+ * Executors are grouped into lanes. All executors in one lane are served by the same
+ * ring, so their tasks keep the order in which they were selected. Lane 0 is the route
+ * lane and is always served by the route ring (gRingBuffer); the other lanes are spread
+ * over the worker rings and may be processed concurrently with each other.
+ *
+ * A declared dependency merges the lanes of two executors, so an executor which shares
+ * state with another lane does not run concurrently with it. Executors added with
+ * addRouteLane() run on the route ring thread, off the main thread but not in parallel
+ * with routes.
+ * Executors which are not in any lane stay on the main thread, and the main thread
+ * drains all rings before running them, so their order against the lanes is preserved.
+ */
+class RingWorkerPool
+{
+public:
+    RingWorkerPool(std::shared_ptr<RingBuffer> routeRing, size_t workers, int size=RING_SIZE);
+
+    // Add a new lane for the executors; returns the lane id
+    size_t addLane(const std::vector<std::string> &executorNames);
+    // Serve the executors on the route ring, serialized with the route lane
+    void addRouteLane(const std::vector<std::string> &executorNames);
+    // Keep executorName in the same lane as dependsOn
+    void addDependency(const std::string &executorName, const std::string &dependsOn);
+
+    // Register the executor with the ring serving its lane
+    bool addExecutor(Executor* executor);
+    std::shared_ptr<RingBuffer> getRing(const std::string &executorName) const;
+
+    // Worker rings, the route ring is not included
+    const std::vector<std::shared_ptr<RingBuffer>> &getWorkers() const { return m_workers; }
+
+    bool IsIdle() const;
+    void notify();
+
+private:
+    std::shared_ptr<RingBuffer> m_routeRing;
+    std::vector<std::shared_ptr<RingBuffer>> m_workers;
+    std::map<std::string, size_t> m_lanes;
+    size_t m_laneCount = 1;
+};
+
 class Consumer : public ConsumerBase {
 public:
     Consumer(swss::ConsumerTableBase *select, Orch *orch, const std::string &name)
@@ -276,6 +347,7 @@ public:
     virtual ~Orch() = default;
 
     static std::shared_ptr<RingBuffer> gRingBuffer;
+    static std::shared_ptr<RingWorkerPool> gRingWorkerPool;
 
     std::vector<swss::Selectable*> getSelectables();
 
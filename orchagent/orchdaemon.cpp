@@ -13,6 +13,7 @@
 #include "sairedis.h"
 #include "chassisorch.h"
 #include "stporch.h"
+#include "bulksizer.h"
 
 using namespace std;
 using namespace swss;
@@ -23,6 +24,8 @@ using namespace swss;
 
 #define APP_FABRIC_MONITOR_PORT_TABLE_NAME      "FABRIC_PORT_TABLE"
 #define APP_FABRIC_MONITOR_DATA_TABLE_NAME      "FABRIC_MONITOR_TABLE"
+#define STATE_BULK_STATS_TABLE_NAME             "BULK_STATS_TABLE"
+#define STATE_RESPONSE_PUBLISHER_STATS_TABLE_NAME "RESPONSE_PUBLISHER_STATS_TABLE"
 
 extern sai_switch_api_t*           sai_switch_api;
 extern sai_object_id_t             gSwitchId;
@@ -74,6 +77,43 @@ event_handle_t g_events_handle;
 
 #define DEFAULT_MAX_BULK_SIZE 1000
 size_t gMaxBulkSize = DEFAULT_MAX_BULK_SIZE;
+/* Flush route bulks asynchronously, overlapping the SAI round trip with popping the next batch */
+bool gAsyncRouteBulk = false;
+/* Compute the counter rates in CounterRatesOrch rather than in the rate plugins */
+bool gNativeCounterRates = false;
+
+/*
+ * Lanes served by the worker rings of the ring worker pool. Executors in one lane keep
+ * their relative order, different lanes may run concurrently. FdbOrch is not listed as
+ * it updates Port objects which every other Orch reads.
+ */
+static const vector<vector<string>> ringWorkerLanes = {
+    {
+        CFG_CRM_TABLE_NAME,
+        "CRM_COUNTERS_POLL"
+    },
+    {
+        CFG_WATERMARK_TABLE_NAME,
+        "WM_TELEMETRY_TIMER"
+    }
+};
+
+/*
+ * Executors served by the route ring. ACL redirect rules take next hop and next hop group
+ * references owned by RouteOrch/NeighOrch, so ACL cannot run in parallel with routes: it
+ * is moved off the main thread but stays serialized with the route lane.
+ */
+static const vector<string> ringRouteLane = {
+    CFG_ACL_TABLE_TYPE_TABLE_NAME,
+    CFG_ACL_TABLE_TABLE_NAME,
+    CFG_ACL_RULE_TABLE_NAME
+};
+
+/*
+ * Ordering dependencies between worker lanes: the first executor is kept in the lane of
+ * the second.
+ */
+static const vector<pair<string, string>> ringWorkerDependencies = {};
 
 OrchDaemon::OrchDaemon(DBConnector *applDb, DBConnector *configDb, DBConnector *stateDb, DBConnector *chassisAppDb, ZmqServer *zmqServer) :
         m_applDb(applDb),
@@ -91,7 +131,23 @@ OrchDaemon::~OrchDaemon()
 {
     SWSS_LOG_ENTER();
 
-    // Stop the ring thread before delete orch pointers
+    // Stop the worker threads and the ring thread before delete orch pointers
+    if (gRingWorkerPool) {
+        for (auto &ring : gRingWorkerPool->getWorkers())
+        {
+            ring->thread_exited = true;
+            ring->notify();
+        }
+        for (auto &worker : worker_threads)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+        worker_threads.clear();
+    }
+
     if (ring_thread.joinable()) {
         // notify the ring_thread to exit
         gRingBuffer->thread_exited = true;
@@ -123,25 +179,32 @@ void OrchDaemon::popRingBuffer()
 {
     SWSS_LOG_ENTER();
 
-    // make sure there is only one thread created to run popRingBuffer()
-    if (!gRingBuffer || gRingBuffer->thread_created)
+    popRingWorker(gRingBuffer);
+}
+
+void OrchDaemon::popRingWorker(std::shared_ptr<RingBuffer> ring)
+{
+    SWSS_LOG_ENTER();
+
+    // make sure there is only one thread created to pop each ring
+    if (!ring || ring->thread_created)
         return;
 
-    gRingBuffer->thread_created = true;
-    SWSS_LOG_NOTICE("OrchDaemon starts the popRingBuffer thread!");
+    ring->thread_created = true;
+    SWSS_LOG_NOTICE("OrchDaemon starts the ring thread for %p!", (void *)ring.get());
 
-    while (!gRingBuffer->thread_exited)
+    while (!ring->thread_exited)
     {
-        gRingBuffer->pauseThread();
+        ring->pauseThread();
 
-        gRingBuffer->setIdle(false);
+        ring->setIdle(false);
 
         AnyTask func;
-        while (gRingBuffer->pop(func)) {
+        while (ring->pop(func)) {
             func();
         }
 
-        gRingBuffer->setIdle(true);
+        ring->setIdle(true);
     }
 }
 
@@ -159,6 +222,32 @@ void OrchDaemon::disableRingBuffer() {
     gRingBuffer = nullptr;
     Executor::gRingBuffer = nullptr;
     Orch::gRingBuffer = nullptr;
+    gRingWorkerPool = nullptr;
+    Executor::gRingWorkerPool = nullptr;
+    Orch::gRingWorkerPool = nullptr;
+}
+
+void OrchDaemon::enableRingWorkerPool(size_t workers) {
+    if (!gRingBuffer)
+    {
+        SWSS_LOG_ERROR("Ring buffer must be enabled before the ring worker pool");
+        return;
+    }
+
+    gRingWorkerPool = std::make_shared<RingWorkerPool>(gRingBuffer, workers);
+    gRingWorkerPool->addRouteLane(ringRouteLane);
+    for (const auto &lane : ringWorkerLanes)
+    {
+        gRingWorkerPool->addLane(lane);
+    }
+    for (const auto &dep : ringWorkerDependencies)
+    {
+        gRingWorkerPool->addDependency(dep.first, dep.second);
+    }
+
+    Executor::gRingWorkerPool = gRingWorkerPool;
+    Orch::gRingWorkerPool = gRingWorkerPool;
+    SWSS_LOG_NOTICE("RingWorkerPool created with %zu workers!", workers);
 }
 
 bool OrchDaemon::init()
@@ -825,6 +914,11 @@ bool OrchDaemon::init()
     TwampOrch *twamp_orch = new TwampOrch(confDbTwampTable, stateDbTwampTable, gSwitchOrch, gPortsOrch, vrf_orch);
     m_orchList.push_back(twamp_orch);
 
+    if (gNativeCounterRates)
+    {
+        m_orchList.push_back(new CounterRatesOrch());
+    }
+
     if (HFTelOrch::isSupportedHFTel(gSwitchId))
     {
         const vector<string> stel_tables = {
@@ -873,9 +967,9 @@ void OrchDaemon::flush()
      * Flush would be triggered later after SELECT_TIMEOUT in main thread again
      * for avoiding race condition.
      */
-    if (gRingBuffer &&(!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle()))
+    if (!Executor::isRingIdle())
     {
-        gRingBuffer->notify();
+        Executor::notifyRing();
         SWSS_LOG_WARN("Skip Flush waiting for RingBuffer empty");
     }
     else
@@ -909,6 +1003,14 @@ void OrchDaemon::start(long heartBeatInterval)
 
     ring_thread = std::thread(&OrchDaemon::popRingBuffer, this);
 
+    if (gRingWorkerPool)
+    {
+        for (auto &ring : gRingWorkerPool->getWorkers())
+        {
+            worker_threads.emplace_back(&OrchDaemon::popRingWorker, this, ring);
+        }
+    }
+
     for (Orch *o : m_orchList)
     {
         m_select->addSelectables(o->getSelectables());
@@ -933,6 +1035,8 @@ void OrchDaemon::start(long heartBeatInterval)
             tstart = std::chrono::high_resolution_clock::now();
 
             flush();
+            exportBulkStats();
+            exportResponsePublisherStats();
         }
 
         if (ret == Select::ERROR)
@@ -948,13 +1052,14 @@ void OrchDaemon::start(long heartBeatInterval)
              * accumulated. Still it is possible that small amount of
              * requests live in it. When the daemon has nothing to do, it
              * is a good chance to flush the pipeline  */
+            Executor::runPendingCompletions();
             flush();
 
             if (gRingBuffer)
             {
-                if (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle())
+                if (!Executor::isRingIdle())
                 {
-                    gRingBuffer->notify();
+                    Executor::notifyRing();
                 }
                 else
                 {
@@ -978,9 +1083,12 @@ void OrchDaemon::start(long heartBeatInterval)
         c->execute();
 
         /* After each iteration, periodically check all m_toSync map to
-         * execute all the remaining tasks that need to be retried. */
+         * execute all the remaining tasks that need to be retried.
+         * A pending completion means a bulk is still in flight, the retries
+         * wait for the next iteration so the main loop can pop the next
+         * batch meanwhile instead of joining the bulk here. */
 
-        if (!gRingBuffer || (gRingBuffer->IsEmpty() && gRingBuffer->IsIdle()))
+        if (Executor::isRingIdle() && !Executor::hasPendingCompletions())
         {
             for (Orch *o : m_orchList)
                 o->doTask();
@@ -999,9 +1107,9 @@ void OrchDaemon::start(long heartBeatInterval)
                 // but should finish data that already in the ring
                 if (gRingBuffer)
                 {
-                    while (!gRingBuffer->IsEmpty() || !gRingBuffer->IsIdle())
+                    while (!Executor::isRingIdle())
                     {
-                        gRingBuffer->notify();
+                        Executor::notifyRing();
                         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MSECONDS));
                     }
                 }
@@ -1194,6 +1302,68 @@ void OrchDaemon::addOrchList(Orch *o)
     m_orchList.push_back(o);
 }
 
+void OrchDaemon::exportBulkStats()
+{
+    if (!m_stateDb)
+    {
+        return;
+    }
+
+    if (!m_bulkStatsTable)
+    {
+        m_bulkStatsTable = std::make_unique<Table>(m_stateDb, STATE_BULK_STATS_TABLE_NAME);
+    }
+
+    BulkSizer::forEachUpdated([this](sai_object_type_t objectType, const BulkSizer::Stats &stats) {
+        vector<FieldValueTuple> fvs = {
+            { "bulk_size", to_string(stats.bulkSize) },
+            { "min_bulk_size", to_string(stats.minBulkSize) },
+            { "max_bulk_size", to_string(stats.maxBulkSize) },
+            { "calls", to_string(stats.calls) },
+            { "entries", to_string(stats.entries) },
+            { "failed_entries", to_string(stats.failedEntries) },
+            { "avg_latency_us", to_string(stats.calls ? stats.latencySumUs / stats.calls : 0) },
+            { "max_latency_us", to_string(stats.maxLatencyUs) },
+            { "shrinks", to_string(stats.shrinks) },
+            { "grows", to_string(stats.grows) },
+        };
+        m_bulkStatsTable->set(sai_serialize_object_type(objectType), fvs);
+    });
+}
+
+void OrchDaemon::exportResponsePublisherStats()
+{
+    if (!m_stateDb)
+    {
+        return;
+    }
+
+    if (!m_responsePublisherStatsTable)
+    {
+        m_responsePublisherStatsTable = std::make_unique<Table>(m_stateDb, STATE_RESPONSE_PUBLISHER_STATS_TABLE_NAME);
+    }
+
+    for (const auto &it : ResponsePublisher::getTotalStats())
+    {
+        const auto &stats = it.second;
+        auto &queued = m_responsePublisherQueued[it.first];
+        if (stats.queued == queued && !stats.depth)
+        {
+            continue;
+        }
+        queued = stats.queued;
+
+        vector<FieldValueTuple> fvs = {
+            { "queued", to_string(stats.queued) },
+            { "written", to_string(stats.written) },
+            { "depth", to_string(stats.depth) },
+            { "avg_latency_us", to_string(stats.written ? stats.totalLatencyUs / stats.written : 0) },
+            { "max_latency_us", to_string(stats.maxLatencyUs) },
+        };
+        m_responsePublisherStatsTable->set(it.first, fvs);
+    }
+}
+
 void OrchDaemon::heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent, long interval)
 {
     if (interval == 0)
@@ -48,6 +48,7 @@
 #include "srv6orch.h"
 #include "nvgreorch.h"
 #include "twamporch.h"
+#include "counterratesorch.h"
 #include "stporch.h"
 #include "dash/dashenifwdorch.h"
 #include "dash/dashaclorch.h"
@@ -105,9 +106,18 @@ public:
      */
     void popRingBuffer();
 
+    /**
+     * Serve the lanes in ringWorkerLanes with a pool of worker rings on top of the route ring.
+     * Must be called after enableRingBuffer() and before the Orchs are created.
+     */
+    void enableRingWorkerPool(size_t workers);
+    void popRingWorker(std::shared_ptr<RingBuffer> ring);
+
     std::shared_ptr<RingBuffer> gRingBuffer = nullptr;
+    std::shared_ptr<RingWorkerPool> gRingWorkerPool = nullptr;
 
     std::thread ring_thread;
+    std::vector<std::thread> worker_threads;
 
 protected:
     DBConnector *m_applDb;
@@ -126,6 +136,18 @@ protected:
 
     void flush();
 
+    std::unique_ptr<Table> m_bulkStatsTable;
+
+    // Export the counters of the bulk sizers to STATE_DB BULK_STATS_TABLE
+    void exportBulkStats();
+
+    std::unique_ptr<Table> m_responsePublisherStatsTable;
+    // Writes of each DB at the last export
+    std::map<std::string, uint64_t> m_responsePublisherQueued;
+
+    // Export the DB write counters of the response publishers to STATE_DB RESPONSE_PUBLISHER_STATS_TABLE
+    void exportResponsePublisherStats();
+
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent, long interval);
 
     void freezeAndHeartBeat(unsigned int duration, long interval);
@@ -265,52 +265,29 @@ ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry
                    << "extension entry for invalid table " << app_db_entry.table_name.c_str();
         }
 
-        nlohmann::json j = nlohmann::json::parse(app_db_entry.table_key);
-        for (auto it = j.begin(); it != j.end(); ++it)
+        P4KeyDecoder::Fields fields;
+        auto status = table->key_decoder->decode(app_db_entry.table_key, &fields);
+        if (!status.ok())
         {
-            std::string match, value, prefix;
-            std::size_t pos;
-
-            match = it.key();
-            value = it.value();
-
-            prefix = p4orch::kMatchPrefix;
-            pos = match.rfind(prefix);
-            if (pos != std::string::npos)
-            {
-                match.erase(0, prefix.length());
-            }
-            else
-            {
-                SWSS_LOG_ERROR("Failed to encode match fields for sai call");
-                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to encode match fields for sai call";
-            }
+            SWSS_LOG_ERROR("Failed to encode match fields for sai call: %s", status.message().c_str());
+            return status;
+        }
 
-            prefix = p4orch::kFieldDelimiter;
-            pos = match.rfind(prefix);
-            if (pos != std::string::npos)
-            {
-                match.erase(0, prefix.length());
-            }
-            else
+        const auto &match_fields = table->key_decoder->getMatchFields();
+        for (size_t i = 0; i < match_fields.size(); i++)
+        {
+            if (!fields.present[i])
             {
-                SWSS_LOG_ERROR("Failed to encode match fields for sai call");
-                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to encode match fields for sai call";
+                continue;
             }
-
+            const auto &match = match_fields[i];
             auto match_defn_it = table->match_fields.find(match);
-            if (match_defn_it == table->match_fields.end())
-            {
-                SWSS_LOG_ERROR("extension entry for invalid match field %s", match.c_str());
-                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                       << "extension entry for invalid match field " << match.c_str();
-            }
 
             sai_metadata_j = nlohmann::json::object({});
             sai_metadata_j["sai_attr_value_type"] = match_defn_it->second.datatype;
 
             sai_j = nlohmann::json::object({});
-            sai_j[match]["value"] = value;
+            sai_j[match]["value"] = fields.values[i];
             sai_j[match]["sai_metadata"] = sai_metadata_j;
 
             sai_array_j.push_back(sai_j);
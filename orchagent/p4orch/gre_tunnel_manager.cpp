@@ -1,7 +1,6 @@
 #include "p4orch/gre_tunnel_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -226,15 +225,13 @@ ReturnCodeOr<P4GreTunnelAppDbEntry> GreTunnelManager::deserializeP4GreTunnelAppD
     app_db_entry.encap_src_ip = swss::IpAddress("0.0.0.0");
     app_db_entry.encap_dst_ip = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.tunnel_id = j[prependMatchField(p4orch::kTunnelId)];
-    }
-    catch (std::exception &ex)
+    static const P4KeyDecoder key_decoder({p4orch::kTunnelId});
+    P4KeyDecoder::Fields fields;
+    if (!key_decoder.decode(key, &fields).ok() || !fields.present[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize GRE tunnel id";
     }
+    app_db_entry.tunnel_id = fields.values[0];
 
     for (const auto &it : attributes)
     {
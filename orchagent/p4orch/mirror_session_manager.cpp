@@ -1,7 +1,6 @@
 #include "p4orch/mirror_session_manager.h"
 
 #include <map>
-#include <nlohmann/json.hpp>
 
 #include "SaiAttributeList.h"
 #include "dbconnector.h"
@@ -21,29 +20,35 @@ extern sai_object_id_t gSwitchId;
 namespace p4orch
 {
 
+namespace
+{
+
+const P4KeyDecoder &mirrorSessionKeyDecoder()
+{
+    static const P4KeyDecoder decoder({kMirrorSessionId});
+    return decoder;
+}
+
+} // namespace
+
 ReturnCode MirrorSessionManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                               std::string &object_key)
 {
-    std::string value;
+    P4KeyDecoder::Fields fields;
 
-    try
+    if (!mirrorSessionKeyDecoder().decode(json_key, &fields).ok())
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kMirrorSessionId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kMirrorSessionId)).get<std::string>();
-            object_key = KeyGenerator::generateMirrorSessionKey(value);
-            object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (!fields.present[0])
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
+    }
+    else
+    {
+        object_key = KeyGenerator::generateMirrorSessionKey(fields.values[0]);
+        object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
+        return ReturnCode();
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -192,15 +197,12 @@ ReturnCodeOr<P4MirrorSessionAppDbEntry> MirrorSessionManager::deserializeP4Mirro
 
     P4MirrorSessionAppDbEntry app_db_entry = {};
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.mirror_session_id = j[prependMatchField(p4orch::kMirrorSessionId)];
-    }
-    catch (std::exception &ex)
+    P4KeyDecoder::Fields fields;
+    if (!mirrorSessionKeyDecoder().decode(key, &fields).ok() || !fields.present[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize mirror session id";
     }
+    app_db_entry.mirror_session_id = fields.values[0];
 
     for (const auto &it : attributes)
     {
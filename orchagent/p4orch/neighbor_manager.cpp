@@ -1,8 +1,8 @@
 #include "p4orch/neighbor_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -26,10 +26,17 @@ extern sai_object_id_t gSwitchId;
 extern sai_neighbor_api_t *sai_neighbor_api;
 
 extern CrmOrch *gCrmOrch;
+extern size_t gMaxBulkSize;
 
 namespace
 {
 
+const P4KeyDecoder &neighborKeyDecoder()
+{
+    static const P4KeyDecoder decoder({p4orch::kRouterInterfaceId, p4orch::kNeighborId});
+    return decoder;
+}
+
 std::vector<sai_attribute_t> getSaiAttrs(const P4NeighborEntry &neighbor_entry)
 {
     std::vector<sai_attribute_t> attrs;
@@ -62,6 +69,17 @@ P4NeighborEntry::P4NeighborEntry(const std::string &router_interface_id, const s
     neighbor_key = KeyGenerator::generateNeighborKey(router_intf_id, neighbor_id);
 }
 
+NeighborManager::NeighborManager(P4OidMapper *p4oidMapper, ResponsePublisherInterface *publisher)
+    : m_neighborBulker(sai_neighbor_api, gMaxBulkSize)
+{
+    SWSS_LOG_ENTER();
+
+    assert(p4oidMapper != nullptr);
+    m_p4OidMapper = p4oidMapper;
+    assert(publisher != nullptr);
+    m_publisher = publisher;
+}
+
 ReturnCodeOr<sai_neighbor_entry_t> NeighborManager::getSaiEntry(const P4NeighborEntry &neighbor_entry)
 {
     const std::string &router_intf_key = neighbor_entry.router_intf_key;
@@ -88,16 +106,13 @@ ReturnCodeOr<P4NeighborAppDbEntry> NeighborManager::deserializeNeighborEntry(
 
     P4NeighborAppDbEntry app_db_entry = {};
     std::string ip_address;
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_intf_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-        ip_address = j[prependMatchField(p4orch::kNeighborId)];
-    }
-    catch (std::exception &ex)
+    P4KeyDecoder::Fields fields;
+    if (!neighborKeyDecoder().decode(key, &fields).ok() || !fields.present[0] || !fields.present[1])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize key";
     }
+    app_db_entry.router_intf_id = fields.values[0];
+    ip_address = fields.values[1];
     try
     {
         app_db_entry.neighbor_id = swss::IpAddress(ip_address);
@@ -168,11 +183,20 @@ P4NeighborEntry *NeighborManager::getNeighborEntry(const std::string &neighbor_k
     return &m_neighborTable[neighbor_key];
 }
 
-ReturnCode NeighborManager::createNeighbor(P4NeighborEntry &neighbor_entry)
+ReturnCode NeighborManager::prepareNeighbor(const P4NeighborAppDbEntry &app_db_entry, P4NeighborEntry &neighbor_entry)
 {
     SWSS_LOG_ENTER();
 
     const std::string &neighbor_key = neighbor_entry.neighbor_key;
+    if (!app_db_entry.is_set_dst_mac)
+    {
+        LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                             << p4orch::kDstMac
+                             << " is mandatory to create neighbor entry. Failed to create "
+                                "neighbor with key "
+                             << QuotedVar(neighbor_key));
+    }
+
     if (getNeighborEntry(neighbor_key) != nullptr)
     {
         LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_EXISTS)
@@ -186,33 +210,73 @@ ReturnCode NeighborManager::createNeighbor(P4NeighborEntry &neighbor_entry)
     }
 
     ASSIGN_OR_RETURN(neighbor_entry.neigh_entry, getSaiEntry(neighbor_entry));
-    auto attrs = getSaiAttrs(neighbor_entry);
+    return ReturnCode();
+}
 
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_neighbor_api->create_neighbor_entry(
-                                       &neighbor_entry.neigh_entry, static_cast<uint32_t>(attrs.size()), attrs.data()),
-                                   "Failed to create neighbor with key " << QuotedVar(neighbor_key));
+std::vector<ReturnCode> NeighborManager::createNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<P4NeighborEntry> neighbor_entries;
+    neighbor_entries.reserve(app_db_entries.size());
+    std::vector<sai_status_t> object_statuses(app_db_entries.size());
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
 
-    m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry.router_intf_key);
-    if (neighbor_entry.neighbor_id.isV4())
+    // The entries up to the first invalid one are created in bulk.
+    for (const auto &app_db_entry : app_db_entries)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        size_t i = neighbor_entries.size();
+        neighbor_entries.emplace_back(app_db_entry.router_intf_id, app_db_entry.neighbor_id,
+                                      app_db_entry.dst_mac_address);
+        auto status = prepareNeighbor(app_db_entry, neighbor_entries[i]);
+        if (!status.ok())
+        {
+            neighbor_entries.pop_back();
+            statuses[i] = status;
+            break;
+        }
+        auto attrs = getSaiAttrs(neighbor_entries[i]);
+        m_neighborBulker.create_entry(&object_statuses[i], &neighbor_entries[i].neigh_entry,
+                                      static_cast<uint32_t>(attrs.size()), attrs.data());
     }
-    else
+
+    m_neighborBulker.flush();
+
+    for (size_t i = 0; i < neighbor_entries.size(); ++i)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        auto &neighbor_entry = neighbor_entries[i];
+        CHECK_ERROR_AND_LOG(object_statuses[i],
+                            "Failed to create neighbor with key " << QuotedVar(neighbor_entry.neighbor_key));
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            statuses[i] = ReturnCode(object_statuses[i])
+                          << "Failed to create neighbor with key " << QuotedVar(neighbor_entry.neighbor_key);
+            continue;
+        }
+
+        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry.router_intf_key);
+        if (neighbor_entry.neighbor_id.isV4())
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        }
+        else
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        }
+
+        m_p4OidMapper->setDummyOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_entry.neighbor_key);
+        m_neighborTable[neighbor_entry.neighbor_key] = neighbor_entry;
+        statuses[i] = ReturnCode();
     }
 
-    m_neighborTable[neighbor_key] = neighbor_entry;
-    m_p4OidMapper->setDummyOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
-    return ReturnCode();
+    return statuses;
 }
 
-ReturnCode NeighborManager::removeNeighbor(const std::string &neighbor_key)
+ReturnCode NeighborManager::checkNeighborRemoval(const std::string &neighbor_key)
 {
     SWSS_LOG_ENTER();
 
-    auto *neighbor_entry = getNeighborEntry(neighbor_key);
-    if (neighbor_entry == nullptr)
+    if (getNeighborEntry(neighbor_key) == nullptr)
     {
         LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_NOT_FOUND)
                              << "Neighbor with key " << QuotedVar(neighbor_key) << " does not exist");
@@ -231,22 +295,87 @@ ReturnCode NeighborManager::removeNeighbor(const std::string &neighbor_key)
                              << " referenced by other objects (ref_count = " << ref_count << ")");
     }
 
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_neighbor_api->remove_neighbor_entry(&neighbor_entry->neigh_entry),
-                                   "Failed to remove neighbor with key " << QuotedVar(neighbor_key));
+    return ReturnCode();
+}
 
-    m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry->router_intf_key);
-    if (neighbor_entry->neighbor_id.isV4())
+std::vector<ReturnCode> NeighborManager::removeNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<P4NeighborEntry *> neighbor_entries;
+    std::vector<sai_status_t> object_statuses(app_db_entries.size());
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+
+    // The entries up to the first invalid one are removed in bulk.
+    for (const auto &app_db_entry : app_db_entries)
     {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        size_t i = neighbor_entries.size();
+        const std::string neighbor_key =
+            KeyGenerator::generateNeighborKey(app_db_entry.router_intf_id, app_db_entry.neighbor_id);
+        auto status = checkNeighborRemoval(neighbor_key);
+        if (!status.ok())
+        {
+            statuses[i] = status;
+            break;
+        }
+
+        auto *neighbor_entry = getNeighborEntry(neighbor_key);
+        neighbor_entries.push_back(neighbor_entry);
+        m_neighborBulker.remove_entry(&object_statuses[i], &neighbor_entry->neigh_entry);
     }
-    else
+
+    m_neighborBulker.flush();
+
+    for (size_t i = 0; i < neighbor_entries.size(); ++i)
     {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        auto *neighbor_entry = neighbor_entries[i];
+        const std::string neighbor_key = neighbor_entry->neighbor_key;
+        CHECK_ERROR_AND_LOG(object_statuses[i], "Failed to remove neighbor with key " << QuotedVar(neighbor_key));
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            statuses[i] = ReturnCode(object_statuses[i])
+                          << "Failed to remove neighbor with key " << QuotedVar(neighbor_key);
+            continue;
+        }
+
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry->router_intf_key);
+        if (neighbor_entry->neighbor_id.isV4())
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+        }
+        else
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+        }
+
+        m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
+        m_neighborTable.erase(neighbor_key);
+        statuses[i] = ReturnCode();
     }
 
-    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
-    m_neighborTable.erase(neighbor_key);
-    return ReturnCode();
+    return statuses;
+}
+
+std::vector<ReturnCode> NeighborManager::updateNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
+
+    // Neighbor updates are rare, they are programmed one by one and stop on the
+    // first failure.
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    for (size_t i = 0; i < app_db_entries.size(); ++i)
+    {
+        const auto &app_db_entry = app_db_entries[i];
+        auto *neighbor_entry =
+            getNeighborEntry(KeyGenerator::generateNeighborKey(app_db_entry.router_intf_id, app_db_entry.neighbor_id));
+        statuses[i] = processUpdateRequest(app_db_entry, neighbor_entry);
+        if (!statuses[i].ok())
+        {
+            break;
+        }
+    }
+
+    return statuses;
 }
 
 ReturnCode NeighborManager::setDstMacAddress(P4NeighborEntry *neighbor_entry, const swss::MacAddress &mac_address)
@@ -268,30 +397,6 @@ ReturnCode NeighborManager::setDstMacAddress(P4NeighborEntry *neighbor_entry, co
     return ReturnCode();
 }
 
-ReturnCode NeighborManager::processAddRequest(const P4NeighborAppDbEntry &app_db_entry, const std::string &neighbor_key)
-{
-    SWSS_LOG_ENTER();
-
-    // Perform operation specific validations.
-    if (!app_db_entry.is_set_dst_mac)
-    {
-        LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                             << p4orch::kDstMac
-                             << " is mandatory to create neighbor entry. Failed to create "
-                                "neighbor with key "
-                             << QuotedVar(neighbor_key));
-    }
-
-    P4NeighborEntry neighbor_entry(app_db_entry.router_intf_id, app_db_entry.neighbor_id, app_db_entry.dst_mac_address);
-    auto status = createNeighbor(neighbor_entry);
-    if (!status.ok())
-    {
-        SWSS_LOG_ERROR("Failed to create neighbor with key %s", QuotedVar(neighbor_key).c_str());
-    }
-
-    return status;
-}
-
 ReturnCode NeighborManager::processUpdateRequest(const P4NeighborAppDbEntry &app_db_entry,
                                                  P4NeighborEntry *neighbor_entry)
 {
@@ -311,14 +416,35 @@ ReturnCode NeighborManager::processUpdateRequest(const P4NeighborAppDbEntry &app
     return ReturnCode();
 }
 
-ReturnCode NeighborManager::processDeleteRequest(const std::string &neighbor_key)
+ReturnCode NeighborManager::processEntries(const std::vector<P4NeighborAppDbEntry> &app_db_entries,
+                                           const std::vector<swss::KeyOpFieldsValuesTuple> &tuple_list,
+                                           const std::string &op, bool update)
 {
     SWSS_LOG_ENTER();
 
-    auto status = removeNeighbor(neighbor_key);
-    if (!status.ok())
+    std::vector<ReturnCode> statuses;
+    if (op == DEL_COMMAND)
+    {
+        statuses = removeNeighbors(app_db_entries);
+    }
+    else if (update)
+    {
+        statuses = updateNeighbors(app_db_entries);
+    }
+    else
     {
-        SWSS_LOG_ERROR("Failed to remove neighbor with key %s", QuotedVar(neighbor_key).c_str());
+        statuses = createNeighbors(app_db_entries);
+    }
+
+    ReturnCode status;
+    for (size_t i = 0; i < app_db_entries.size(); ++i)
+    {
+        m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]), kfvFieldsValues(tuple_list[i]), statuses[i],
+                             /*replace=*/true);
+        if (status.ok() && !statuses[i].ok())
+        {
+            status = statuses[i];
+        }
     }
 
     return status;
@@ -327,38 +453,35 @@ ReturnCode NeighborManager::processDeleteRequest(const std::string &neighbor_key
 ReturnCode NeighborManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                          std::string &object_key)
 {
-    std::string router_intf_id, neighbor_id;
     swss::IpAddress neighbor;
+    P4KeyDecoder::Fields fields;
 
-    try
+    if (!neighborKeyDecoder().decode(json_key, &fields).ok())
+    {
+        SWSS_LOG_ERROR("json_key parse error");
+    }
+    else if (!fields.present[0])
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kRouterInterfaceId);
+    }
+    else if (!fields.present[1])
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNeighborId);
+    }
+    else
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
+        try
         {
-            router_intf_id = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            if (j.find(prependMatchField(p4orch::kNeighborId)) != j.end())
-            {
-                neighbor_id = j.at(prependMatchField(p4orch::kNeighborId)).get<std::string>();
-                neighbor = swss::IpAddress(neighbor_id);
-                object_key = KeyGenerator::generateNeighborKey(router_intf_id, neighbor);
-                object_type = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
-                return ReturnCode();
-            }
-            else
-            {
-                SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNeighborId);
-            }
+            neighbor = swss::IpAddress(fields.values[1]);
+            object_key = KeyGenerator::generateNeighborKey(fields.values[0], neighbor);
+            object_type = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY;
+            return ReturnCode();
         }
-        else
+        catch (std::exception &ex)
         {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
+            SWSS_LOG_ERROR("json_key parse error");
         }
     }
-    catch (std::exception &ex)
-    {
-        SWSS_LOG_ERROR("json_key parse error");
-    }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
 }
@@ -375,7 +498,13 @@ void NeighborManager::drainWithNotExecuted() {
 ReturnCode NeighborManager::drain() {
   SWSS_LOG_ENTER();
 
+  std::vector<P4NeighborAppDbEntry> entry_list;
+  std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+  std::unordered_set<std::string> neighbor_keys;
+
   ReturnCode status;
+  std::string prev_op;
+  bool prev_update = false;
   while (!m_entries.empty()) {
     auto key_op_fvs_tuple = m_entries.front();
     m_entries.pop_front();
@@ -410,33 +539,61 @@ ReturnCode NeighborManager::drain() {
       break;
     }
 
-    const std::string neighbor_key = KeyGenerator::generateNeighborKey(
-        app_db_entry.router_intf_id, app_db_entry.neighbor_id);
-
     const std::string& operation = kfvOp(key_op_fvs_tuple);
-    if (operation == SET_COMMAND) {
-      auto* neighbor_entry = getNeighborEntry(neighbor_key);
-      if (neighbor_entry == nullptr) {
-        // Create neighbor
-        status = processAddRequest(app_db_entry, neighbor_key);
-      } else {
-        // Modify existing neighbor
-        status = processUpdateRequest(app_db_entry, neighbor_entry);
-      }
-    } else if (operation == DEL_COMMAND) {
-      // Delete neighbor
-      status = processDeleteRequest(neighbor_key);
-    } else {
+    if (operation != SET_COMMAND && operation != DEL_COMMAND) {
       status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                << "Unknown operation type " << QuotedVar(operation);
       SWSS_LOG_ERROR("%s", status.message().c_str());
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple), status,
+                           /*replace=*/true);
+      break;
+    }
+
+    const std::string neighbor_key = KeyGenerator::generateNeighborKey(
+        app_db_entry.router_intf_id, app_db_entry.neighbor_id);
+
+    // An entry of a neighbor already in the batch depends on the result of the
+    // earlier one, so the batch is processed first.
+    if (neighbor_keys.count(neighbor_key) != 0) {
+      status = processEntries(entry_list, tuple_list, prev_op, prev_update);
+      entry_list.clear();
+      tuple_list.clear();
+      neighbor_keys.clear();
     }
-    m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
-                         kfvFieldsValues(key_op_fvs_tuple), status,
-                         /*replace=*/true);
+
+    bool update = (operation == SET_COMMAND &&
+                   getNeighborEntry(neighbor_key) != nullptr);
+    // Process the entries if the operation type changes.
+    if (status.ok() && !entry_list.empty() &&
+        (operation != prev_op || update != prev_update)) {
+      status = processEntries(entry_list, tuple_list, prev_op, prev_update);
+      entry_list.clear();
+      tuple_list.clear();
+      neighbor_keys.clear();
+    }
+
     if (!status.ok()) {
+      // Return SWSS_RC_NOT_EXECUTED if failure has occured.
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple),
+                           ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED),
+                           /*replace=*/true);
       break;
     }
+
+    entry_list.push_back(app_db_entry);
+    tuple_list.push_back(key_op_fvs_tuple);
+    neighbor_keys.insert(neighbor_key);
+    prev_op = operation;
+    prev_update = update;
+  }
+
+  if (!entry_list.empty()) {
+    auto rc = processEntries(entry_list, tuple_list, prev_op, prev_update);
+    if (!rc.ok()) {
+      status = rc;
+    }
   }
   drainWithNotExecuted();
   return status;
@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "bulker.h"
 #include "ipaddress.h"
 #include "macaddress.h"
 #include "orch.h"
@@ -38,15 +39,7 @@ typedef std::unordered_map<std::string, P4NeighborEntry> P4NeighborTable;
 class NeighborManager : public ObjectManagerInterface
 {
   public:
-    NeighborManager(P4OidMapper *p4oidMapper, ResponsePublisherInterface *publisher)
-    {
-        SWSS_LOG_ENTER();
-
-        assert(p4oidMapper != nullptr);
-        m_p4OidMapper = p4oidMapper;
-        assert(publisher != nullptr);
-        m_publisher = publisher;
-    }
+    NeighborManager(P4OidMapper *p4oidMapper, ResponsePublisherInterface *publisher);
     virtual ~NeighborManager() = default;
 
     void enqueue(const std::string &table_name, const swss::KeyOpFieldsValuesTuple &entry) override;
@@ -61,12 +54,16 @@ class NeighborManager : public ObjectManagerInterface
                                                                 const std::vector<swss::FieldValueTuple> &attributes);
     ReturnCode validateNeighborAppDbEntry(const P4NeighborAppDbEntry &app_db_entry);
     P4NeighborEntry *getNeighborEntry(const std::string &neighbor_key);
-    ReturnCode createNeighbor(P4NeighborEntry &neighbor_entry);
-    ReturnCode removeNeighbor(const std::string &neighbor_key);
+    ReturnCode prepareNeighbor(const P4NeighborAppDbEntry &app_db_entry, P4NeighborEntry &neighbor_entry);
+    std::vector<ReturnCode> createNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries);
+    ReturnCode checkNeighborRemoval(const std::string &neighbor_key);
+    std::vector<ReturnCode> removeNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries);
+    std::vector<ReturnCode> updateNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries);
     ReturnCode setDstMacAddress(P4NeighborEntry *neighbor_entry, const swss::MacAddress &mac_address);
-    ReturnCode processAddRequest(const P4NeighborAppDbEntry &app_db_entry, const std::string &neighbor_key);
     ReturnCode processUpdateRequest(const P4NeighborAppDbEntry &app_db_entry, P4NeighborEntry *neighbor_entry);
-    ReturnCode processDeleteRequest(const std::string &neighbor_key);
+    ReturnCode processEntries(const std::vector<P4NeighborAppDbEntry> &app_db_entries,
+                              const std::vector<swss::KeyOpFieldsValuesTuple> &tuple_list, const std::string &op,
+                              bool update);
     std::string verifyStateCache(const P4NeighborAppDbEntry &app_db_entry, const P4NeighborEntry *neighbor_entry);
     std::string verifyStateAsicDb(const P4NeighborEntry *neighbor_entry);
     ReturnCodeOr<sai_neighbor_entry_t> getSaiEntry(const P4NeighborEntry &neighbor_entry);
@@ -75,6 +72,7 @@ class NeighborManager : public ObjectManagerInterface
     P4NeighborTable m_neighborTable;
     ResponsePublisherInterface *m_publisher;
     std::deque<swss::KeyOpFieldsValuesTuple> m_entries;
+    EntityBulker<sai_neighbor_api_t> m_neighborBulker;
 
     friend class NeighborManagerTest;
 };
@@ -1,8 +1,8 @@
 #include "p4orch/next_hop_manager.h"
 
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -26,6 +26,7 @@ extern sai_object_id_t gSwitchId;
 extern sai_next_hop_api_t *sai_next_hop_api;
 extern CrmOrch *gCrmOrch;
 extern P4Orch *gP4Orch;
+extern size_t gMaxBulkSize;
 
 P4NextHopEntry::P4NextHopEntry(const std::string &next_hop_id, const std::string &router_interface_id,
                                const std::string &gre_tunnel_id, const swss::IpAddress &neighbor_id)
@@ -36,9 +37,26 @@ P4NextHopEntry::P4NextHopEntry(const std::string &next_hop_id, const std::string
     next_hop_key = KeyGenerator::generateNextHopKey(next_hop_id);
 }
 
+NextHopManager::NextHopManager(P4OidMapper *p4oidMapper, ResponsePublisherInterface *publisher)
+    : m_nextHopBulker(sai_next_hop_api, gSwitchId, gMaxBulkSize)
+{
+    SWSS_LOG_ENTER();
+
+    assert(p4oidMapper != nullptr);
+    m_p4OidMapper = p4oidMapper;
+    assert(publisher != nullptr);
+    m_publisher = publisher;
+}
+
 namespace
 {
 
+const P4KeyDecoder &nextHopKeyDecoder()
+{
+    static const P4KeyDecoder decoder({p4orch::kNexthopId});
+    return decoder;
+}
+
 ReturnCode validateAppDbEntry(const P4NextHopAppDbEntry &app_db_entry)
 {
     // TODO(b/225242372): remove kSetNexthop action after P4RT and Orion update
@@ -150,26 +168,21 @@ ReturnCodeOr<std::vector<sai_attribute_t>> NextHopManager::getSaiAttrs(const P4N
 ReturnCode NextHopManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                         std::string &object_key)
 {
-    std::string value;
+    P4KeyDecoder::Fields fields;
 
-    try
+    if (!nextHopKeyDecoder().decode(json_key, &fields).ok())
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kNexthopId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kNexthopId)).get<std::string>();
-            object_key = KeyGenerator::generateNextHopKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (!fields.present[0])
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
+    }
+    else
+    {
+        object_key = KeyGenerator::generateNextHopKey(fields.values[0]);
+        object_type = SAI_OBJECT_TYPE_NEXT_HOP;
+        return ReturnCode();
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -187,7 +200,13 @@ void NextHopManager::drainWithNotExecuted() {
 ReturnCode NextHopManager::drain() {
   SWSS_LOG_ENTER();
 
+  std::vector<P4NextHopAppDbEntry> entry_list;
+  std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+  std::unordered_set<std::string> next_hop_keys;
+
   ReturnCode status;
+  std::string prev_op;
+  bool prev_update = false;
   while (!m_entries.empty()) {
     auto key_op_fvs_tuple = m_entries.front();
     m_entries.pop_front();
@@ -213,7 +232,6 @@ ReturnCode NextHopManager::drain() {
     const std::string next_hop_key =
         KeyGenerator::generateNextHopKey(app_db_entry.next_hop_id);
 
-    // Fulfill the operation.
     const std::string& operation = kfvOp(key_op_fvs_tuple);
     if (operation == SET_COMMAND) {
       status = validateAppDbEntry(app_db_entry);
@@ -227,28 +245,57 @@ ReturnCode NextHopManager::drain() {
                              /*replace=*/true);
         break;
       }
-      auto* next_hop_entry = getNextHopEntry(next_hop_key);
-      if (next_hop_entry == nullptr) {
-        // Create new next hop.
-        status = processAddRequest(app_db_entry);
-      } else {
-        // Modify existing next hop.
-        status = processUpdateRequest(app_db_entry, next_hop_entry);
-      }
-    } else if (operation == DEL_COMMAND) {
-      // Delete next hop.
-      status = processDeleteRequest(next_hop_key);
-    } else {
+    } else if (operation != DEL_COMMAND) {
       status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                << "Unknown operation type " << QuotedVar(operation);
       SWSS_LOG_ERROR("%s", status.message().c_str());
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple), status,
+                           /*replace=*/true);
+      break;
+    }
+
+    // An entry of a next hop already in the batch depends on the result of the
+    // earlier one, so the batch is processed first.
+    if (next_hop_keys.count(next_hop_key) != 0) {
+      status = processEntries(entry_list, tuple_list, prev_op, prev_update);
+      entry_list.clear();
+      tuple_list.clear();
+      next_hop_keys.clear();
     }
-    m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
-                         kfvFieldsValues(key_op_fvs_tuple), status,
-                         /*replace=*/true);
+
+    bool update = (operation == SET_COMMAND &&
+                   getNextHopEntry(next_hop_key) != nullptr);
+    // Process the entries if the operation type changes.
+    if (status.ok() && !entry_list.empty() &&
+        (operation != prev_op || update != prev_update)) {
+      status = processEntries(entry_list, tuple_list, prev_op, prev_update);
+      entry_list.clear();
+      tuple_list.clear();
+      next_hop_keys.clear();
+    }
+
     if (!status.ok()) {
+      // Return SWSS_RC_NOT_EXECUTED if failure has occured.
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple),
+                           ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED),
+                           /*replace=*/true);
       break;
     }
+
+    entry_list.push_back(app_db_entry);
+    tuple_list.push_back(key_op_fvs_tuple);
+    next_hop_keys.insert(next_hop_key);
+    prev_op = operation;
+    prev_update = update;
+  }
+
+  if (!entry_list.empty()) {
+    auto rc = processEntries(entry_list, tuple_list, prev_op, prev_update);
+    if (!rc.ok()) {
+      status = rc;
+    }
   }
   drainWithNotExecuted();
   return status;
@@ -278,15 +325,12 @@ ReturnCodeOr<P4NextHopAppDbEntry> NextHopManager::deserializeP4NextHopAppDbEntry
     P4NextHopAppDbEntry app_db_entry = {};
     app_db_entry.neighbor_id = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.next_hop_id = j[prependMatchField(p4orch::kNexthopId)];
-    }
-    catch (std::exception &ex)
+    P4KeyDecoder::Fields fields;
+    if (!nextHopKeyDecoder().decode(key, &fields).ok() || !fields.present[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize next hop id";
     }
+    app_db_entry.next_hop_id = fields.values[0];
 
     for (const auto &it : attributes)
     {
@@ -326,21 +370,7 @@ ReturnCodeOr<P4NextHopAppDbEntry> NextHopManager::deserializeP4NextHopAppDbEntry
     return app_db_entry;
 }
 
-ReturnCode NextHopManager::processAddRequest(const P4NextHopAppDbEntry &app_db_entry)
-{
-    SWSS_LOG_ENTER();
-
-    P4NextHopEntry next_hop_entry(app_db_entry.next_hop_id, app_db_entry.router_interface_id,
-                                  app_db_entry.gre_tunnel_id, app_db_entry.neighbor_id);
-    auto status = createNextHop(next_hop_entry);
-    if (!status.ok())
-    {
-        SWSS_LOG_ERROR("Failed to create next hop with key %s", QuotedVar(next_hop_entry.next_hop_key).c_str());
-    }
-    return status;
-}
-
-ReturnCode NextHopManager::createNextHop(P4NextHopEntry &next_hop_entry)
+ReturnCode NextHopManager::prepareNextHop(P4NextHopEntry &next_hop_entry)
 {
     SWSS_LOG_ENTER();
 
@@ -386,43 +416,92 @@ ReturnCode NextHopManager::createNextHop(P4NextHopEntry &next_hop_entry)
                              << " does not exist in centralized mapper");
     }
 
-    ASSIGN_OR_RETURN(std::vector<sai_attribute_t> attrs, getSaiAttrs(next_hop_entry));
+    return ReturnCode();
+}
 
-    // Call SAI API.
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_next_hop_api->create_next_hop(&next_hop_entry.next_hop_oid, gSwitchId,
-                                                                     (uint32_t)attrs.size(), attrs.data()),
-                                   "Failed to create next hop " << QuotedVar(next_hop_entry.next_hop_key));
+std::vector<ReturnCode> NextHopManager::createNextHops(const std::vector<P4NextHopAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
 
-    if (!next_hop_entry.gre_tunnel_id.empty())
-    {
-        // On successful creation, increment ref count for tunnel object
-        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_TUNNEL,
-                                        KeyGenerator::generateTunnelKey(next_hop_entry.gre_tunnel_id));
-    }
-    else
-    {
-        // On successful creation, increment ref count for router intf object
-        m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
-                                        KeyGenerator::generateRouterInterfaceKey(next_hop_entry.router_interface_id));
-    }
+    std::vector<P4NextHopEntry> next_hop_entries;
+    next_hop_entries.reserve(app_db_entries.size());
+    std::vector<sai_status_t> object_statuses(app_db_entries.size());
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
 
-    m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key);
-    if (next_hop_entry.neighbor_id.isV4())
+    // The entries up to the first invalid one are created in bulk.
+    for (const auto &app_db_entry : app_db_entries)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        size_t i = next_hop_entries.size();
+        next_hop_entries.emplace_back(app_db_entry.next_hop_id, app_db_entry.router_interface_id,
+                                      app_db_entry.gre_tunnel_id, app_db_entry.neighbor_id);
+        auto &next_hop_entry = next_hop_entries[i];
+        auto status = prepareNextHop(next_hop_entry);
+        if (status.ok())
+        {
+            auto attrs_or = getSaiAttrs(next_hop_entry);
+            if (attrs_or.ok())
+            {
+                auto attrs = *attrs_or;
+                m_nextHopBulker.create_entry(&next_hop_entry.next_hop_oid, &object_statuses[i],
+                                             static_cast<uint32_t>(attrs.size()), attrs.data());
+                continue;
+            }
+            status = attrs_or.status();
+        }
+        SWSS_LOG_ERROR("Failed to create next hop with key %s", QuotedVar(next_hop_entry.next_hop_key).c_str());
+        next_hop_entries.pop_back();
+        statuses[i] = status;
+        break;
     }
-    else
+
+    m_nextHopBulker.flush();
+
+    for (size_t i = 0; i < next_hop_entries.size(); ++i)
     {
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
-    }
+        auto &next_hop_entry = next_hop_entries[i];
+        CHECK_ERROR_AND_LOG(object_statuses[i], "Failed to create next hop " << QuotedVar(next_hop_entry.next_hop_key));
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            statuses[i] = ReturnCode(object_statuses[i])
+                          << "Failed to create next hop " << QuotedVar(next_hop_entry.next_hop_key);
+            continue;
+        }
+
+        if (!next_hop_entry.gre_tunnel_id.empty())
+        {
+            // On successful creation, increment ref count for tunnel object
+            m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_TUNNEL,
+                                            KeyGenerator::generateTunnelKey(next_hop_entry.gre_tunnel_id));
+        }
+        else
+        {
+            // On successful creation, increment ref count for router intf object
+            m_p4OidMapper->increaseRefCount(
+                SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                KeyGenerator::generateRouterInterfaceKey(next_hop_entry.router_interface_id));
+        }
+
+        m_p4OidMapper->increaseRefCount(
+            SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+            KeyGenerator::generateNeighborKey(next_hop_entry.router_interface_id, next_hop_entry.neighbor_id));
+        if (next_hop_entry.neighbor_id.isV4())
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        }
+        else
+        {
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
+        }
 
-    // Add created entry to internal table.
-    m_nextHopTable.emplace(next_hop_entry.next_hop_key, next_hop_entry);
+        // Add created entry to internal table.
+        m_nextHopTable.emplace(next_hop_entry.next_hop_key, next_hop_entry);
 
-    // Add the key to OID map to centralized mapper.
-    m_p4OidMapper->setOID(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_entry.next_hop_key, next_hop_entry.next_hop_oid);
+        // Add the key to OID map to centralized mapper.
+        m_p4OidMapper->setOID(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_entry.next_hop_key, next_hop_entry.next_hop_oid);
+        statuses[i] = ReturnCode();
+    }
 
-    return ReturnCode();
+    return statuses;
 }
 
 ReturnCode NextHopManager::processUpdateRequest(const P4NextHopAppDbEntry &app_db_entry, P4NextHopEntry *next_hop_entry)
@@ -436,20 +515,25 @@ ReturnCode NextHopManager::processUpdateRequest(const P4NextHopAppDbEntry &app_d
     return status;
 }
 
-ReturnCode NextHopManager::processDeleteRequest(const std::string &next_hop_key)
+std::vector<ReturnCode> NextHopManager::updateNextHops(const std::vector<P4NextHopAppDbEntry> &app_db_entries)
 {
     SWSS_LOG_ENTER();
 
-    auto status = removeNextHop(next_hop_key);
-    if (!status.ok())
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    for (size_t i = 0; i < app_db_entries.size(); ++i)
     {
-        SWSS_LOG_ERROR("Failed to remove next hop with key %s", QuotedVar(next_hop_key).c_str());
+        auto *next_hop_entry = getNextHopEntry(KeyGenerator::generateNextHopKey(app_db_entries[i].next_hop_id));
+        statuses[i] = processUpdateRequest(app_db_entries[i], next_hop_entry);
+        if (!statuses[i].ok())
+        {
+            break;
+        }
     }
 
-    return status;
+    return statuses;
 }
 
-ReturnCode NextHopManager::removeNextHop(const std::string &next_hop_key)
+ReturnCode NextHopManager::checkNextHopRemoval(const std::string &next_hop_key)
 {
     SWSS_LOG_ENTER();
 
@@ -477,55 +561,132 @@ ReturnCode NextHopManager::removeNextHop(const std::string &next_hop_key)
                              << " referenced by other objects (ref_count = " << ref_count);
     }
 
-    // Call SAI API.
-    CHECK_ERROR_AND_LOG_AND_RETURN(sai_next_hop_api->remove_next_hop(next_hop_entry->next_hop_oid),
-                                   "Failed to remove next hop " << QuotedVar(next_hop_entry->next_hop_key));
+    return ReturnCode();
+}
 
-    if (!next_hop_entry->gre_tunnel_id.empty())
-    {
-        // On successful deletion, decrement ref count for tunnel object
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_TUNNEL,
-                                        KeyGenerator::generateTunnelKey(next_hop_entry->gre_tunnel_id));
-    }
-    else
+std::vector<ReturnCode> NextHopManager::removeNextHops(const std::vector<P4NextHopAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<P4NextHopEntry *> next_hop_entries;
+    std::vector<sai_status_t> object_statuses(app_db_entries.size());
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+
+    // The entries up to the first invalid one are removed in bulk.
+    for (const auto &app_db_entry : app_db_entries)
     {
-        // On successful deletion, decrement ref count for router intf object
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
-                                        KeyGenerator::generateRouterInterfaceKey(next_hop_entry->router_interface_id));
+        size_t i = next_hop_entries.size();
+        const std::string next_hop_key = KeyGenerator::generateNextHopKey(app_db_entry.next_hop_id);
+        auto status = checkNextHopRemoval(next_hop_key);
+        if (!status.ok())
+        {
+            SWSS_LOG_ERROR("Failed to remove next hop with key %s", QuotedVar(next_hop_key).c_str());
+            statuses[i] = status;
+            break;
+        }
+
+        auto *next_hop_entry = getNextHopEntry(next_hop_key);
+        next_hop_entries.push_back(next_hop_entry);
+        m_nextHopBulker.remove_entry(&object_statuses[i], next_hop_entry->next_hop_oid);
     }
 
-    std::string router_interface_id = next_hop_entry->router_interface_id;
-    if (!next_hop_entry->gre_tunnel_id.empty())
+    m_nextHopBulker.flush();
+
+    for (size_t i = 0; i < next_hop_entries.size(); ++i)
     {
-        auto gre_tunnel_or = gP4Orch->getGreTunnelManager()->getConstGreTunnelEntry(
-            KeyGenerator::generateTunnelKey(next_hop_entry->gre_tunnel_id));
-        if (!gre_tunnel_or.ok())
+        auto *next_hop_entry = next_hop_entries[i];
+        const std::string next_hop_key = next_hop_entry->next_hop_key;
+        CHECK_ERROR_AND_LOG(object_statuses[i], "Failed to remove next hop " << QuotedVar(next_hop_key));
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
         {
-            LOG_ERROR_AND_RETURN(ReturnCode(StatusCode::SWSS_RC_NOT_FOUND)
-                                 << "GRE Tunnel " << QuotedVar(next_hop_entry->gre_tunnel_id)
-                                 << " does not exist in GRE Tunnel Manager");
+            statuses[i] = ReturnCode(object_statuses[i]) << "Failed to remove next hop " << QuotedVar(next_hop_key);
+            continue;
         }
-        router_interface_id = (*gre_tunnel_or).router_interface_id;
+
+        if (!next_hop_entry->gre_tunnel_id.empty())
+        {
+            // On successful deletion, decrement ref count for tunnel object
+            m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_TUNNEL,
+                                            KeyGenerator::generateTunnelKey(next_hop_entry->gre_tunnel_id));
+        }
+        else
+        {
+            // On successful deletion, decrement ref count for router intf object
+            m_p4OidMapper->decreaseRefCount(
+                SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                KeyGenerator::generateRouterInterfaceKey(next_hop_entry->router_interface_id));
+        }
+
+        std::string router_interface_id = next_hop_entry->router_interface_id;
+        if (!next_hop_entry->gre_tunnel_id.empty())
+        {
+            auto gre_tunnel_or = gP4Orch->getGreTunnelManager()->getConstGreTunnelEntry(
+                KeyGenerator::generateTunnelKey(next_hop_entry->gre_tunnel_id));
+            if (!gre_tunnel_or.ok())
+            {
+                statuses[i] = ReturnCode(StatusCode::SWSS_RC_NOT_FOUND)
+                              << "GRE Tunnel " << QuotedVar(next_hop_entry->gre_tunnel_id)
+                              << " does not exist in GRE Tunnel Manager";
+                SWSS_LOG_ERROR("%s", statuses[i].message().c_str());
+                continue;
+            }
+            router_interface_id = (*gre_tunnel_or).router_interface_id;
+        }
+        m_p4OidMapper->decreaseRefCount(
+            SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+            KeyGenerator::generateNeighborKey(router_interface_id, next_hop_entry->neighbor_id));
+        if (next_hop_entry->neighbor_id.isV4())
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        }
+        else
+        {
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
+        }
+
+        // Remove the key to OID map to centralized mapper.
+        m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_key);
+
+        // Remove the entry from internal table.
+        m_nextHopTable.erase(next_hop_key);
+        statuses[i] = ReturnCode();
     }
-    m_p4OidMapper->decreaseRefCount(
-        SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
-        KeyGenerator::generateNeighborKey(router_interface_id, next_hop_entry->neighbor_id));
-    if (next_hop_entry->neighbor_id.isV4())
+
+    return statuses;
+}
+
+ReturnCode NextHopManager::processEntries(const std::vector<P4NextHopAppDbEntry> &app_db_entries,
+                                          const std::vector<swss::KeyOpFieldsValuesTuple> &tuple_list,
+                                          const std::string &op, bool update)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses;
+    if (op == DEL_COMMAND)
+    {
+        statuses = removeNextHops(app_db_entries);
+    }
+    else if (update)
     {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        statuses = updateNextHops(app_db_entries);
     }
     else
     {
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEXTHOP);
+        statuses = createNextHops(app_db_entries);
     }
 
-    // Remove the key to OID map to centralized mapper.
-    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_NEXT_HOP, next_hop_key);
-
-    // Remove the entry from internal table.
-    m_nextHopTable.erase(next_hop_key);
+    ReturnCode status;
+    for (size_t i = 0; i < app_db_entries.size(); ++i)
+    {
+        m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]), kfvFieldsValues(tuple_list[i]), statuses[i],
+                             /*replace=*/true);
+        if (status.ok() && !statuses[i].ok())
+        {
+            status = statuses[i];
+        }
+    }
 
-    return ReturnCode();
+    return status;
 }
 
 std::string NextHopManager::verifyState(const std::string &key, const std::vector<swss::FieldValueTuple> &tuple)
@@ -3,7 +3,9 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "bulker.h"
 #include "ipaddress.h"
 #include "orch.h"
 #include "p4orch/gre_tunnel_manager.h"
@@ -45,15 +47,7 @@ struct P4NextHopEntry
 class NextHopManager : public ObjectManagerInterface
 {
   public:
-    NextHopManager(P4OidMapper *p4oidMapper, ResponsePublisherInterface *publisher)
-    {
-        SWSS_LOG_ENTER();
-
-        assert(p4oidMapper != nullptr);
-        m_p4OidMapper = p4oidMapper;
-        assert(publisher != nullptr);
-        m_publisher = publisher;
-    }
+    NextHopManager(P4OidMapper *p4oidMapper, ResponsePublisherInterface *publisher);
 
     virtual ~NextHopManager() = default;
 
@@ -73,20 +67,32 @@ class NextHopManager : public ObjectManagerInterface
     ReturnCodeOr<P4NextHopAppDbEntry> deserializeP4NextHopAppDbEntry(
         const std::string &key, const std::vector<swss::FieldValueTuple> &attributes);
 
-    // Processes add operation for an entry.
-    ReturnCode processAddRequest(const P4NextHopAppDbEntry &app_db_entry);
+    // Checks that a next hop can be created and resolves its router interface
+    // and neighbor.
+    ReturnCode prepareNextHop(P4NextHopEntry &next_hop_entry);
 
-    // Creates an next hop in the next hop table. Return true on success.
-    ReturnCode createNextHop(P4NextHopEntry &next_hop_entry);
+    // Creates a list of next hops in bulk. The entries after the first one
+    // failing the checks are not executed.
+    std::vector<ReturnCode> createNextHops(const std::vector<P4NextHopAppDbEntry> &app_db_entries);
 
     // Processes update operation for an entry.
     ReturnCode processUpdateRequest(const P4NextHopAppDbEntry &app_db_entry, P4NextHopEntry *next_hop_entry);
 
-    // Processes delete operation for an entry.
-    ReturnCode processDeleteRequest(const std::string &next_hop_key);
+    // Updates a list of next hops, stopping on the first failure.
+    std::vector<ReturnCode> updateNextHops(const std::vector<P4NextHopAppDbEntry> &app_db_entries);
+
+    // Checks that a next hop exists and is not referenced.
+    ReturnCode checkNextHopRemoval(const std::string &next_hop_key);
+
+    // Deletes a list of next hops in bulk. The entries after the first one
+    // failing the checks are not executed.
+    std::vector<ReturnCode> removeNextHops(const std::vector<P4NextHopAppDbEntry> &app_db_entries);
 
-    // Deletes an next hop in the next hop table. Return true on success.
-    ReturnCode removeNextHop(const std::string &next_hop_key);
+    // Processes a batch of entries of the same operation and publishes their
+    // results. Returns the first failure.
+    ReturnCode processEntries(const std::vector<P4NextHopAppDbEntry> &app_db_entries,
+                              const std::vector<swss::KeyOpFieldsValuesTuple> &tuple_list, const std::string &op,
+                              bool update);
 
     // Verifies internal cache for an entry.
     std::string verifyStateCache(const P4NextHopAppDbEntry &app_db_entry, const P4NextHopEntry *next_hop_entry);
@@ -104,6 +110,7 @@ class NextHopManager : public ObjectManagerInterface
     P4OidMapper *m_p4OidMapper;
     ResponsePublisherInterface *m_publisher;
     std::deque<swss::KeyOpFieldsValuesTuple> m_entries;
+    ObjectBulker<sai_next_hop_api_t> m_nextHopBulker;
 
     friend class NextHopManagerTest;
 };
@@ -1,5 +1,8 @@
 #include "p4orch/p4orch_util.h"
 
+#include <ctype.h>
+#include <string.h>
+
 #include "p4orch/p4orch.h"
 #include "schema.h"
 
@@ -31,6 +34,363 @@ void parseP4RTKey(const std::string &key, std::string *table_name, std::string *
     *key_content = key.substr(pos + 1);
 }
 
+namespace
+{
+
+// Maximum nesting of the skipped values of unknown key fields.
+constexpr int kMaxKeyDepth = 32;
+
+// Cursor over a P4RT key being decoded by P4KeyDecoder.
+class KeyScanner
+{
+  public:
+    explicit KeyScanner(const std::string &key) : m_key(key), m_pos(0)
+    {
+    }
+
+    // Skips whitespace and returns the next character, '\0' at the end.
+    char peek()
+    {
+        while (m_pos < m_key.size() &&
+               (m_key[m_pos] == ' ' || m_key[m_pos] == '\t' || m_key[m_pos] == '\n' || m_key[m_pos] == '\r'))
+        {
+            m_pos++;
+        }
+        return m_pos < m_key.size() ? m_key[m_pos] : '\0';
+    }
+
+    bool consume(char c)
+    {
+        if (peek() != c || m_pos == m_key.size())
+        {
+            return false;
+        }
+        m_pos++;
+        return true;
+    }
+
+    bool atEnd()
+    {
+        peek();
+        return m_pos == m_key.size();
+    }
+
+    // Reads a JSON string into str, with its escape sequences decoded.
+    bool readString(std::string *str)
+    {
+        if (!consume('"'))
+        {
+            return false;
+        }
+        str->clear();
+        while (m_pos < m_key.size())
+        {
+            // Copy the characters up to the next quote or escape at once.
+            size_t start = m_pos;
+            while (m_pos < m_key.size() && m_key[m_pos] != '"' && m_key[m_pos] != '\\' &&
+                   static_cast<unsigned char>(m_key[m_pos]) >= 0x20)
+            {
+                m_pos++;
+            }
+            str->append(m_key, start, m_pos - start);
+            if (m_pos == m_key.size())
+            {
+                return false;
+            }
+
+            char c = m_key[m_pos++];
+            if (c == '"')
+            {
+                return true;
+            }
+            if (c != '\\' || m_pos == m_key.size())
+            {
+                return false;
+            }
+            c = m_key[m_pos++];
+            switch (c)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                str->push_back(c);
+                break;
+            case 'b':
+                str->push_back('\b');
+                break;
+            case 'f':
+                str->push_back('\f');
+                break;
+            case 'n':
+                str->push_back('\n');
+                break;
+            case 'r':
+                str->push_back('\r');
+                break;
+            case 't':
+                str->push_back('\t');
+                break;
+            case 'u':
+                if (!readCodePoint(str))
+                {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    // Skips a JSON value of any type.
+    bool skipValue(int depth = 0)
+    {
+        char c = peek();
+        if (c == '"')
+        {
+            return readString(&m_scratch);
+        }
+        if (c == '{' || c == '[')
+        {
+            if (depth >= kMaxKeyDepth)
+            {
+                return false;
+            }
+            char close = (c == '{') ? '}' : ']';
+            m_pos++;
+            if (consume(close))
+            {
+                return true;
+            }
+            do
+            {
+                if (c == '{' && (!readString(&m_scratch) || !consume(':')))
+                {
+                    return false;
+                }
+                if (!skipValue(depth + 1))
+                {
+                    return false;
+                }
+            } while (consume(','));
+            return consume(close);
+        }
+        return skipScalar();
+    }
+
+  private:
+    // Reads the 4 hex digits of a \u escape, and those of the low surrogate
+    // that follows a high one, and appends the code point in UTF-8.
+    bool readCodePoint(std::string *str)
+    {
+        uint32_t cp;
+        if (!readHex4(&cp) || (cp >= 0xDC00 && cp <= 0xDFFF))
+        {
+            return false;
+        }
+        if (cp >= 0xD800 && cp <= 0xDBFF)
+        {
+            uint32_t low;
+            if (m_key.compare(m_pos, 2, "\\u") != 0)
+            {
+                return false;
+            }
+            m_pos += 2;
+            if (!readHex4(&low) || low < 0xDC00 || low > 0xDFFF)
+            {
+                return false;
+            }
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        }
+
+        if (cp < 0x80)
+        {
+            str->push_back(static_cast<char>(cp));
+        }
+        else if (cp < 0x800)
+        {
+            str->push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            str->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            str->push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            str->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            str->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            str->push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            str->push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            str->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            str->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        return true;
+    }
+
+    bool readHex4(uint32_t *value)
+    {
+        if (m_pos + 4 > m_key.size())
+        {
+            return false;
+        }
+        *value = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            char c = m_key[m_pos++];
+            uint32_t digit;
+            if (c >= '0' && c <= '9')
+            {
+                digit = static_cast<uint32_t>(c - '0');
+            }
+            else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            {
+                digit = static_cast<uint32_t>((c | 0x20) - 'a' + 10);
+            }
+            else
+            {
+                return false;
+            }
+            *value = (*value << 4) | digit;
+        }
+        return true;
+    }
+
+    bool skipDigits()
+    {
+        size_t start = m_pos;
+        while (m_pos < m_key.size() && isdigit(static_cast<unsigned char>(m_key[m_pos])))
+        {
+            m_pos++;
+        }
+        return m_pos > start;
+    }
+
+    // Skips true, false, null or a number.
+    bool skipScalar()
+    {
+        for (const char *literal : {"true", "false", "null"})
+        {
+            size_t len = strlen(literal);
+            if (m_key.compare(m_pos, len, literal) == 0)
+            {
+                m_pos += len;
+                return true;
+            }
+        }
+
+        if (m_pos < m_key.size() && m_key[m_pos] == '-')
+        {
+            m_pos++;
+        }
+        if (m_pos < m_key.size() && m_key[m_pos] == '0')
+        {
+            m_pos++;
+        }
+        else if (!skipDigits())
+        {
+            return false;
+        }
+        if (m_pos < m_key.size() && m_key[m_pos] == '.')
+        {
+            m_pos++;
+            if (!skipDigits())
+            {
+                return false;
+            }
+        }
+        if (m_pos < m_key.size() && (m_key[m_pos] == 'e' || m_key[m_pos] == 'E'))
+        {
+            m_pos++;
+            if (m_pos < m_key.size() && (m_key[m_pos] == '+' || m_key[m_pos] == '-'))
+            {
+                m_pos++;
+            }
+            if (!skipDigits())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const std::string &m_key;
+    size_t m_pos;
+    std::string m_scratch;
+};
+
+} // namespace
+
+P4KeyDecoder::P4KeyDecoder(const std::vector<std::string> &match_fields, bool allow_unknown)
+    : m_match_fields(match_fields), m_allow_unknown(allow_unknown)
+{
+    for (size_t i = 0; i < m_match_fields.size(); i++)
+    {
+        m_index[prependMatchField(m_match_fields[i])] = i;
+    }
+}
+
+ReturnCode P4KeyDecoder::decode(const std::string &key, Fields *fields) const
+{
+    fields->values.assign(m_match_fields.size(), std::string());
+    fields->present.assign(m_match_fields.size(), false);
+
+    KeyScanner scanner(key);
+    std::string name;
+    if (!scanner.consume('{'))
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid key " << QuotedVar(key)
+                                                             << ": should be a JSON object";
+    }
+    if (!scanner.consume('}'))
+    {
+        do
+        {
+            if (!scanner.readString(&name) || !scanner.consume(':'))
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to decode key " << QuotedVar(key);
+            }
+            auto it = m_index.find(name);
+            if (it == m_index.end())
+            {
+                if (!m_allow_unknown)
+                {
+                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                           << "Invalid match field " << QuotedVar(name) << " in key " << QuotedVar(key);
+                }
+                if (!scanner.skipValue())
+                {
+                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to decode key " << QuotedVar(key);
+                }
+                continue;
+            }
+            if (scanner.peek() != '"')
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Invalid value of match field " << QuotedVar(name) << " in key " << QuotedVar(key)
+                       << ": should be a string";
+            }
+            if (!scanner.readString(&fields->values[it->second]))
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to decode key " << QuotedVar(key);
+            }
+            fields->present[it->second] = true;
+        } while (scanner.consume(','));
+
+        if (!scanner.consume('}'))
+        {
+            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to decode key " << QuotedVar(key);
+        }
+    }
+    if (!scanner.atEnd())
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to decode key " << QuotedVar(key);
+    }
+
+    return ReturnCode();
+}
+
 std::string verifyAttrs(const std::vector<swss::FieldValueTuple> &targets,
                         const std::vector<swss::FieldValueTuple> &exp, const std::vector<swss::FieldValueTuple> &opt,
                         bool allow_unknown)
@@ -3,6 +3,7 @@
 #include <deque>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -110,6 +111,43 @@ std::string prependMatchField(const std::string &str);
 // Prepends "param/" to the input string str to construct a new string.
 std::string prependParamField(const std::string &str);
 
+// P4KeyDecoder decodes the match fields of a P4RT table key, e.g.
+// {"match/vrf_id":"b4-traffic","match/ipv4_dst":"10.11.12.0/24"}, in a single
+// pass over the key without building a JSON document. A decoder is built once
+// per table from the names of its match fields and shared by all its entries.
+class P4KeyDecoder
+{
+  public:
+    // Match field values of a decoded key, in the order of the match fields
+    // the decoder was built from.
+    struct Fields
+    {
+        std::vector<std::string> values;
+        std::vector<bool> present;
+    };
+
+    // match_fields: the match field names, without the "match/" prefix.
+    // allow_unknown: if set to false, decoding fails on a key field that is not
+    //                one of the match fields. Such fields are skipped otherwise,
+    //                whatever the type of their value.
+    P4KeyDecoder(const std::vector<std::string> &match_fields, bool allow_unknown = true);
+
+    // Decodes key into fields. The values of the match fields must be strings.
+    // Returns SWSS_RC_INVALID_PARAM if key is not a valid JSON object.
+    ReturnCode decode(const std::string &key, Fields *fields) const;
+
+    const std::vector<std::string> &getMatchFields() const
+    {
+        return m_match_fields;
+    }
+
+  private:
+    std::vector<std::string> m_match_fields;
+    // "match/<name>" to the index of the match field.
+    std::unordered_map<std::string, size_t> m_index;
+    bool m_allow_unknown;
+};
+
 struct ActionParamInfo
 {
     std::string name;
@@ -148,6 +186,7 @@ struct TableInfo
     bool counter_packets_enabled;
     std::vector<std::string> action_ref_tables;
     // list of tables across all actions, of current table, refer to
+    std::shared_ptr<P4KeyDecoder> key_decoder;
 };
 
 /**
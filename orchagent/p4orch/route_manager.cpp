@@ -1,7 +1,6 @@
 #include "p4orch/route_manager.h"
 
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -334,38 +333,26 @@ ReturnCodeOr<P4RouteEntry> RouteManager::deserializeRouteEntry(const std::string
 {
     SWSS_LOG_ENTER();
 
+    static const P4KeyDecoder ipv4_key_decoder({p4orch::kVrfId, p4orch::kIpv4Dst});
+    static const P4KeyDecoder ipv6_key_decoder({p4orch::kVrfId, p4orch::kIpv6Dst});
+
     P4RouteEntry route_entry = {};
     std::string route_prefix;
-    try
+    bool is_ipv4 = (table_name == APP_P4RT_IPV4_TABLE_NAME);
+    P4KeyDecoder::Fields fields;
+    if (!(is_ipv4 ? ipv4_key_decoder : ipv6_key_decoder).decode(key, &fields).ok() || !fields.present[0])
     {
-        nlohmann::json j = nlohmann::json::parse(key);
-        route_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
-        if (table_name == APP_P4RT_IPV4_TABLE_NAME)
-        {
-            if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv4Dst)];
-            }
-            else
-            {
-                route_prefix = "0.0.0.0/0";
-            }
-        }
-        else
-        {
-            if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv6Dst)];
-            }
-            else
-            {
-                route_prefix = "::/0";
-            }
-        }
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
-    catch (std::exception &ex)
+    route_entry.vrf_id = fields.values[0];
+    // A missing destination is the default route.
+    if (fields.present[1])
     {
-        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
+        route_prefix = fields.values[1];
+    }
+    else
+    {
+        route_prefix = is_ipv4 ? "0.0.0.0/0" : "::/0";
     }
     try
     {
@@ -2,7 +2,6 @@
 
 #include <map>
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -32,6 +31,12 @@ extern Directory<Orch *> gDirectory;
 namespace
 {
 
+const P4KeyDecoder &routerInterfaceKeyDecoder()
+{
+    static const P4KeyDecoder decoder({p4orch::kRouterInterfaceId});
+    return decoder;
+}
+
 ReturnCode validateRouterInterfaceAppDbEntry(const P4RouterInterfaceAppDbEntry &app_db_entry)
 {
     // Perform generic APP DB entry validations. Operation specific validations
@@ -135,15 +140,12 @@ ReturnCodeOr<P4RouterInterfaceAppDbEntry> RouterInterfaceManager::deserializeRou
     SWSS_LOG_ENTER();
 
     P4RouterInterfaceAppDbEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_interface_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-    }
-    catch (std::exception &ex)
+    P4KeyDecoder::Fields fields;
+    if (!routerInterfaceKeyDecoder().decode(key, &fields).ok() || !fields.present[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize router interface id";
     }
+    app_db_entry.router_interface_id = fields.values[0];
 
     for (const auto &it : attributes)
     {
@@ -349,27 +351,21 @@ ReturnCode RouterInterfaceManager::processDeleteRequest(const std::string &route
 ReturnCode RouterInterfaceManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                                 std::string &object_key)
 {
-    std::string value;
+    P4KeyDecoder::Fields fields;
 
-    try
+    if (!routerInterfaceKeyDecoder().decode(json_key, &fields).ok())
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            object_key = KeyGenerator::generateRouterInterfaceKey(value);
-            object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (!fields.present[0])
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kRouterInterfaceId);
+    }
+    else
+    {
+        object_key = KeyGenerator::generateRouterInterfaceKey(fields.values[0]);
+        object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
+        return ReturnCode();
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <nlohmann/json.hpp>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -241,6 +242,16 @@ ReturnCode parseTablesInfo(const nlohmann::json &info_json, TablesInfo &info_ent
                 table.match_fields[match_name] = match;
             }
 
+            // The key decoder lists the match fields in name order, the order
+            // they are passed to SAI in.
+            std::set<std::string> match_names;
+            for (const auto &match : table.match_fields)
+            {
+                match_names.insert(match.first);
+            }
+            table.key_decoder = std::make_shared<P4KeyDecoder>(
+                std::vector<std::string>(match_names.begin(), match_names.end()), /*allow_unknown=*/false);
+
             for (const auto &action_json : table_json[p4orch::kActions])
             {
                 ActionInfo action = {};
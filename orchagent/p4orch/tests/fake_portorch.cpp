@@ -427,7 +427,7 @@ void PortsOrch::removeDefaultBridgePorts()
 {
 }
 
-void PortsOrch::initializePortBufferMaximumParameters(const Port &port)
+void PortsOrch::initializePortBufferMaximumParameters(const std::vector<Port *> &ports)
 {
 }
 
@@ -17,8 +17,11 @@
 using ::p4orch::kTableKeyDelimiter;
 
 using ::testing::_;
+using ::testing::DoAll;
 using ::testing::Eq;
+using ::testing::Pointee;
 using ::testing::Return;
+using ::testing::SetArrayArgument;
 using ::testing::StrictMock;
 using ::testing::Truly;
 
@@ -104,6 +107,14 @@ bool MatchNeighborCreateAttributeList(const sai_attribute_t *attr_list, const sw
     return true;
 }
 
+bool MatchNeighborCreateAttributeLists(const sai_attribute_t **attr_list, const swss::MacAddress &dst_mac_address)
+{
+    if (attr_list == nullptr)
+        return false;
+
+    return MatchNeighborCreateAttributeList(attr_list[0], dst_mac_address);
+}
+
 bool MatchNeighborSetAttributeList(const sai_attribute_t *attr_list, const swss::MacAddress &dst_mac_address)
 {
     if (attr_list == nullptr)
@@ -122,6 +133,13 @@ class NeighborManagerTest : public ::testing::Test
     {
     }
 
+    // The bulker copies the bulk API pointers when the manager is constructed.
+    static void SetUpTestCase()
+    {
+        sai_neighbor_api->create_neighbor_entries = mock_create_neighbor_entries;
+        sai_neighbor_api->remove_neighbor_entries = mock_remove_neighbor_entries;
+    }
+
     void SetUp() override
     {
         mock_sai_neighbor = &mock_sai_neighbor_;
@@ -164,32 +182,49 @@ class NeighborManagerTest : public ::testing::Test
 
     ReturnCode CreateNeighbor(P4NeighborEntry &neighbor_entry)
     {
-        return neighbor_manager_.createNeighbor(neighbor_entry);
+        P4NeighborAppDbEntry app_db_entry = {.router_intf_id = neighbor_entry.router_intf_id,
+                                             .neighbor_id = neighbor_entry.neighbor_id,
+                                             .dst_mac_address = neighbor_entry.dst_mac_address,
+                                             .is_set_dst_mac = true};
+        auto status = CreateNeighbors({app_db_entry})[0];
+        auto *created_entry = GetNeighborEntry(neighbor_entry.neighbor_key);
+        if (status.ok() && created_entry != nullptr)
+        {
+            neighbor_entry.neigh_entry = created_entry->neigh_entry;
+        }
+        return status;
     }
 
     ReturnCode RemoveNeighbor(const std::string &neighbor_key)
     {
-        return neighbor_manager_.removeNeighbor(neighbor_key);
+        auto *neighbor_entry = GetNeighborEntry(neighbor_key);
+        if (neighbor_entry == nullptr)
+        {
+            return neighbor_manager_.checkNeighborRemoval(neighbor_key);
+        }
+        P4NeighborAppDbEntry app_db_entry = {.router_intf_id = neighbor_entry->router_intf_id,
+                                             .neighbor_id = neighbor_entry->neighbor_id};
+        return RemoveNeighbors({app_db_entry})[0];
     }
 
-    ReturnCode SetDstMacAddress(P4NeighborEntry *neighbor_entry, const swss::MacAddress &mac_address)
+    std::vector<ReturnCode> CreateNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries)
     {
-        return neighbor_manager_.setDstMacAddress(neighbor_entry, mac_address);
+        return neighbor_manager_.createNeighbors(app_db_entries);
     }
 
-    ReturnCode ProcessAddRequest(const P4NeighborAppDbEntry &app_db_entry, const std::string &neighbor_key)
+    std::vector<ReturnCode> RemoveNeighbors(const std::vector<P4NeighborAppDbEntry> &app_db_entries)
     {
-        return neighbor_manager_.processAddRequest(app_db_entry, neighbor_key);
+        return neighbor_manager_.removeNeighbors(app_db_entries);
     }
 
-    ReturnCode ProcessUpdateRequest(const P4NeighborAppDbEntry &app_db_entry, P4NeighborEntry *neighbor_entry)
+    ReturnCode SetDstMacAddress(P4NeighborEntry *neighbor_entry, const swss::MacAddress &mac_address)
     {
-        return neighbor_manager_.processUpdateRequest(app_db_entry, neighbor_entry);
+        return neighbor_manager_.setDstMacAddress(neighbor_entry, mac_address);
     }
 
-    ReturnCode ProcessDeleteRequest(const std::string &neighbor_key)
+    ReturnCode ProcessUpdateRequest(const P4NeighborAppDbEntry &app_db_entry, P4NeighborEntry *neighbor_entry)
     {
-        return neighbor_manager_.processDeleteRequest(neighbor_key);
+        return neighbor_manager_.processUpdateRequest(app_db_entry, neighbor_entry);
     }
 
     P4NeighborEntry *GetNeighborEntry(const std::string &neighbor_key)
@@ -241,12 +276,15 @@ class NeighborManagerTest : public ::testing::Test
         copy(neigh_entry.ip_address, neighbor_entry.neighbor_id);
         neigh_entry.rif_id = router_intf_oid;
 
+        std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
         EXPECT_CALL(mock_sai_neighbor_,
-                    create_neighbor_entry(Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neigh_entry)),
-                                          Eq(2),
-                                          Truly(std::bind(MatchNeighborCreateAttributeList, std::placeholders::_1,
-                                                          neighbor_entry.dst_mac_address))))
-            .WillOnce(Return(SAI_STATUS_SUCCESS));
+                    create_neighbor_entries(Eq(1),
+                                            Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neigh_entry)),
+                                            Pointee(Eq(2)),
+                                            Truly(std::bind(MatchNeighborCreateAttributeLists, std::placeholders::_1,
+                                                            neighbor_entry.dst_mac_address)),
+                                            _, _))
+            .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
 
         ASSERT_TRUE(
             p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry.router_intf_key, router_intf_oid));
@@ -317,7 +355,9 @@ TEST_F(NeighborManagerTest, CreateNeighborSaiApiFails)
 
     ASSERT_TRUE(
         p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, neighbor_entry.router_intf_key, kRouterInterfaceOid1));
-    EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entry(_, _, _)).WillOnce(Return(SAI_STATUS_FAILURE));
+    std::vector<sai_status_t> exp_status{SAI_STATUS_FAILURE};
+    EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entries(Eq(1), _, _, _, _, _))
+        .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_FAILURE)));
 
     EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN, CreateNeighbor(neighbor_entry));
 
@@ -334,9 +374,11 @@ TEST_F(NeighborManagerTest, RemoveNeighborExistingNeighborEntry)
     copy(neigh_entry.ip_address, neighbor_entry.neighbor_id);
     neigh_entry.rif_id = kRouterInterfaceOid2;
 
+    std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
     EXPECT_CALL(mock_sai_neighbor_,
-                remove_neighbor_entry(Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neigh_entry))))
-        .WillOnce(Return(SAI_STATUS_SUCCESS));
+                remove_neighbor_entries(
+                    Eq(1), Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neigh_entry)), _, _))
+        .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
 
     EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, RemoveNeighbor(neighbor_entry.neighbor_key));
 
@@ -375,7 +417,9 @@ TEST_F(NeighborManagerTest, RemoveNeighborSaiApiFails)
     P4NeighborEntry neighbor_entry(kRouterInterfaceId2, kNeighborId2, kMacAddress2);
     AddNeighborEntry(neighbor_entry, kRouterInterfaceOid2);
 
-    EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entry(_)).WillOnce(Return(SAI_STATUS_FAILURE));
+    std::vector<sai_status_t> exp_status{SAI_STATUS_FAILURE};
+    EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entries(Eq(1), _, _, _))
+        .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_FAILURE)));
 
     EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN, RemoveNeighbor(neighbor_entry.neighbor_key));
 
@@ -421,7 +465,7 @@ TEST_F(NeighborManagerTest, SetDstMacAddressSaiApiFails)
     EXPECT_EQ(neighbor_entry.dst_mac_address, kMacAddress2);
 }
 
-TEST_F(NeighborManagerTest, ProcessAddRequestValidAppDbParams)
+TEST_F(NeighborManagerTest, CreateNeighborsValidAppDbParams)
 {
     const P4NeighborAppDbEntry app_db_entry = {.router_intf_id = kRouterInterfaceId1,
                                                .neighbor_id = kNeighborId1,
@@ -433,49 +477,46 @@ TEST_F(NeighborManagerTest, ProcessAddRequestValidAppDbParams)
     copy(neighbor_entry.neigh_entry.ip_address, app_db_entry.neighbor_id);
     neighbor_entry.neigh_entry.rif_id = kRouterInterfaceOid1;
 
+    std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
     EXPECT_CALL(
         mock_sai_neighbor_,
-        create_neighbor_entry(
-            Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neighbor_entry.neigh_entry)), Eq(2),
-            Truly(std::bind(MatchNeighborCreateAttributeList, std::placeholders::_1, app_db_entry.dst_mac_address))))
-        .WillOnce(Return(SAI_STATUS_SUCCESS));
+        create_neighbor_entries(
+            Eq(1), Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neighbor_entry.neigh_entry)),
+            Pointee(Eq(2)),
+            Truly(std::bind(MatchNeighborCreateAttributeLists, std::placeholders::_1, app_db_entry.dst_mac_address)),
+            _, _))
+        .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
 
     ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
                                       KeyGenerator::generateRouterInterfaceKey(app_db_entry.router_intf_id),
                                       neighbor_entry.neigh_entry.rif_id));
 
-    const std::string neighbor_key =
-        KeyGenerator::generateNeighborKey(app_db_entry.router_intf_id, app_db_entry.neighbor_id);
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(app_db_entry, neighbor_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNeighbors({app_db_entry})[0]);
 
     ValidateNeighborEntry(neighbor_entry, /*router_intf_ref_count=*/1);
 }
 
-TEST_F(NeighborManagerTest, ProcessAddRequesDstMacAddressNotSet)
+TEST_F(NeighborManagerTest, CreateNeighborsDstMacAddressNotSet)
 {
     const P4NeighborAppDbEntry app_db_entry = {.router_intf_id = kRouterInterfaceId1,
                                                .neighbor_id = kNeighborId1,
                                                .dst_mac_address = swss::MacAddress(),
                                                .is_set_dst_mac = false};
 
-    const std::string neighbor_key =
-        KeyGenerator::generateNeighborKey(app_db_entry.router_intf_id, app_db_entry.neighbor_id);
-    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessAddRequest(app_db_entry, neighbor_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, CreateNeighbors({app_db_entry})[0]);
 
     P4NeighborEntry neighbor_entry(app_db_entry.router_intf_id, app_db_entry.neighbor_id, app_db_entry.dst_mac_address);
     ValidateNeighborEntryNotPresent(neighbor_entry, /*check_ref_count=*/false);
 }
 
-TEST_F(NeighborManagerTest, ProcessAddRequestInvalidRouterInterface)
+TEST_F(NeighborManagerTest, CreateNeighborsInvalidRouterInterface)
 {
     const P4NeighborAppDbEntry app_db_entry = {.router_intf_id = kRouterInterfaceId1,
                                                .neighbor_id = kNeighborId1,
                                                .dst_mac_address = kMacAddress1,
                                                .is_set_dst_mac = true};
 
-    const std::string neighbor_key =
-        KeyGenerator::generateNeighborKey(app_db_entry.router_intf_id, app_db_entry.neighbor_id);
-    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRequest(app_db_entry, neighbor_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, CreateNeighbors({app_db_entry})[0]);
 
     P4NeighborEntry neighbor_entry(app_db_entry.router_intf_id, app_db_entry.neighbor_id, app_db_entry.dst_mac_address);
     ValidateNeighborEntryNotPresent(neighbor_entry, /*check_ref_count=*/false);
@@ -533,7 +574,7 @@ TEST_F(NeighborManagerTest, ProcessUpdateRequestSetDstMacAddressFails)
     ValidateNeighborEntry(neighbor_entry, /*router_intf_ref_count=*/1);
 }
 
-TEST_F(NeighborManagerTest, ProcessDeleteRequestExistingNeighborEntry)
+TEST_F(NeighborManagerTest, RemoveNeighborsExistingNeighborEntry)
 {
     P4NeighborEntry neighbor_entry(kRouterInterfaceId1, kNeighborId1, kMacAddress1);
     AddNeighborEntry(neighbor_entry, kRouterInterfaceOid1);
@@ -542,19 +583,23 @@ TEST_F(NeighborManagerTest, ProcessDeleteRequestExistingNeighborEntry)
     copy(neighbor_entry.neigh_entry.ip_address, neighbor_entry.neighbor_id);
     neighbor_entry.neigh_entry.rif_id = kRouterInterfaceOid1;
 
-    EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entry(Truly(std::bind(MatchNeighborEntry, std::placeholders::_1,
-                                                                          neighbor_entry.neigh_entry))))
-        .WillOnce(Return(SAI_STATUS_SUCCESS));
+    std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
+    EXPECT_CALL(mock_sai_neighbor_,
+                remove_neighbor_entries(
+                    Eq(1), Truly(std::bind(MatchNeighborEntry, std::placeholders::_1, neighbor_entry.neigh_entry)), _,
+                    _))
+        .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessDeleteRequest(neighbor_entry.neighbor_key));
+    const P4NeighborAppDbEntry app_db_entry = {.router_intf_id = kRouterInterfaceId1, .neighbor_id = kNeighborId1};
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, RemoveNeighbors({app_db_entry})[0]);
 
     ValidateNeighborEntryNotPresent(neighbor_entry, /*check_ref_count=*/true);
 }
 
-TEST_F(NeighborManagerTest, ProcessDeleteRequestNonExistingNeighborEntry)
+TEST_F(NeighborManagerTest, RemoveNeighborsNonExistingNeighborEntry)
 {
-    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND,
-              ProcessDeleteRequest(KeyGenerator::generateNeighborKey(kRouterInterfaceId1, kNeighborId1)));
+    const P4NeighborAppDbEntry app_db_entry = {.router_intf_id = kRouterInterfaceId1, .neighbor_id = kNeighborId1};
+    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, RemoveNeighbors({app_db_entry})[0]);
 }
 
 TEST_F(NeighborManagerTest, DeserializeNeighborEntryValidAttributes)
@@ -735,7 +780,9 @@ TEST_F(NeighborManagerTest, DrainValidAttributes)
     attributes.push_back(swss::FieldValueTuple{prependParamField(p4orch::kDstMac), kMacAddress1.to_string()});
     Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key, SET_COMMAND, attributes));
 
-    EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entry(_, _, _)).WillOnce(Return(SAI_STATUS_SUCCESS));
+    std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
+    EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entries(Eq(1), _, _, _, _, _))
+        .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
     EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key),
                                     Eq(attributes),
                                     Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
@@ -765,7 +812,8 @@ TEST_F(NeighborManagerTest, DrainValidAttributes)
     attributes.clear();
     Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key, DEL_COMMAND, attributes));
 
-    EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entry(_)).WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entries(Eq(1), _, _, _))
+        .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()), Return(SAI_STATUS_SUCCESS)));
     EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key),
                                     Eq(attributes),
                                     Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
@@ -945,9 +993,13 @@ TEST_F(NeighborManagerTest, DrainStopOnFirstFailure) {
   Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key_2, SET_COMMAND, attributes));
   Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key_3, SET_COMMAND, attributes));
 
-  EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entry(_, _, _))
-      .WillOnce(Return(SAI_STATUS_SUCCESS))
-      .WillOnce(Return(SAI_STATUS_FAILURE));
+  // All three entries are created in one bulk call.
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE,
+                                       SAI_STATUS_NOT_EXECUTED};
+  EXPECT_CALL(mock_sai_neighbor_,
+              create_neighbor_entries(Eq(3), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_FAILURE)));
   EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key_1),
                                   Eq(attributes),
                                   Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
@@ -967,6 +1019,59 @@ TEST_F(NeighborManagerTest, DrainStopOnFirstFailure) {
                          kRouterInterfaceId3, kNeighborId1)));
 }
 
+TEST_F(NeighborManagerTest, DrainSplitsBatchOnRepeatedNeighbor) {
+  ASSERT_TRUE(p4_oid_mapper_.setOID(
+      SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+      KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId1),
+      kRouterInterfaceOid1));
+  ASSERT_TRUE(p4_oid_mapper_.setOID(
+      SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+      KeyGenerator::generateRouterInterfaceKey(kRouterInterfaceId2),
+      kRouterInterfaceOid2));
+
+  const std::string appl_db_key_1 =
+      std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+      CreateNeighborAppDbKey(kRouterInterfaceId1, kNeighborId1);
+  const std::string appl_db_key_2 =
+      std::string(APP_P4RT_NEIGHBOR_TABLE_NAME) + kTableKeyDelimiter +
+      CreateNeighborAppDbKey(kRouterInterfaceId2, kNeighborId1);
+
+  std::vector<swss::FieldValueTuple> attributes;
+  attributes.push_back(swss::FieldValueTuple{prependParamField(p4orch::kDstMac),
+                                             kMacAddress1.to_string()});
+  Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key_1, SET_COMMAND, attributes));
+  Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key_2, SET_COMMAND, attributes));
+  Enqueue(swss::KeyOpFieldsValuesTuple(appl_db_key_1, DEL_COMMAND, {}));
+
+  // The deletion of the first neighbor waits for its creation.
+  std::vector<sai_status_t> exp_create_status{SAI_STATUS_SUCCESS,
+                                              SAI_STATUS_SUCCESS};
+  std::vector<sai_status_t> exp_remove_status{SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_neighbor_,
+              create_neighbor_entries(Eq(2), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_create_status.begin(),
+                                          exp_create_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entries(Eq(1), _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<3>(exp_remove_status.begin(),
+                                          exp_remove_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key_1),
+                                  Eq(attributes),
+                                  Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key_2),
+                                  Eq(attributes),
+                                  Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME), Eq(appl_db_key_1),
+                                  Eq(std::vector<swss::FieldValueTuple>{}),
+                                  Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, Drain(/*failure_before=*/false));
+  EXPECT_EQ(nullptr, GetNeighborEntry(KeyGenerator::generateNeighborKey(
+                         kRouterInterfaceId1, kNeighborId1)));
+  EXPECT_NE(nullptr, GetNeighborEntry(KeyGenerator::generateNeighborKey(
+                         kRouterInterfaceId2, kNeighborId1)));
+}
+
 TEST_F(NeighborManagerTest, VerifyStateTest)
 {
     P4NeighborEntry neighbor_entry(kRouterInterfaceId1, kNeighborId1, kMacAddress1);
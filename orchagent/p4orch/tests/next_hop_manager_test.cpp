@@ -28,8 +28,12 @@ using ::p4orch::kTableKeyDelimiter;
 using ::testing::_;
 using ::testing::DoAll;
 using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::NotNull;
+using ::testing::Pointee;
 using ::testing::Return;
 using ::testing::SetArgPointee;
+using ::testing::SetArrayArgument;
 using ::testing::StrictMock;
 using ::testing::Truly;
 
@@ -224,6 +228,19 @@ bool MatchCreateNextHopArgAttrList(const sai_attribute_t *attr_list,
     return true;
 }
 
+// Verifies whether the attribute list of the only entry of SAI next hop's
+// create_next_hops() is the same as expected.
+bool MatchCreateNextHopArgAttrLists(const sai_attribute_t **attr_list,
+                                    const std::unordered_map<sai_attr_id_t, sai_attribute_value_t> &expected_attr_list)
+{
+    if (attr_list == nullptr)
+    {
+        return false;
+    }
+
+    return MatchCreateNextHopArgAttrList(attr_list[0], expected_attr_list);
+}
+
 } // namespace
 
 class NextHopManagerTest : public ::testing::Test
@@ -250,6 +267,13 @@ class NextHopManagerTest : public ::testing::Test
         delete copp_orch_;
     }
 
+    // The bulker copies the bulk API pointers when the manager is constructed.
+    static void SetUpTestCase()
+    {
+        sai_next_hop_api->create_next_hops = mock_create_next_hops;
+        sai_next_hop_api->remove_next_hops = mock_remove_next_hops;
+    }
+
     void SetUp() override
     {
         // Set up mock stuff for SAI next hop API structure.
@@ -285,9 +309,9 @@ class NextHopManagerTest : public ::testing::Test
         return next_hop_manager_.verifyState(key, tuple);
     }
 
-    ReturnCode ProcessAddRequest(const P4NextHopAppDbEntry &app_db_entry)
+    ReturnCode CreateNextHop(const P4NextHopAppDbEntry &app_db_entry)
     {
-        return next_hop_manager_.processAddRequest(app_db_entry);
+        return next_hop_manager_.createNextHops({app_db_entry})[0];
     }
 
     ReturnCode ProcessUpdateRequest(const P4NextHopAppDbEntry &app_db_entry, P4NextHopEntry *next_hop_entry)
@@ -295,9 +319,11 @@ class NextHopManagerTest : public ::testing::Test
         return next_hop_manager_.processUpdateRequest(app_db_entry, next_hop_entry);
     }
 
-    ReturnCode ProcessDeleteRequest(const std::string &next_hop_key)
+    ReturnCode RemoveNextHop(const std::string &next_hop_id)
     {
-        return next_hop_manager_.processDeleteRequest(next_hop_key);
+        P4NextHopAppDbEntry app_db_entry = {};
+        app_db_entry.next_hop_id = next_hop_id;
+        return next_hop_manager_.removeNextHops({app_db_entry})[0];
     }
 
     P4NextHopEntry *GetNextHopEntry(const std::string &next_hop_key)
@@ -317,13 +343,13 @@ class NextHopManagerTest : public ::testing::Test
     bool ResolveNextHopEntryDependency(const P4NextHopAppDbEntry &app_db_entry, const sai_object_id_t &rif_oid);
 
     // Adds the next hop entry -- kP4NextHopAppDbEntry1, via next hop manager's
-    // ProcessAddRequest (). This function also takes care of all the dependencies
+    // CreateNextHop(). This function also takes care of all the dependencies
     // of the next hop entry.
     // Returns a valid pointer to next hop entry on success.
     P4NextHopEntry *AddNextHopEntry1();
 
     // Adds the next hop entry -- kP4TunnelNextHopAppDbEntry1, via next hop
-    // manager's ProcessAddRequest (). This function also takes care of all the
+    // manager's CreateNextHop(). This function also takes care of all the
     // dependencies of the next hop entry. Returns a valid pointer to next hop
     // entry on success.
     P4NextHopEntry *AddTunnelNextHopEntry1();
@@ -402,13 +428,15 @@ P4NextHopEntry *NextHopManagerTest::AddNextHopEntry1()
 
     // Set up mock call.
     EXPECT_CALL(mock_sai_next_hop_,
-                create_next_hop(
-                    ::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                    Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1)))))
-        .WillOnce(DoAll(SetArgPointee<0>(kNextHopOid), Return(SAI_STATUS_SUCCESS)));
+                create_next_hops(
+                    Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                    Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1))),
+                    _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<5>(kNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNextHop(kP4NextHopAppDbEntry1));
 
     return GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id));
 }
@@ -423,13 +451,15 @@ P4NextHopEntry *NextHopManagerTest::AddTunnelNextHopEntry1()
     // Set up mock call.
     EXPECT_CALL(
         mock_sai_next_hop_,
-        create_next_hop(::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                        Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                        CreateAttributeListForNextHopObject(kP4TunnelNextHopAppDbEntry1, kTunnelOid1,
-                                                                            swss::IpAddress(kNeighborId1))))))
-        .WillOnce(DoAll(SetArgPointee<0>(kTunnelNextHopOid), Return(SAI_STATUS_SUCCESS)));
+        create_next_hops(Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                         Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                         CreateAttributeListForNextHopObject(kP4TunnelNextHopAppDbEntry1, kTunnelOid1,
+                                                                             swss::IpAddress(kNeighborId1)))),
+                         _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<5>(kTunnelNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(kP4TunnelNextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNextHop(kP4TunnelNextHopAppDbEntry1));
 
     return GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4TunnelNextHopAppDbEntry1.next_hop_id));
 }
@@ -467,7 +497,7 @@ bool NextHopManagerTest::ValidateNextHopEntryAdd(const P4NextHopAppDbEntry &app_
     return true;
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldSucceedAddingNewNextHop)
+TEST_F(NextHopManagerTest, CreateNextHopShouldSucceedAddingNewNextHop)
 {
     ASSERT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry1, kRouterInterfaceOid1));
 
@@ -481,84 +511,87 @@ TEST_F(NextHopManagerTest, ProcessAddRequestShouldSucceedAddingNewNextHop)
 
     // Set up mock call.
     EXPECT_CALL(mock_sai_next_hop_,
-                create_next_hop(
-                    ::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                    Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1)))))
-        .WillOnce(DoAll(SetArgPointee<0>(kNextHopOid), Return(SAI_STATUS_SUCCESS)));
+                create_next_hops(
+                    Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                    Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1))),
+                    _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<5>(kNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNextHop(kP4NextHopAppDbEntry1));
 
     EXPECT_TRUE(ValidateNextHopEntryAdd(kP4NextHopAppDbEntry1, kNextHopOid));
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_ROUTER_INTERFACE, rif_key, original_rif_ref_count + 1));
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, original_neighbor_ref_count + 1));
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldFailWhenNextHopExistInCentralMapper)
+TEST_F(NextHopManagerTest, CreateNextHopShouldFailWhenNextHopExistInCentralMapper)
 {
     ASSERT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry1, kRouterInterfaceOid1));
     ASSERT_TRUE(p4_oid_mapper_.setOID(
         SAI_OBJECT_TYPE_NEXT_HOP, KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id), kNextHopOid));
     // TODO: Expect critical state.
-    EXPECT_EQ(StatusCode::SWSS_RC_INTERNAL, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_INTERNAL, CreateNextHop(kP4NextHopAppDbEntry1));
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldFailWhenDependingRifIsAbsentInCentralMapper)
+TEST_F(NextHopManagerTest, CreateNextHopShouldFailWhenDependingRifIsAbsentInCentralMapper)
 {
     const std::string neighbor_key =
         KeyGenerator::generateNeighborKey(kP4NextHopAppDbEntry1.router_interface_id, kP4NextHopAppDbEntry1.neighbor_id);
     ASSERT_TRUE(p4_oid_mapper_.setDummyOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, CreateNextHop(kP4NextHopAppDbEntry1));
 
     EXPECT_EQ(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id)), nullptr);
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldFailWhenDependingTunnelIsAbsentInCentralMapper)
+TEST_F(NextHopManagerTest, CreateNextHopShouldFailWhenDependingTunnelIsAbsentInCentralMapper)
 {
     const std::string neighbor_key =
         KeyGenerator::generateNeighborKey(kP4TunnelNextHopAppDbEntry1.router_interface_id, kP4TunnelEntry1.neighbor_id);
     ASSERT_TRUE(p4_oid_mapper_.setDummyOID(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRequest(kP4TunnelNextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, CreateNextHop(kP4TunnelNextHopAppDbEntry1));
 
     EXPECT_EQ(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4TunnelNextHopAppDbEntry1.next_hop_id)), nullptr);
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldFailWhenDependingNeigherIsAbsentInCentralMapper)
+TEST_F(NextHopManagerTest, CreateNextHopShouldFailWhenDependingNeigherIsAbsentInCentralMapper)
 {
     const std::string rif_key = KeyGenerator::generateRouterInterfaceKey(kP4NextHopAppDbEntry1.router_interface_id);
     ASSERT_TRUE(p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE, rif_key, kRouterInterfaceOid1));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, CreateNextHop(kP4NextHopAppDbEntry1));
 
     EXPECT_EQ(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id)), nullptr);
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldFailWhenSaiCallFails)
+TEST_F(NextHopManagerTest, CreateNextHopShouldFailWhenSaiCallFails)
 {
     ASSERT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry1, kRouterInterfaceOid1));
 
     // Set up mock call.
     EXPECT_CALL(mock_sai_next_hop_,
-                create_next_hop(
-                    ::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                    Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1)))))
-        .WillOnce(Return(SAI_STATUS_FAILURE));
+                create_next_hops(
+                    Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                    Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1))),
+                    _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<6>(SAI_STATUS_FAILURE), Return(SAI_STATUS_FAILURE)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN, CreateNextHop(kP4NextHopAppDbEntry1));
 
     // The add request failed for the next hop entry.
     EXPECT_EQ(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id)), nullptr);
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldDoNoOpForDuplicateAddRequest)
+TEST_F(NextHopManagerTest, CreateNextHopShouldDoNoOpForDuplicateAddRequest)
 {
     ASSERT_NE(AddNextHopEntry1(), nullptr);
 
     // Add the same next hop entry again.
-    EXPECT_EQ(StatusCode::SWSS_RC_EXISTS, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_EXISTS, CreateNextHop(kP4NextHopAppDbEntry1));
 
     // Adding the same next hop entry multiple times should have the same outcome
     // as adding it once.
@@ -570,25 +603,27 @@ TEST_F(NextHopManagerTest, ProcessAddRequestShouldDoNoOpForDuplicateAddRequest)
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, 1));
 }
 
-TEST_F(NextHopManagerTest, ProcessAddRequestShouldSuccessForTunnelNexthop)
+TEST_F(NextHopManagerTest, CreateNextHopShouldSuccessForTunnelNexthop)
 {
     ASSERT_TRUE(ResolveNextHopEntryDependency(kP4TunnelNextHopAppDbEntry1, kTunnelOid1));
 
     // Set up mock call.
     EXPECT_CALL(
         mock_sai_next_hop_,
-        create_next_hop(::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                        Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                        CreateAttributeListForNextHopObject(kP4TunnelNextHopAppDbEntry1, kTunnelOid1,
-                                                                            swss::IpAddress(kNeighborId1))))))
-        .WillOnce(DoAll(SetArgPointee<0>(kTunnelNextHopOid), Return(SAI_STATUS_SUCCESS)));
+        create_next_hops(Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                         Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                         CreateAttributeListForNextHopObject(kP4TunnelNextHopAppDbEntry1, kTunnelOid1,
+                                                                             swss::IpAddress(kNeighborId1)))),
+                         _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<5>(kTunnelNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(kP4TunnelNextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNextHop(kP4TunnelNextHopAppDbEntry1));
 
     EXPECT_NE(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4TunnelNextHopAppDbEntry1.next_hop_id)), nullptr);
 
     // Add the same next hop entry again.
-    EXPECT_EQ(StatusCode::SWSS_RC_EXISTS, ProcessAddRequest(kP4TunnelNextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_EXISTS, CreateNextHop(kP4TunnelNextHopAppDbEntry1));
 
     // Adding the same next hop entry multiple times should have the same outcome
     // as adding it once.
@@ -619,16 +654,16 @@ TEST_F(NextHopManagerTest, ProcessUpdateRequestShouldFailAsItIsUnsupported)
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, 1));
 }
 
-TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldSucceedForExistingNextHop)
+TEST_F(NextHopManagerTest, RemoveNextHopShouldSucceedForExistingNextHop)
 {
     auto *p4_next_hop_entry = AddNextHopEntry1();
     ASSERT_NE(p4_next_hop_entry, nullptr);
 
     // Set up mock call.
-    EXPECT_CALL(mock_sai_next_hop_, remove_next_hop(Eq(p4_next_hop_entry->next_hop_oid)))
-        .WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_next_hop_, remove_next_hops(Eq(1), Pointee(Eq(p4_next_hop_entry->next_hop_oid)), _, NotNull()))
+        .WillOnce(DoAll(SetArgPointee<3>(SAI_STATUS_SUCCESS), Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessDeleteRequest(p4_next_hop_entry->next_hop_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, RemoveNextHop(p4_next_hop_entry->next_hop_id));
 
     // Validate the next hop entry has been deleted in both P4 next hop manager
     // and centralized mapper.
@@ -645,13 +680,13 @@ TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldSucceedForExistingNextHop)
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, 0));
 }
 
-TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailForNonExistingNextHop)
+TEST_F(NextHopManagerTest, RemoveNextHopShouldFailForNonExistingNextHop)
 {
     EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND,
-              ProcessDeleteRequest(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id)));
+              RemoveNextHop(kP4NextHopAppDbEntry1.next_hop_id));
 }
 
-TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailIfNextHopEntryIsAbsentInCentralMapper)
+TEST_F(NextHopManagerTest, RemoveNextHopShouldFailIfNextHopEntryIsAbsentInCentralMapper)
 {
     auto *p4_next_hop_entry = AddNextHopEntry1();
     ASSERT_NE(p4_next_hop_entry, nullptr);
@@ -659,7 +694,7 @@ TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailIfNextHopEntryIsAbsentI
     ASSERT_TRUE(p4_oid_mapper_.eraseOID(SAI_OBJECT_TYPE_NEXT_HOP, p4_next_hop_entry->next_hop_key));
 
     // TODO: Expect critical state.
-    EXPECT_EQ(StatusCode::SWSS_RC_INTERNAL, ProcessDeleteRequest(p4_next_hop_entry->next_hop_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_INTERNAL, RemoveNextHop(p4_next_hop_entry->next_hop_id));
 
     // Validate the next hop entry is not deleted in P4 next hop manager.
     p4_next_hop_entry = GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id));
@@ -673,14 +708,14 @@ TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailIfNextHopEntryIsAbsentI
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, 1));
 }
 
-TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailIfNextHopEntryIsStillReferenced)
+TEST_F(NextHopManagerTest, RemoveNextHopShouldFailIfNextHopEntryIsStillReferenced)
 {
     auto *p4_next_hop_entry = AddNextHopEntry1();
     ASSERT_NE(p4_next_hop_entry, nullptr);
 
     ASSERT_TRUE(p4_oid_mapper_.increaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, p4_next_hop_entry->next_hop_key));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, ProcessDeleteRequest(p4_next_hop_entry->next_hop_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, RemoveNextHop(p4_next_hop_entry->next_hop_id));
 
     // Validate the next hop entry is not deleted in either P4 next hop manager or
     // central mapper.
@@ -696,16 +731,16 @@ TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailIfNextHopEntryIsStillRe
     EXPECT_TRUE(ValidateRefCnt(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, neighbor_key, 1));
 }
 
-TEST_F(NextHopManagerTest, ProcessDeleteRequestShouldFailIfSaiCallFails)
+TEST_F(NextHopManagerTest, RemoveNextHopShouldFailIfSaiCallFails)
 {
     auto *p4_next_hop_entry = AddNextHopEntry1();
     ASSERT_NE(p4_next_hop_entry, nullptr);
 
     // Set up mock call.
-    EXPECT_CALL(mock_sai_next_hop_, remove_next_hop(Eq(p4_next_hop_entry->next_hop_oid)))
-        .WillOnce(Return(SAI_STATUS_FAILURE));
+    EXPECT_CALL(mock_sai_next_hop_, remove_next_hops(Eq(1), Pointee(Eq(p4_next_hop_entry->next_hop_oid)), _, NotNull()))
+        .WillOnce(DoAll(SetArgPointee<3>(SAI_STATUS_FAILURE), Return(SAI_STATUS_FAILURE)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN, ProcessDeleteRequest(p4_next_hop_entry->next_hop_key));
+    EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN, RemoveNextHop(p4_next_hop_entry->next_hop_id));
 
     // Validate the next hop entry is not deleted in either P4 next hop manager or
     // central mapper.
@@ -728,13 +763,15 @@ TEST_F(NextHopManagerTest, GetNextHopEntryShouldReturnValidPointerForAddedNextHo
 
     // Set up mock call.
     EXPECT_CALL(mock_sai_next_hop_,
-                create_next_hop(
-                    ::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                    Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1)))))
-        .WillOnce(DoAll(SetArgPointee<0>(kNextHopOid), Return(SAI_STATUS_SUCCESS)));
+                create_next_hops(
+                    Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                    Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                    CreateAttributeListForNextHopObject(kP4NextHopAppDbEntry1, kRouterInterfaceOid1))),
+                    _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<5>(kNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
 
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(kP4NextHopAppDbEntry1));
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNextHop(kP4NextHopAppDbEntry1));
 
     EXPECT_NE(GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4NextHopAppDbEntry1.next_hop_id)), nullptr);
 }
@@ -815,8 +852,9 @@ TEST_F(NextHopManagerTest, DrainValidAppEntryShouldSucceed)
     Enqueue(app_db_entry);
 
     EXPECT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry2, kRouterInterfaceOid2));
-    EXPECT_CALL(mock_sai_next_hop_, create_next_hop(_, _, _, _))
-        .WillOnce(DoAll(SetArgPointee<0>(kNextHopOid), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(1), _, _, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<5>(kNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
     EXPECT_CALL(publisher_,
                 publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry)),
                         Eq(kfvFieldsValues(app_db_entry)),
@@ -840,8 +878,9 @@ TEST_F(NextHopManagerTest, DrainValidTunnelNexthopAppEntryShouldSucceed)
     Enqueue(tunnel_app_db_entry);
 
     EXPECT_TRUE(ResolveNextHopEntryDependency(kP4TunnelNextHopAppDbEntry2, kTunnelOid2));
-    EXPECT_CALL(mock_sai_next_hop_, create_next_hop(_, _, _, _))
-        .WillOnce(DoAll(SetArgPointee<0>(kTunnelNextHopOid), Return(SAI_STATUS_SUCCESS)));
+    EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(1), _, _, _, _, _))
+        .WillOnce(DoAll(SetArgPointee<5>(kTunnelNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
     EXPECT_CALL(publisher_, publish(Eq(APP_P4RT_TABLE_NAME),
                                     Eq(kfvKey(tunnel_app_db_entry)),
                                     Eq(kfvFieldsValues(tunnel_app_db_entry)),
@@ -855,7 +894,8 @@ TEST_F(NextHopManagerTest, DrainValidTunnelNexthopAppEntryShouldSucceed)
     std::vector<swss::FieldValueTuple> fvs;
     swss::KeyOpFieldsValuesTuple app_db_entry(std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
                                               DEL_COMMAND, fvs);
-    EXPECT_CALL(mock_sai_next_hop_, remove_next_hop(Eq(kTunnelNextHopOid))).WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_next_hop_, remove_next_hops(Eq(1), Pointee(Eq(kTunnelNextHopOid)), _, NotNull()))
+        .WillOnce(DoAll(SetArgPointee<3>(SAI_STATUS_SUCCESS), Return(SAI_STATUS_SUCCESS)));
 
     Enqueue(app_db_entry);
     EXPECT_CALL(publisher_,
@@ -1058,8 +1098,8 @@ TEST_F(NextHopManagerTest, DrainDeleteRequestShouldSucceedForExistingNextHop)
     std::vector<swss::FieldValueTuple> fvs;
     swss::KeyOpFieldsValuesTuple app_db_entry(std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
                                               DEL_COMMAND, fvs);
-    EXPECT_CALL(mock_sai_next_hop_, remove_next_hop(Eq(p4_next_hop_entry->next_hop_oid)))
-        .WillOnce(Return(SAI_STATUS_SUCCESS));
+    EXPECT_CALL(mock_sai_next_hop_, remove_next_hops(Eq(1), Pointee(Eq(p4_next_hop_entry->next_hop_oid)), _, NotNull()))
+        .WillOnce(DoAll(SetArgPointee<3>(SAI_STATUS_SUCCESS), Return(SAI_STATUS_SUCCESS)));
 
     Enqueue(app_db_entry);
     EXPECT_CALL(publisher_,
@@ -1220,10 +1260,15 @@ TEST_F(NextHopManagerTest, DrainStopOnFirstFailure) {
   Enqueue(app_db_entry_2);
   Enqueue(app_db_entry_3);
 
-  EXPECT_CALL(mock_sai_next_hop_, create_next_hop(_, _, _, _))
-      .WillOnce(
-          DoAll(SetArgPointee<0>(kNextHopOid), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(Return(SAI_STATUS_FAILURE));
+  // All three next hops are created in one bulk call.
+  std::vector<sai_object_id_t> exp_oids{kNextHopOid, SAI_NULL_OBJECT_ID,
+                                        SAI_NULL_OBJECT_ID};
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE,
+                                       SAI_STATUS_NOT_EXECUTED};
+  EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(3), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_oids.begin(), exp_oids.end()),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_FAILURE)));
   EXPECT_CALL(publisher_,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_1)),
                       Eq(kfvFieldsValues(app_db_entry_1)),
@@ -1242,6 +1287,170 @@ TEST_F(NextHopManagerTest, DrainStopOnFirstFailure) {
   EXPECT_EQ(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("3")));
 }
 
+TEST_F(NextHopManagerTest, DrainSplitsBatchOnRepeatedNextHop) {
+  std::vector<swss::FieldValueTuple> fvs{
+      {p4orch::kAction, p4orch::kSetIpNexthop},
+      {prependParamField(p4orch::kNeighborId), kNeighborId2},
+      {prependParamField(p4orch::kRouterInterfaceId), kRouterInterfaceId2}};
+  EXPECT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry2,
+                                            kRouterInterfaceOid2));
+  nlohmann::json j;
+  j[prependMatchField(p4orch::kNexthopId)] = "1";
+  swss::KeyOpFieldsValuesTuple app_db_entry_1(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, fvs);
+  j[prependMatchField(p4orch::kNexthopId)] = "2";
+  swss::KeyOpFieldsValuesTuple app_db_entry_2(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, fvs);
+
+  Enqueue(app_db_entry_1);
+  Enqueue(app_db_entry_2);
+  Enqueue(app_db_entry_1);
+
+  // The second entry of next hop 1 is not created along with the first one,
+  // it is an update of the next hop created by the first batch.
+  std::vector<sai_object_id_t> exp_oids{kNextHopOid, kTunnelNextHopOid};
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(2), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_oids.begin(), exp_oids.end()),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  {
+    InSequence s;
+    EXPECT_CALL(publisher_,
+                publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_1)),
+                        Eq(kfvFieldsValues(app_db_entry_1)),
+                        Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+    EXPECT_CALL(publisher_,
+                publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_2)),
+                        Eq(kfvFieldsValues(app_db_entry_2)),
+                        Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+    EXPECT_CALL(publisher_,
+                publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_1)),
+                        Eq(kfvFieldsValues(app_db_entry_1)),
+                        Eq(StatusCode::SWSS_RC_UNIMPLEMENTED), Eq(true)));
+  }
+  EXPECT_EQ(StatusCode::SWSS_RC_UNIMPLEMENTED,
+            Drain(/*failure_before=*/false));
+  EXPECT_NE(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("1")));
+  EXPECT_NE(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("2")));
+}
+
+TEST_F(NextHopManagerTest, DrainSplitsBatchOnOperationChange) {
+  auto *p4_next_hop_entry = AddNextHopEntry1();
+  ASSERT_NE(p4_next_hop_entry, nullptr);
+
+  std::vector<swss::FieldValueTuple> fvs{
+      {p4orch::kAction, p4orch::kSetIpNexthop},
+      {prependParamField(p4orch::kNeighborId), kNeighborId2},
+      {prependParamField(p4orch::kRouterInterfaceId), kRouterInterfaceId2}};
+  EXPECT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry2,
+                                            kRouterInterfaceOid2));
+  nlohmann::json j;
+  j[prependMatchField(p4orch::kNexthopId)] = "1";
+  swss::KeyOpFieldsValuesTuple app_db_entry_1(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, fvs);
+  j[prependMatchField(p4orch::kNexthopId)] = "2";
+  swss::KeyOpFieldsValuesTuple app_db_entry_2(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, fvs);
+  j[prependMatchField(p4orch::kNexthopId)] = kNextHopId;
+  swss::KeyOpFieldsValuesTuple app_db_entry_3(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      DEL_COMMAND, std::vector<swss::FieldValueTuple>{});
+
+  Enqueue(app_db_entry_1);
+  Enqueue(app_db_entry_2);
+  Enqueue(app_db_entry_3);
+
+  // The creations are programmed in one bulk call before the removal.
+  InSequence s;
+  std::vector<sai_object_id_t> exp_oids{kTunnelNextHopOid,
+                                        kTunnelNextHopOid + 1};
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(2), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_oids.begin(), exp_oids.end()),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(publisher_,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_1)),
+                      Eq(kfvFieldsValues(app_db_entry_1)),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(publisher_,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_2)),
+                      Eq(kfvFieldsValues(app_db_entry_2)),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(mock_sai_next_hop_,
+              remove_next_hops(Eq(1), Pointee(Eq(kNextHopOid)), _, NotNull()))
+      .WillOnce(DoAll(SetArgPointee<3>(SAI_STATUS_SUCCESS),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(publisher_,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_3)),
+                      Eq(kfvFieldsValues(app_db_entry_3)),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, Drain(/*failure_before=*/false));
+  EXPECT_NE(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("1")));
+  EXPECT_NE(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("2")));
+  EXPECT_EQ(nullptr,
+            GetNextHopEntry(KeyGenerator::generateNextHopKey(kNextHopId)));
+}
+
+TEST_F(NextHopManagerTest, DrainNotExecutedAfterFailedPreCheck) {
+  std::vector<swss::FieldValueTuple> fvs{
+      {p4orch::kAction, p4orch::kSetIpNexthop},
+      {prependParamField(p4orch::kNeighborId), kNeighborId2},
+      {prependParamField(p4orch::kRouterInterfaceId), kRouterInterfaceId2}};
+  // The neighbor of the second next hop is not resolved.
+  std::vector<swss::FieldValueTuple> unresolved_fvs{
+      {p4orch::kAction, p4orch::kSetIpNexthop},
+      {prependParamField(p4orch::kNeighborId), kNeighborId1},
+      {prependParamField(p4orch::kRouterInterfaceId), kRouterInterfaceId1}};
+  EXPECT_TRUE(ResolveNextHopEntryDependency(kP4NextHopAppDbEntry2,
+                                            kRouterInterfaceOid2));
+  nlohmann::json j;
+  j[prependMatchField(p4orch::kNexthopId)] = "1";
+  swss::KeyOpFieldsValuesTuple app_db_entry_1(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, fvs);
+  j[prependMatchField(p4orch::kNexthopId)] = "2";
+  swss::KeyOpFieldsValuesTuple app_db_entry_2(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, unresolved_fvs);
+  j[prependMatchField(p4orch::kNexthopId)] = "3";
+  swss::KeyOpFieldsValuesTuple app_db_entry_3(
+      std::string(APP_P4RT_NEXTHOP_TABLE_NAME) + kTableKeyDelimiter + j.dump(),
+      SET_COMMAND, fvs);
+
+  Enqueue(app_db_entry_1);
+  Enqueue(app_db_entry_2);
+  Enqueue(app_db_entry_3);
+
+  // Only the next hop before the one failing the checks is created.
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(1), _, _, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<5>(kNextHopOid),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(publisher_,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_1)),
+                      Eq(kfvFieldsValues(app_db_entry_1)),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(publisher_,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_2)),
+                      Eq(kfvFieldsValues(app_db_entry_2)),
+                      Eq(StatusCode::SWSS_RC_NOT_FOUND), Eq(true)));
+  EXPECT_CALL(publisher_,
+              publish(Eq(APP_P4RT_TABLE_NAME), Eq(kfvKey(app_db_entry_3)),
+                      Eq(kfvFieldsValues(app_db_entry_3)),
+                      Eq(StatusCode::SWSS_RC_NOT_EXECUTED), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_NOT_FOUND, Drain(/*failure_before=*/false));
+  EXPECT_NE(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("1")));
+  EXPECT_EQ(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("2")));
+  EXPECT_EQ(nullptr, GetNextHopEntry(KeyGenerator::generateNextHopKey("3")));
+}
+
 TEST_F(NextHopManagerTest, VerifyTunnelNextHopStateTest)
 {
     ASSERT_TRUE(ResolveNextHopEntryDependency(kP4TunnelNextHopAppDbEntry1, kTunnelOid1));
@@ -1249,13 +1458,15 @@ TEST_F(NextHopManagerTest, VerifyTunnelNextHopStateTest)
     // Set up mock call.
     EXPECT_CALL(
         mock_sai_next_hop_,
-        create_next_hop(::testing::NotNull(), Eq(gSwitchId), Eq(3),
-                        Truly(std::bind(MatchCreateNextHopArgAttrList, std::placeholders::_1,
-                                        CreateAttributeListForNextHopObject(kP4TunnelNextHopAppDbEntry1, kTunnelOid1,
-                                                                            swss::IpAddress(kNeighborId1))))))
-        .WillOnce(DoAll(SetArgPointee<0>(kTunnelNextHopOid), Return(SAI_STATUS_SUCCESS)));
-
-    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, ProcessAddRequest(kP4TunnelNextHopAppDbEntry1));
+        create_next_hops(Eq(gSwitchId), Eq(1), Pointee(Eq(3)),
+                         Truly(std::bind(MatchCreateNextHopArgAttrLists, std::placeholders::_1,
+                                         CreateAttributeListForNextHopObject(kP4TunnelNextHopAppDbEntry1, kTunnelOid1,
+                                                                             swss::IpAddress(kNeighborId1)))),
+                         _, NotNull(), NotNull()))
+        .WillOnce(DoAll(SetArgPointee<5>(kTunnelNextHopOid), SetArgPointee<6>(SAI_STATUS_SUCCESS),
+                        Return(SAI_STATUS_SUCCESS)));
+
+    EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS, CreateNextHop(kP4TunnelNextHopAppDbEntry1));
 
     auto p4_next_hop_entry = GetNextHopEntry(KeyGenerator::generateNextHopKey(kP4TunnelNextHopAppDbEntry1.next_hop_id));
     ASSERT_NE(p4_next_hop_entry, nullptr);
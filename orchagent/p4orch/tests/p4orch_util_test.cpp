@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "ipprefix.h"
 #include "swssnet.h"
@@ -57,6 +58,51 @@ TEST(P4OrchUtilTest, ParseP4RTKeyTest)
     EXPECT_TRUE(key.empty());
 }
 
+TEST(P4OrchUtilTest, P4KeyDecoderShouldSucceed)
+{
+    P4KeyDecoder decoder({"vrf_id", "ipv4_dst"});
+    P4KeyDecoder::Fields fields;
+
+    ASSERT_TRUE(decoder.decode(R"({"match/vrf_id":"b4-traffic","match/ipv4_dst":"10.11.12.0/24"})", &fields).ok());
+    EXPECT_EQ(std::vector<std::string>({"b4-traffic", "10.11.12.0/24"}), fields.values);
+    EXPECT_EQ(std::vector<bool>({true, true}), fields.present);
+
+    // Fields not in the table are skipped, whatever their value.
+    ASSERT_TRUE(decoder
+                    .decode(R"( { "priority" : -1.5e3, "match/vrf_id" : "a\"\\é😀",)"
+                            R"( "other" : [1, {"x": null}, true] } )",
+                            &fields)
+                    .ok());
+    EXPECT_EQ(std::vector<std::string>({"a\"\\\xc3\xa9\xf0\x9f\x98\x80", ""}), fields.values);
+    EXPECT_EQ(std::vector<bool>({true, false}), fields.present);
+
+    // The last of duplicate fields is used.
+    ASSERT_TRUE(decoder.decode(R"({"match/vrf_id":"a","match/vrf_id":"b"})", &fields).ok());
+    EXPECT_EQ("b", fields.values[0]);
+
+    ASSERT_TRUE(decoder.decode("{}", &fields).ok());
+    EXPECT_EQ(std::vector<bool>({false, false}), fields.present);
+}
+
+TEST(P4OrchUtilTest, P4KeyDecoderShouldFailOnInvalidKey)
+{
+    P4KeyDecoder decoder({"vrf_id"});
+    P4KeyDecoder::Fields fields;
+
+    for (const std::string key :
+         {"", "[]", "\"vrf\"", R"({"match/vrf_id":1})", R"({"match/vrf_id":"a",})", R"({"match/vrf_id":"a"} x)",
+          R"({"match/vrf_id":"a)", R"({"match/vrf_id":"\ud800"})", R"({"priority":01})", R"({"priority":tru})"})
+    {
+        EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode(key, &fields)) << key;
+    }
+
+    // Unknown fields are rejected if not allowed.
+    P4KeyDecoder strict_decoder({"vrf_id"}, /*allow_unknown=*/false);
+    EXPECT_TRUE(strict_decoder.decode(R"({"match/vrf_id":"a"})", &fields).ok());
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM,
+              strict_decoder.decode(R"({"match/vrf_id":"a","match/ipv4_dst":"10.0.0.0/8"})", &fields));
+}
+
 TEST(P4OrchUtilTest, PrependMatchFieldShouldSucceed)
 {
     EXPECT_EQ(prependMatchField("str"), "match/str");
@@ -32,6 +32,12 @@ namespace p4orch
 namespace
 {
 
+const P4KeyDecoder &wcmpGroupKeyDecoder()
+{
+    static const P4KeyDecoder decoder({kWcmpGroupId});
+    return decoder;
+}
+
 std::string getWcmpGroupMemberKey(const std::string &wcmp_group_key, const sai_object_id_t wcmp_member_oid)
 {
     return wcmp_group_key + kTableKeyDelimiter + sai_serialize_object_id(wcmp_member_oid);
@@ -122,19 +128,12 @@ ReturnCodeOr<P4WcmpGroupEntry> WcmpManager::deserializeP4WcmpGroupAppDbEntry(
     const std::string &key, const std::vector<swss::FieldValueTuple> &attributes)
 {
     P4WcmpGroupEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        if (!j.is_object())
-        {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid WCMP group key: should be a JSON object.";
-        }
-        app_db_entry.wcmp_group_id = j[prependMatchField(kWcmpGroupId)];
-    }
-    catch (std::exception &ex)
+    P4KeyDecoder::Fields fields;
+    if (!wcmpGroupKeyDecoder().decode(key, &fields).ok() || !fields.present[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize WCMP group key";
     }
+    app_db_entry.wcmp_group_id = fields.values[0];
 
     for (const auto &it : attributes)
     {
@@ -737,26 +736,21 @@ void WcmpManager::updatePortOperStatusMap(const std::string &port, const sai_por
 ReturnCode WcmpManager::getSaiObject(const std::string &json_key, sai_object_type_t &object_type,
                                      std::string &object_key)
 {
-    std::string value;
+    P4KeyDecoder::Fields fields;
 
-    try
+    if (!wcmpGroupKeyDecoder().decode(json_key, &fields).ok())
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kWcmpGroupId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kWcmpGroupId)).get<std::string>();
-            object_key = KeyGenerator::generateWcmpGroupKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (!fields.present[0])
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
+    }
+    else
+    {
+        object_key = KeyGenerator::generateWcmpGroupKey(fields.values[0]);
+        object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
+        return ReturnCode();
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
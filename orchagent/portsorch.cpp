@@ -33,6 +33,7 @@
 #include "sai_serialize.h"
 #include "crmorch.h"
 #include "countercheckorch.h"
+#include "counterratesorch.h"
 #include "notifier.h"
 #include "fdborch.h"
 #include "switchorch.h"
@@ -69,6 +70,7 @@ extern int32_t gVoqMySwitchId;
 extern string gMyHostName;
 extern string gMyAsicName;
 extern event_handle_t g_events_handle;
+extern bool gNativeCounterRates;
 
 // defines ------------------------------------------------------------------------------------------------------------
 
@@ -742,8 +744,16 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         string pgLuaScript = swss::loadLuaScript(pgWmPluginName);
         pgWmSha = swss::loadRedisScript(m_counter_db.get(), pgLuaScript);
 
-        string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
-        portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
+        /* Port rates are computed by CounterRatesOrch then, once told the counters are polled */
+        if (gNativeCounterRates)
+        {
+            portRateSha = CounterRatesOrch::loadPollPlugin(m_counter_db.get(), "PORT");
+        }
+        else
+        {
+            string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
+            portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
+        }
 
         string nvdaPortTrimLuaScript = swss::loadLuaScript(nvdaPortTrimPluginName);
         nvdaPortTrimSha = swss::loadRedisScript(m_counter_db.get(), nvdaPortTrimLuaScript);
@@ -1671,36 +1681,78 @@ bool PortsOrch::getPort(string alias, Port &p)
 {
     SWSS_LOG_ENTER();
 
-    if (m_portList.find(alias) == m_portList.end())
+    auto port = findPort(alias);
+    if (port == nullptr)
     {
         return false;
     }
-    else
-    {
-        p = m_portList[alias];
-        return true;
-    }
+
+    p = *port;
+    return true;
 }
 
 bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
+    auto p = findPort(id);
+    if (p == nullptr)
+    {
+        return false;
+    }
+
+    port = *p;
+    return true;
+}
+
+const Port *PortsOrch::findPort(const string &alias) const
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return nullptr;
+    }
+
+    return &itr->second;
+}
+
+const Port *PortsOrch::findPort(sai_object_id_t id) const
+{
     auto itr = saiOidToAlias.find(id);
     if (itr == saiOidToAlias.end())
     {
-        return false;
+        return nullptr;
     }
-    else
+
+    auto port = findPort(itr->second);
+    if (port == nullptr)
     {
-        if (!getPort(itr->second, port))
-        {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
-        }
-        return true;
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
     }
 
-    return false;
+    return port;
+}
+
+const Port *PortsOrch::findPortByBridgePortId(sai_object_id_t bridge_port_id) const
+{
+    auto itr = saiOidToAlias.find(bridge_port_id);
+    if (itr == saiOidToAlias.end())
+    {
+        return nullptr;
+    }
+
+    return findPort(itr->second);
+}
+
+const Port *PortsOrch::findVlanByVlanId(sai_vlan_id_t vlan_id) const
+{
+    auto itr = m_vlanIdToAlias.find(vlan_id);
+    if (itr == m_vlanIdToAlias.end())
+    {
+        return nullptr;
+    }
+
+    return findPort(itr->second);
 }
 
 void PortsOrch::increasePortRefCount(const string &alias)
@@ -1871,18 +1923,17 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
 {
     SWSS_LOG_ENTER();
 
-    auto itr = saiOidToAlias.find(bridge_port_id);
-    if (itr == saiOidToAlias.end())
+    if (saiOidToAlias.find(bridge_port_id) == saiOidToAlias.end())
     {
         return false;
     }
-    else
+
+    auto p = findPortByBridgePortId(bridge_port_id);
+    if (p != nullptr)
     {
-        getPort(itr->second, port);
-        return true;
+        port = *p;
     }
-
-    return false;
+    return true;
 }
 
 bool PortsOrch::addSubPort(Port &port, const string &alias, const string &vlan, const bool &adminUp, const uint32_t &mtu)
@@ -3063,6 +3114,11 @@ void PortsOrch::initPortSupportedSpeeds(const std::string& alias, sai_object_id_
     }
     PortSupportedSpeeds supported_speeds;
     getPortSupportedSpeeds(alias, port_id, supported_speeds);
+    updatePortSupportedSpeeds(alias, port_id, supported_speeds);
+}
+
+void PortsOrch::updatePortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id, const PortSupportedSpeeds &supported_speeds)
+{
     m_portSupportedSpeeds[port_id] = supported_speeds;
     vector<FieldValueTuple> v;
     std::string supported_speeds_str = swss::join(',', supported_speeds.begin(), supported_speeds.end());
@@ -3170,10 +3226,17 @@ void PortsOrch::initPortSupportedFecModes(const std::string& alias, sai_object_i
         return;
     }
 
+    auto &obj = m_portSupportedFecModes[port_id];
+
+    auto status = getPortSupportedFecModes(obj.data, port_id);
+    updatePortSupportedFecModes(alias, port_id, status);
+}
+
+void PortsOrch::updatePortSupportedFecModes(const std::string& alias, sai_object_id_t port_id, sai_status_t status)
+{
     auto &obj = m_portSupportedFecModes[port_id];
     auto &supported_fec_modes = obj.data;
 
-    auto status = getPortSupportedFecModes(supported_fec_modes, port_id);
     if (status != SAI_STATUS_SUCCESS)
     {
         // Do not expose "supported_fecs" in case fetching FEC modes is not supported by the vendor
@@ -3218,6 +3281,110 @@ void PortsOrch::initPortSupportedFecModes(const std::string& alias, sai_object_i
     m_portStateTable.set(alias, v);
 }
 
+void PortsOrch::initPortSupportedSpeedsBulk(const std::vector<Port *>& ports)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER(__FUNCTION__);
+
+    const auto size_guess = 25; // Guess the size which could be enough
+
+    std::vector<Port *> queried;
+    for (auto port: ports)
+    {
+        // If port supported speeds map already contains the information, save the SAI call
+        if (!m_portSupportedSpeeds.count(port->m_port_id))
+        {
+            queried.push_back(port);
+        }
+    }
+
+    const auto portCount = static_cast<uint32_t>(queried.size());
+
+    PortBulker bulker(portCount);
+    std::vector<PortSupportedSpeeds> speeds(portCount, PortSupportedSpeeds(size_guess));
+
+    for (size_t idx = 0; idx < portCount; idx++)
+    {
+        sai_attribute_t attr;
+        attr.id = SAI_PORT_ATTR_SUPPORTED_SPEED;
+        attr.value.u32list.count = static_cast<uint32_t>(speeds[idx].size());
+        attr.value.u32list.list = speeds[idx].data();
+        bulker.add(queried[idx]->m_port_id, attr);
+    }
+
+    bulker.executeGet();
+
+    for (size_t idx = 0; idx < portCount; idx++)
+    {
+        const auto& port = *queried[idx];
+
+        // Ports with a bigger list or an error are queried one by one
+        if (bulker.statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            initPortSupportedSpeeds(port.m_alias, port.m_port_id);
+            continue;
+        }
+
+        speeds[idx].resize(bulker.attrList[idx].value.u32list.count);
+        updatePortSupportedSpeeds(port.m_alias, port.m_port_id, speeds[idx]);
+    }
+}
+
+void PortsOrch::initPortSupportedFecModesBulk(const std::vector<Port *>& ports)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER(__FUNCTION__);
+
+    std::vector<Port *> queried;
+    for (auto port: ports)
+    {
+        // If port supported FEC modes map already contains the information, save the SAI call
+        if (!m_portSupportedFecModes.count(port->m_port_id))
+        {
+            queried.push_back(port);
+        }
+    }
+
+    const auto portCount = static_cast<uint32_t>(queried.size());
+
+    PortBulker bulker(portCount);
+    std::vector<std::vector<sai_int32_t>> fecModes(portCount, std::vector<sai_int32_t>(Port::max_fec_modes));
+
+    for (size_t idx = 0; idx < portCount; idx++)
+    {
+        sai_attribute_t attr;
+        attr.id = SAI_PORT_ATTR_SUPPORTED_FEC_MODE;
+        attr.value.s32list.count = static_cast<uint32_t>(fecModes[idx].size());
+        attr.value.s32list.list = fecModes[idx].data();
+        bulker.add(queried[idx]->m_port_id, attr);
+    }
+
+    bulker.executeGet();
+
+    for (size_t idx = 0; idx < portCount; idx++)
+    {
+        const auto& port = *queried[idx];
+
+        // Ports with an error are queried one by one, which also reports it
+        if (bulker.statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            initPortSupportedFecModes(port.m_alias, port.m_port_id);
+            continue;
+        }
+
+        auto &obj = m_portSupportedFecModes[port.m_port_id];
+        const auto& attr = bulker.attrList[idx];
+        for (std::uint32_t i = 0; i < attr.value.s32list.count; i++)
+        {
+            obj.data.insert(static_cast<sai_port_fec_mode_t>(attr.value.s32list.list[i]));
+        }
+
+        updatePortSupportedFecModes(port.m_alias, port.m_port_id, SAI_STATUS_SUCCESS);
+    }
+}
+
 /*
  * If Gearbox is enabled and this is a Gearbox port then set the attributes accordingly.
  */
@@ -3938,20 +4105,23 @@ bool PortsOrch::initPortsBulk(std::vector<Port>& ports)
         status = false;
     }
 
+    std::vector<Port *> registered;
+
     for (auto& p: ports)
     {
         const auto& alias = p.m_alias;
 
         registerPort(p);
-
-        if (!m_isWarmRestoreStage)
-        {
-            postPortInit(m_portList[alias]);
-        }
+        registered.push_back(&m_portList[alias]);
 
         SWSS_LOG_NOTICE("Initialized port %s", alias.c_str());
     }
 
+    if (!m_isWarmRestoreStage)
+    {
+        postPortInit(registered);
+    }
+
     return status;
 }
 
@@ -6067,34 +6237,41 @@ void PortsOrch::onWarmBootEnd()
     refreshPortStatus();
 
     // Do post boot port initialization
+    std::vector<Port *> ports;
     for (auto& it: m_portList)
     {
         Port& port = it.second;
 
         if (port.m_type == Port::PHY)
         {
-            postPortInit(it.second);
+            ports.push_back(&port);
         }
     }
+
+    postPortInit(ports);
 }
 
-void PortsOrch::postPortInit(Port& p)
+// Queries of the ports are done in bulk across all the ports
+void PortsOrch::postPortInit(const std::vector<Port *>& ports)
 {
     SWSS_LOG_ENTER();
 
     if (gMySwitchType != "dpu")
     {
-        initializePortBufferMaximumParameters(p);
+        initializePortBufferMaximumParameters(ports);
     }
 
-    // We have to test the size of m_queue_ids here since it isn't initialized on some platforms (like DPU)
-    if (p.m_host_tx_queue_configured && p.m_queue_ids.size() > p.m_host_tx_queue)
+    for (auto port: ports)
     {
-        createPortBufferQueueCounters(p, to_string(p.m_host_tx_queue), false);
+        // We have to test the size of m_queue_ids here since it isn't initialized on some platforms (like DPU)
+        if (port->m_host_tx_queue_configured && port->m_queue_ids.size() > port->m_host_tx_queue)
+        {
+            createPortBufferQueueCounters(*port, to_string(port->m_host_tx_queue), false);
+        }
     }
 
-    initPortSupportedSpeeds(p.m_alias, p.m_port_id);
-    initPortSupportedFecModes(p.m_alias, p.m_port_id);
+    initPortSupportedSpeedsBulk(ports);
+    initPortSupportedFecModesBulk(ports);
 }
 
 void PortsOrch::doTask()
@@ -6557,6 +6734,77 @@ void PortsOrch::initializeQueuesBulk(std::vector<Port>& ports)
             SWSS_LOG_INFO("Get queues for port %s", port.m_alias.c_str());
         }
     }
+
+    initializeQueueInfoBulk(ports);
+}
+
+// Cache the type and index of the queues, which the queue maps and counters
+// need, with one bulk query instead of one query per queue. The queues not
+// cached here are queried one by one when needed.
+void PortsOrch::initializeQueueInfoBulk(const std::vector<Port>& ports)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER(__FUNCTION__);
+
+    std::vector<sai_object_key_t> queueKeys;
+
+    for (const auto& port: ports)
+    {
+        for (const auto queueId: port.m_queue_ids)
+        {
+            if (m_queueInfo.find(queueId) == m_queueInfo.end())
+            {
+                sai_object_key_t key;
+                key.key.object_id = queueId;
+                queueKeys.push_back(key);
+            }
+        }
+    }
+
+    if (queueKeys.empty())
+    {
+        return;
+    }
+
+    const auto queueCount = static_cast<uint32_t>(queueKeys.size());
+
+    std::vector<uint32_t> attrCount(queueCount, 2);
+    std::vector<sai_attribute_t> attrList(queueCount * 2);
+    std::vector<sai_attribute_t*> attrs(queueCount);
+    std::vector<sai_status_t> statuses(queueCount, SAI_STATUS_NOT_EXECUTED);
+
+    for (size_t idx = 0; idx < queueCount; idx++)
+    {
+        attrList[idx * 2].id = SAI_QUEUE_ATTR_TYPE;
+        attrList[idx * 2 + 1].id = SAI_QUEUE_ATTR_INDEX;
+        attrs[idx] = &attrList[idx * 2];
+    }
+
+    sai_status_t status = sai_bulk_object_get_attribute(gSwitchId, SAI_OBJECT_TYPE_QUEUE, queueCount,
+            queueKeys.data(), attrCount.data(), attrs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_INFO("Bulk query of queue type and index returned rv:%d", status);
+    }
+
+    for (size_t idx = 0; idx < queueCount; idx++)
+    {
+        if (statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        auto type = static_cast<sai_queue_type_t>(attrs[idx][0].value.s32);
+        if (sai_queue_type_string_map.find(type) == sai_queue_type_string_map.end())
+        {
+            continue;
+        }
+
+        auto& info = m_queueInfo[queueKeys[idx].key.object_id];
+        info.type = type;
+        info.index = attrs[idx][1].value.u8;
+    }
 }
 
 void PortsOrch::initializeSchedulerGroupsBulk(std::vector<Port>& ports)
@@ -6639,28 +6887,47 @@ void PortsOrch::initializeSchedulerGroupsBulk(std::vector<Port>& ports)
     }
 }
 
-void PortsOrch::initializePortBufferMaximumParameters(const Port &port)
+void PortsOrch::initializePortBufferMaximumParameters(const std::vector<Port *>& ports)
 {
-    sai_attribute_t attr;
-    vector<FieldValueTuple> fvVector;
+    SWSS_LOG_ENTER();
 
-    attr.id = SAI_PORT_ATTR_QOS_MAXIMUM_HEADROOM_SIZE;
+    SWSS_LOG_TIMER(__FUNCTION__);
 
-    sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
-    if (status != SAI_STATUS_SUCCESS)
+    const auto portCount = static_cast<uint32_t>(ports.size());
+
+    PortBulker bulker(portCount);
+
+    for (auto port: ports)
     {
-        SWSS_LOG_NOTICE("Unable to get the maximum headroom for port %s rv:%d, ignored", port.m_alias.c_str(), status);
+        sai_attribute_t attr;
+        attr.id = SAI_PORT_ATTR_QOS_MAXIMUM_HEADROOM_SIZE;
+        bulker.add(port->m_port_id, attr);
     }
-    else
+
+    bulker.executeGet();
+
+    for (size_t idx = 0; idx < portCount; idx++)
     {
-        auto maximum_headroom = attr.value.u32;
-        fvVector.emplace_back("max_headroom_size", to_string(maximum_headroom));
-    }
+        const auto& port = *ports[idx];
+        const auto status = bulker.statuses[idx];
+        const auto& attr = bulker.attrList[idx];
+        vector<FieldValueTuple> fvVector;
 
-    fvVector.emplace_back("max_priority_groups", to_string(port.m_priority_group_ids.size()));
-    fvVector.emplace_back("max_queues", to_string(port.m_queue_ids.size()));
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_NOTICE("Unable to get the maximum headroom for port %s rv:%d, ignored", port.m_alias.c_str(), status);
+        }
+        else
+        {
+            auto maximum_headroom = attr.value.u32;
+            fvVector.emplace_back("max_headroom_size", to_string(maximum_headroom));
+        }
+
+        fvVector.emplace_back("max_priority_groups", to_string(port.m_priority_group_ids.size()));
+        fvVector.emplace_back("max_queues", to_string(port.m_queue_ids.size()));
 
-    m_stateBufferMaximumValueTable->set(port.m_alias, fvVector);
+        m_stateBufferMaximumValueTable->set(port.m_alias, fvVector);
+    }
 }
 
 bool PortsOrch::addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id, bool isUp)
@@ -7029,6 +7296,7 @@ bool PortsOrch::addVlan(string vlan_alias)
     m_portList[vlan_alias] = vlan;
     m_port_ref_count[vlan_alias] = 0;
     saiOidToAlias[vlan_oid] =  vlan_alias;
+    m_vlanIdToAlias[vlan_id] = vlan_alias;
     m_vlanPorts.emplace(vlan_alias);
 
     return true;
@@ -7100,6 +7368,7 @@ bool PortsOrch::removeVlan(Port vlan)
             vlan.m_vlan_info.vlan_id);
 
     saiOidToAlias.erase(vlan.m_vlan_info.vlan_oid);
+    m_vlanIdToAlias.erase(vlan.m_vlan_info.vlan_id);
     m_portList.erase(vlan.m_alias);
     m_port_ref_count.erase(vlan.m_alias);
     m_vlanPorts.erase(vlan.m_alias);
@@ -7111,16 +7380,14 @@ bool PortsOrch::getVlanByVlanId(sai_vlan_id_t vlan_id, Port &vlan)
 {
     SWSS_LOG_ENTER();
 
-    for (auto &it: m_portList)
+    auto p = findVlanByVlanId(vlan_id);
+    if (p == nullptr)
     {
-        if (it.second.m_type == Port::VLAN && it.second.m_vlan_info.vlan_id == vlan_id)
-        {
-            vlan = it.second;
-            return true;
-        }
+        return false;
     }
 
-    return false;
+    vlan = *p;
+    return true;
 }
 
 bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, string end_point_ip)
@@ -8200,7 +8467,6 @@ void PortsOrch::addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueSt
 void PortsOrch::addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, bool voq, sai_queue_type_t queueType)
 {
     std::unordered_set<string> counter_stats;
-    std::vector<sai_object_id_t> queue_ids;
 
     for (const auto& it: queue_stat_ids)
     {
@@ -8212,13 +8478,11 @@ void PortsOrch::addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_
         {
             counter_stats.emplace(sai_serialize_queue_stat(voq_it));
         }
-        queue_ids = m_port_voq_ids[port.m_alias];
-    }
-    else
-    {
-        queue_ids = port.m_queue_ids;
     }
 
+    // Not copied, this is called for every queue of every port
+    const auto& queue_ids = voq ? m_port_voq_ids[port.m_alias] : port.m_queue_ids;
+
     queue_stat_manager.setCounterIdList(queue_ids[queueIndex], CounterType::QUEUE, counter_stats, queueType);
 }
 
@@ -10364,6 +10628,20 @@ void PortsOrch::updateGearboxPortOperStatus(const Port& port)
     }
 }
 
+bool PortsOrch::incrFdbCount(const std::string& alias, int count)
+{
+    auto itr = m_portList.find(alias);
+    if (itr == m_portList.end())
+    {
+        return false;
+    }
+    else
+    {
+        itr->second.m_fdb_count += count;
+    }
+    return true;
+}
+
 bool PortsOrch::decrFdbCount(const std::string& alias, int count)
 {
     auto itr = m_portList.find(alias);
@@ -154,6 +154,16 @@ public:
     bool getInbandPort(Port &port);
     bool getVlanByVlanId(sai_vlan_id_t vlan_id, Port &vlan);
 
+    /*
+     * Look up a port without copying it. The pointer stays valid until the
+     * port is removed, so do not keep it across tasks; subscribe to
+     * SUBJECT_TYPE_PORT_CHANGE instead of caching a copy.
+     */
+    const Port *findPort(const string &alias) const;
+    const Port *findPort(sai_object_id_t id) const;
+    const Port *findPortByBridgePortId(sai_object_id_t bridge_port_id) const;
+    const Port *findVlanByVlanId(sai_vlan_id_t vlan_id) const;
+
     bool setHostIntfsOperStatus(const Port& port, bool up) const;
     void updateDbPortOperStatus(const Port& port, sai_port_oper_status_t status) const;
     void updateDbPortFlapCount(Port& port, sai_port_oper_status_t pstatus);
@@ -249,6 +259,7 @@ public:
 
     void updateGearboxPortOperStatus(const Port& port);
 
+    bool incrFdbCount(const string& alias, int count);
     bool decrFdbCount(const string& alias, int count);
 
     void setMACsecEnabledState(sai_object_id_t port_id, bool enabled);
@@ -349,6 +360,7 @@ private:
      * coming from SAI
      */
     unordered_map<sai_object_id_t, string> saiOidToAlias;
+    unordered_map<sai_vlan_id_t, string> m_vlanIdToAlias;
     unordered_map<sai_object_id_t, uint16_t> m_portOidToIndex;
     map<string, uint32_t> m_port_ref_count;
     unordered_set<string> m_pendingPortSet;
@@ -393,11 +405,12 @@ private:
     bool initializePorts(std::vector<Port>& ports);
     void initializePriorityGroupsBulk(std::vector<Port>& ports);
     void initializeQueuesBulk(std::vector<Port>& ports);
+    void initializeQueueInfoBulk(const std::vector<Port>& ports);
     void initializeSchedulerGroupsBulk(std::vector<Port>& ports);
     void initializePortHostTxReadyBulk(std::vector<Port>& ports);
     void initializePortMtuBulk(std::vector<Port>& ports);
 
-    void initializePortBufferMaximumParameters(const Port &port);
+    void initializePortBufferMaximumParameters(const std::vector<Port *>& ports);
     void initializeVoqs(Port &port);
 
     bool addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id, bool isUp);
@@ -426,7 +439,7 @@ private:
     void initPortCapAutoNeg(Port &port);
     void initPortCapLinkTraining(Port &port);
 
-    void postPortInit(Port &p);
+    void postPortInit(const std::vector<Port *>& ports);
 
     bool setPortAdminStatus(Port &port, bool up);
     bool getPortAdminStatus(sai_object_id_t id, bool& up);
@@ -450,10 +463,14 @@ private:
     bool isSpeedSupported(const std::string& alias, sai_object_id_t port_id, sai_uint32_t speed);
     void getPortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id, PortSupportedSpeeds &supported_speeds);
     void initPortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id);
+    void initPortSupportedSpeedsBulk(const std::vector<Port *>& ports);
+    void updatePortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id, const PortSupportedSpeeds &supported_speeds);
     // Get supported FEC modes on system side
     bool isFecModeSupported(const Port &port, sai_port_fec_mode_t fec_mode);
     sai_status_t getPortSupportedFecModes(PortSupportedFecModes &supported_fecmodes, sai_object_id_t port_id);
     void initPortSupportedFecModes(const std::string& alias, sai_object_id_t port_id);
+    void initPortSupportedFecModesBulk(const std::vector<Port *>& ports);
+    void updatePortSupportedFecModes(const std::string& alias, sai_object_id_t port_id, sai_status_t status);
     task_process_status setPortSpeed(Port &port, sai_uint32_t speed);
     bool getPortSpeed(sai_object_id_t id, sai_uint32_t &speed);
     bool setGearboxPortsAttr(const Port &port, sai_port_attr_t id, void *value, bool override_fec=true);
@@ -0,0 +1,639 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+
+/*
+ * PrefixTrie is a path compressed binary trie (Patricia trie) keyed by IpPrefix, with
+ * one root for IPv4 and one for IPv6.
+ *
+ * It offers the part of the std::map<IpPrefix, T> interface used for route tables plus
+ * longest prefix match and walks over the prefixes covering an address or covered by a
+ * prefix, all in O(prefix length). Keys are subnets: emplace() throws
+ * std::invalid_argument for a prefix with host bits set, such as 10.0.0.1/24, and
+ * lookups of such a prefix find nothing.
+ *
+ * Nodes and values are kept in pools and linked by index. A node takes 20 bytes and a
+ * value sizeof(value_type), without an allocation of their own; only the nodes holding
+ * a prefix have a value. Pool slots are reused but only released by clear().
+ *
+ * Iteration visits IPv4 before IPv6 and a prefix before the prefixes it covers.
+ * Erasing an entry only invalidates iterators to that entry.
+ */
+template <typename T>
+class PrefixTrie
+{
+public:
+    typedef swss::IpPrefix key_type;
+    typedef T mapped_type;
+    typedef std::pair<const swss::IpPrefix, T> value_type;
+    typedef size_t size_type;
+
+private:
+    static const int MAX_BITS = 128;
+    static const uint32_t NIL = UINT32_MAX;
+
+    struct Key
+    {
+        uint8_t bits[16];
+        int len;
+    };
+
+    /*
+     * The bits of a node are those of any prefix below it, only their length is kept.
+     * A node without a value other than a root has two children.
+     */
+    struct Node
+    {
+        uint32_t parent;
+        uint32_t child[2];
+        uint32_t value;
+        uint8_t len;
+    };
+
+    typedef typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type Storage;
+
+    /* Slots in chunks growing up to 4096 slots, which never move, addressed by index */
+    template <typename S>
+    class Pool
+    {
+    public:
+        S &operator[](uint32_t i) { return m_chunks[i >> CHUNK_BITS][i & (MAX_CHUNK - 1)]; }
+        const S &operator[](uint32_t i) const { return m_chunks[i >> CHUNK_BITS][i & (MAX_CHUNK - 1)]; }
+
+        uint32_t alloc()
+        {
+            if (!m_free.empty())
+            {
+                uint32_t i = m_free.back();
+                m_free.pop_back();
+                return i;
+            }
+            if (m_chunks.empty() || m_lastUsed == m_lastSize)
+            {
+                m_lastSize = m_chunks.empty() ? MIN_CHUNK : (m_lastSize < MAX_CHUNK ? m_lastSize * 2 : MAX_CHUNK);
+                m_lastUsed = 0;
+                m_chunks.emplace_back(new S[m_lastSize]);
+            }
+            return static_cast<uint32_t>((m_chunks.size() - 1) << CHUNK_BITS) | m_lastUsed++;
+        }
+
+        void free(uint32_t i) { m_free.push_back(i); }
+
+        void swap(Pool &other)
+        {
+            m_chunks.swap(other.m_chunks);
+            m_free.swap(other.m_free);
+            std::swap(m_lastSize, other.m_lastSize);
+            std::swap(m_lastUsed, other.m_lastUsed);
+        }
+
+    private:
+        static const uint32_t CHUNK_BITS = 12;
+        static const uint32_t MIN_CHUNK = 8;
+        static const uint32_t MAX_CHUNK = 1u << CHUNK_BITS;
+
+        std::vector<std::unique_ptr<S[]>> m_chunks;
+        std::vector<uint32_t> m_free;
+        uint32_t m_lastSize = 0;
+        uint32_t m_lastUsed = 0;
+    };
+
+public:
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef PrefixTrie::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const value_type *, value_type *>::type pointer;
+        typedef typename std::conditional<Const, const value_type &, value_type &>::type reference;
+
+        Iterator() = default;
+
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false> &other) : m_trie(other.m_trie), m_node(other.m_node) { }
+
+        reference operator*() const { return m_trie->valueOf(m_node); }
+        pointer operator->() const { return &m_trie->valueOf(m_node); }
+
+        Iterator &operator++()
+        {
+            m_node = m_trie->nextUsed(m_node);
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator &other) const { return m_node == other.m_node; }
+        bool operator!=(const Iterator &other) const { return m_node != other.m_node; }
+
+    private:
+        friend class PrefixTrie;
+        friend class Iterator<!Const>;
+
+        typedef typename std::conditional<Const, const PrefixTrie *, PrefixTrie *>::type trie_pointer;
+
+        Iterator(trie_pointer trie, uint32_t node) : m_trie(trie), m_node(node) { }
+
+        trie_pointer m_trie = nullptr;
+        uint32_t m_node = NIL;
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    PrefixTrie()
+    {
+        /* The IPv4 and IPv6 roots are nodes 0 and 1 */
+        for (int i = 0; i < 2; i++)
+        {
+            newNode(NIL, 0);
+        }
+    }
+
+    PrefixTrie(const PrefixTrie &other) : PrefixTrie()
+    {
+        for (const auto &entry : other)
+        {
+            emplace(entry.first, entry.second);
+        }
+    }
+
+    PrefixTrie(PrefixTrie &&other) : PrefixTrie()
+    {
+        swap(other);
+    }
+
+    PrefixTrie &operator=(PrefixTrie other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~PrefixTrie()
+    {
+        for (uint32_t node = firstUsed(); node != NIL; node = nextUsed(node))
+        {
+            valueOf(node).~value_type();
+        }
+    }
+
+    void swap(PrefixTrie &other)
+    {
+        m_nodes.swap(other.m_nodes);
+        m_values.swap(other.m_values);
+        std::swap(m_size, other.m_size);
+    }
+
+    iterator begin() { return iterator(this, firstUsed()); }
+    iterator end() { return iterator(this, NIL); }
+    const_iterator begin() const { return const_iterator(this, firstUsed()); }
+    const_iterator end() const { return const_iterator(this, NIL); }
+
+    bool empty() const { return m_size == 0; }
+    size_type size() const { return m_size; }
+
+    void clear()
+    {
+        PrefixTrie empty;
+        swap(empty);
+    }
+
+    iterator find(const key_type &prefix)
+    {
+        return iterator(this, findNode(prefix));
+    }
+
+    const_iterator find(const key_type &prefix) const
+    {
+        return const_iterator(this, findNode(prefix));
+    }
+
+    size_type count(const key_type &prefix) const
+    {
+        return findNode(prefix) != NIL ? 1 : 0;
+    }
+
+    T &at(const key_type &prefix)
+    {
+        uint32_t node = findNode(prefix);
+        if (node == NIL)
+            throw std::out_of_range("PrefixTrie::at");
+        return valueOf(node).second;
+    }
+
+    const T &at(const key_type &prefix) const
+    {
+        uint32_t node = findNode(prefix);
+        if (node == NIL)
+            throw std::out_of_range("PrefixTrie::at");
+        return valueOf(node).second;
+    }
+
+    T &operator[](const key_type &prefix)
+    {
+        return emplace(prefix, T()).first->second;
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> emplace(const key_type &prefix, V &&val)
+    {
+        Key key;
+        if (!makeSubnetKey(prefix, key))
+            throw std::invalid_argument("PrefixTrie: host bits set in " + prefix.to_string());
+
+        uint32_t node = insertNode(key, prefix.isV4() ? 0 : 1);
+        if (used(node))
+            return std::make_pair(iterator(this, node), false);
+
+        uint32_t value = m_values.alloc();
+        new (&m_values[value]) value_type(prefix, std::forward<V>(val));
+        m_nodes[node].value = value;
+        m_size++;
+        return std::make_pair(iterator(this, node), true);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        uint32_t node = pos.m_node;
+        uint32_t next = nextUsed(node);
+
+        valueOf(node).~value_type();
+        m_values.free(m_nodes[node].value);
+        m_nodes[node].value = NIL;
+        m_size--;
+        compress(node);
+
+        return iterator(this, next);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    size_type erase(const key_type &prefix)
+    {
+        uint32_t node = findNode(prefix);
+        if (node == NIL)
+            return 0;
+
+        erase(const_iterator(this, node));
+        return 1;
+    }
+
+    /* Longest prefix match of the address, end() if no prefix covers it */
+    iterator lookup(const swss::IpAddress &addr)
+    {
+        uint32_t best = NIL;
+        coveringNodes(addr, [&](uint32_t node) { best = node; });
+        return iterator(this, best);
+    }
+
+    const_iterator lookup(const swss::IpAddress &addr) const
+    {
+        uint32_t best = NIL;
+        coveringNodes(addr, [&](uint32_t node) { best = node; });
+        return const_iterator(this, best);
+    }
+
+    /* Visit the prefixes covering the address, shortest first */
+    template <typename Fn>
+    void forEachCovering(const swss::IpAddress &addr, Fn fn)
+    {
+        coveringNodes(addr, [&](uint32_t node) { fn(valueOf(node)); });
+    }
+
+    template <typename Fn>
+    void forEachCovering(const swss::IpAddress &addr, Fn fn) const
+    {
+        coveringNodes(addr, [&](uint32_t node) { fn(valueOf(node)); });
+    }
+
+    /* Visit the prefixes covered by the prefix, itself included, shortest first */
+    template <typename Fn>
+    void forEachCovered(const key_type &prefix, Fn fn)
+    {
+        coveredNodes(prefix, [&](uint32_t node) { fn(valueOf(node)); });
+    }
+
+    template <typename Fn>
+    void forEachCovered(const key_type &prefix, Fn fn) const
+    {
+        coveredNodes(prefix, [&](uint32_t node) { fn(valueOf(node)); });
+    }
+
+private:
+    /* The outer key is not longer than the inner one and the inner one starts with its bits */
+    static bool covers(const Key &outer, const Key &inner)
+    {
+        if (outer.len > inner.len)
+            return false;
+        return commonLength(outer, inner, outer.len) >= outer.len;
+    }
+
+    static int bit(const Key &key, int pos)
+    {
+        return (key.bits[pos >> 3] >> (7 - (pos & 7))) & 1;
+    }
+
+    static int commonLength(const Key &a, const Key &b, int maxLen)
+    {
+        int len = 0;
+        for (int i = 0; len < maxLen; i++, len += 8)
+        {
+            uint8_t diff = static_cast<uint8_t>(a.bits[i] ^ b.bits[i]);
+            if (diff)
+            {
+                while (!(diff & 0x80))
+                {
+                    diff = static_cast<uint8_t>(diff << 1);
+                    len++;
+                }
+                break;
+            }
+        }
+        return len < maxLen ? len : maxLen;
+    }
+
+    static Key makeKey(const swss::ip_addr_t &ip, int len)
+    {
+        Key key;
+        memset(key.bits, 0, sizeof(key.bits));
+        if (ip.family == AF_INET)
+            memcpy(key.bits, &ip.ip_addr.ipv4_addr, 4);
+        else
+            memcpy(key.bits, ip.ip_addr.ipv6_addr, 16);
+        key.len = MAX_BITS;
+        return makeKey(key, len);
+    }
+
+    /* Truncate the key to len bits, clearing the bits past it */
+    static Key makeKey(const Key &key, int len)
+    {
+        Key k = key;
+        int byte = len >> 3;
+        k.len = len;
+        if (len & 7)
+        {
+            k.bits[byte] = static_cast<uint8_t>(k.bits[byte] & (0xff00 >> (len & 7)));
+            byte++;
+        }
+        memset(k.bits + byte, 0, sizeof(k.bits) - static_cast<size_t>(byte));
+        return k;
+    }
+
+    static Key makeKey(const key_type &prefix)
+    {
+        return makeKey(prefix.getIp().getIp(), prefix.getMaskLength());
+    }
+
+    /* Make the key of the prefix, false if the prefix has host bits set */
+    static bool makeSubnetKey(const key_type &prefix, Key &key)
+    {
+        Key addr = makeKey(prefix.getIp().getIp(), MAX_BITS);
+        key = makeKey(addr, prefix.getMaskLength());
+        return memcmp(addr.bits, key.bits, sizeof(key.bits)) == 0;
+    }
+
+    bool used(uint32_t node) const { return m_nodes[node].value != NIL; }
+
+    value_type &valueOf(uint32_t node) { return *reinterpret_cast<value_type *>(&m_values[m_nodes[node].value]); }
+    const value_type &valueOf(uint32_t node) const { return *reinterpret_cast<const value_type *>(&m_values[m_nodes[node].value]); }
+
+    Key keyOf(uint32_t node) const { return makeKey(valueOf(node).first); }
+
+    uint32_t child(uint32_t node, const Key &key) const
+    {
+        return m_nodes[node].child[bit(key, m_nodes[node].len)];
+    }
+
+    /* A node with a value in the subtree of the node, NIL if there is none */
+    uint32_t anyUsed(uint32_t node) const
+    {
+        while (node != NIL && !used(node))
+        {
+            node = m_nodes[node].child[0] != NIL ? m_nodes[node].child[0] : m_nodes[node].child[1];
+        }
+        return node;
+    }
+
+    template <typename Fn>
+    void coveringNodes(const swss::IpAddress &addr, Fn fn) const
+    {
+        Key key = makeKey(addr.getIp(), addr.isV4() ? 32 : MAX_BITS);
+        uint32_t node = addr.isV4() ? 0 : 1;
+
+        /* The nodes without a value are passed unchecked, the prefixes below them are checked */
+        while (node != NIL)
+        {
+            if (used(node))
+            {
+                if (!covers(keyOf(node), key))
+                    break;
+                fn(node);
+            }
+            if (m_nodes[node].len == key.len)
+                break;
+            node = child(node, key);
+        }
+    }
+
+    template <typename Fn>
+    void coveredNodes(const key_type &prefix, Fn fn) const
+    {
+        Key key = makeKey(prefix);
+        uint32_t top = prefix.isV4() ? 0 : 1;
+
+        /* Descend to the top of the subtree holding the prefixes under the key */
+        while (top != NIL && m_nodes[top].len < key.len)
+        {
+            top = child(top, key);
+        }
+        uint32_t any = anyUsed(top);
+        if (any == NIL || !covers(key, keyOf(any)))
+            return;
+
+        for (uint32_t node = top; node != NIL; node = nextNode(node, top))
+        {
+            if (used(node))
+                fn(node);
+        }
+    }
+
+    uint32_t findNode(const key_type &prefix) const
+    {
+        Key key;
+        if (!makeSubnetKey(prefix, key))
+            return NIL;
+
+        uint32_t node = prefix.isV4() ? 0 : 1;
+        while (node != NIL && m_nodes[node].len < key.len)
+        {
+            node = child(node, key);
+        }
+        if (node == NIL || m_nodes[node].len != key.len || !used(node))
+            return NIL;
+        return memcmp(keyOf(node).bits, key.bits, sizeof(key.bits)) == 0 ? node : NIL;
+    }
+
+    uint32_t insertNode(const Key &key, uint32_t root)
+    {
+        /* Descend as far as the bits of the key lead */
+        uint32_t node = root;
+        while (m_nodes[node].len < key.len && child(node, key) != NIL)
+        {
+            node = child(node, key);
+        }
+
+        /* The prefixes below share the bits of the nodes above them, find where the key leaves them */
+        uint32_t any = anyUsed(node);
+        Key other = key;
+        int common = key.len;
+        if (any != NIL)
+        {
+            other = keyOf(any);
+            common = commonLength(key, other, std::min(key.len, other.len));
+        }
+        while (m_nodes[node].len > common)
+        {
+            node = m_nodes[node].parent;
+        }
+        if (m_nodes[node].len == key.len)
+        {
+            return node;
+        }
+
+        int b = bit(key, m_nodes[node].len);
+        uint32_t next = m_nodes[node].child[b];
+        if (next == NIL)
+        {
+            return attach(node, b, key.len);
+        }
+
+        /* Split the edge to the next node at the common length */
+        uint32_t split = attach(node, b, common);
+        m_nodes[next].parent = split;
+        m_nodes[split].child[bit(other, common)] = next;
+
+        if (common == key.len)
+        {
+            return split;
+        }
+        return attach(split, bit(key, common), key.len);
+    }
+
+    uint32_t newNode(uint32_t parent, int len)
+    {
+        uint32_t node = m_nodes.alloc();
+        Node &n = m_nodes[node];
+        n.parent = parent;
+        n.child[0] = n.child[1] = NIL;
+        n.value = NIL;
+        n.len = static_cast<uint8_t>(len);
+        return node;
+    }
+
+    uint32_t attach(uint32_t parent, int b, int len)
+    {
+        uint32_t node = newNode(parent, len);
+        m_nodes[parent].child[b] = node;
+        return node;
+    }
+
+    /* Drop or merge a node which no longer holds a value */
+    void compress(uint32_t node)
+    {
+        while (m_nodes[node].parent != NIL && !used(node))
+        {
+            Node &n = m_nodes[node];
+            uint32_t parent = n.parent;
+            int b = (m_nodes[parent].child[1] == node) ? 1 : 0;
+
+            if (n.child[0] != NIL && n.child[1] != NIL)
+                return;
+
+            uint32_t orphan = n.child[0] != NIL ? n.child[0] : n.child[1];
+            m_nodes[parent].child[b] = orphan;
+            m_nodes.free(node);
+            if (orphan != NIL)
+            {
+                m_nodes[orphan].parent = parent;
+                return;
+            }
+            node = parent;
+        }
+    }
+
+    /* Pre-order successor of the node within the subtree of top */
+    uint32_t nextNode(uint32_t node, uint32_t top) const
+    {
+        if (m_nodes[node].child[0] != NIL)
+            return m_nodes[node].child[0];
+        if (m_nodes[node].child[1] != NIL)
+            return m_nodes[node].child[1];
+
+        while (node != top && m_nodes[node].parent != NIL)
+        {
+            uint32_t parent = m_nodes[node].parent;
+            if (m_nodes[parent].child[0] == node && m_nodes[parent].child[1] != NIL)
+                return m_nodes[parent].child[1];
+            node = parent;
+        }
+        return NIL;
+    }
+
+    /* Pre-order successor across both roots, IPv4 first */
+    uint32_t nextNode(uint32_t node) const
+    {
+        if (m_nodes[node].child[0] != NIL)
+            return m_nodes[node].child[0];
+        if (m_nodes[node].child[1] != NIL)
+            return m_nodes[node].child[1];
+
+        while (m_nodes[node].parent != NIL)
+        {
+            uint32_t parent = m_nodes[node].parent;
+            if (m_nodes[parent].child[0] == node && m_nodes[parent].child[1] != NIL)
+                return m_nodes[parent].child[1];
+            node = parent;
+        }
+        return node == 0 ? 1 : NIL;
+    }
+
+    uint32_t nextUsed(uint32_t node) const
+    {
+        do
+        {
+            node = nextNode(node);
+        } while (node != NIL && !used(node));
+        return node;
+    }
+
+    uint32_t firstUsed() const
+    {
+        return used(0) ? 0 : nextUsed(0);
+    }
+
+    Pool<Node> m_nodes;
+    Pool<Storage> m_values;
+    size_t m_size = 0;
+};
@@ -1,7 +1,10 @@
 #include "response_publisher.h"
 
+#include <algorithm>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -36,13 +39,7 @@ void RecordDBWrite(const std::string &table, const std::string &key, const std::
         return;
     }
 
-    std::string s = table + ":" + key + "|" + op;
-    for (const auto &attr : attrs)
-    {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
-    }
-
-    swss::Recorder::Instance().respub.record(s);
+    swss::Recorder::Instance().respub.record(table + ":" + key, op, attrs);
 }
 
 void RecordResponse(const std::string &response_channel, const std::string &key,
@@ -53,19 +50,67 @@ void RecordResponse(const std::string &response_channel, const std::string &key,
         return;
     }
 
-    std::string s = response_channel + ":" + key + "|" + status;
-    for (const auto &attr : attrs)
+    swss::Recorder::Instance().respub.record(response_channel + ":" + key, status, attrs);
+}
+
+// Writes the keys of a batch of a table at once.
+// KEYS are the keys, ARGV has for each key the operation, the field count,
+// then the fields and values. The operations are 's' to set the fields, 'r'
+// to replace the entry with the fields and 'd' to delete the entry.
+const std::string kMultiWriteScript = R"(
+local i = 1
+for _, key in ipairs(KEYS) do
+    local op = ARGV[i]
+    local n = tonumber(ARGV[i + 1])
+    i = i + 2
+    if op ~= 's' then
+        redis.call('DEL', key)
+    end
+    for j = i, i + 2 * n - 1, 2 do
+        redis.call('HSET', key, ARGV[j], ARGV[j + 1])
+    end
+    i = i + 2 * n
+end
+)";
+
+// Keys written by one multi-key write at most.
+constexpr size_t kMaxMultiWriteKeys = 256;
+
+// Whether a SET has NULL attributes, which are only written to a new entry.
+bool HasNullAttribute(const std::vector<swss::FieldValueTuple> &values)
+{
+    if (!values.size())
+    {
+        return true;
+    }
+    for (const auto &fv : values)
     {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
+        if (fvField(fv) == "NULL")
+        {
+            return true;
+        }
     }
+    return false;
+}
 
-    swss::Recorder::Instance().respub.record(s);
+// All publishers, for getTotalStats(). Orchs own publishers on the ring threads too.
+std::mutex &PublishersLock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
+std::set<const ResponsePublisher *> &Publishers()
+{
+    static std::set<const ResponsePublisher *> publishers;
+    return publishers;
 }
 
 } // namespace
 
 ResponsePublisher::ResponsePublisher(const std::string &dbName, bool buffered, bool db_write_thread)
-    : m_db(std::make_unique<swss::DBConnector>(dbName, 0)), m_buffered(buffered)
+    : m_db_name(dbName), m_db(std::make_unique<swss::DBConnector>(dbName, 0)), m_buffered(buffered),
+      m_db_write_thread(db_write_thread)
 {
     if (m_buffered)
     {
@@ -77,23 +122,27 @@ ResponsePublisher::ResponsePublisher(const std::string &dbName, bool buffered, b
         m_ntf_pipe = std::make_unique<swss::RedisPipeline>(m_db.get(), 1);
         m_db_pipe = std::make_unique<swss::RedisPipeline>(m_db.get(), 1);
     }
-    if (db_write_thread)
-    {
-        m_update_thread = std::unique_ptr<std::thread>(new std::thread(&ResponsePublisher::dbUpdateThread, this));
-    }
+
+    std::lock_guard<std::mutex> lock(PublishersLock());
+    Publishers().insert(this);
 }
 
 ResponsePublisher::~ResponsePublisher()
 {
-    if (m_update_thread != nullptr)
     {
+        std::lock_guard<std::mutex> lock(PublishersLock());
+        Publishers().erase(this);
+    }
+
+    for (auto &it : m_writers)
+    {
+        auto &w = *it.second;
         {
-            std::lock_guard<std::mutex> lock(m_lock);
-            m_queue.emplace(/*table=*/"", /*key=*/"", /*values =*/std::vector<swss::FieldValueTuple>{}, /*op=*/"",
-                            /*replace=*/false, /*flush=*/false, /*shutdown=*/true);
+            std::lock_guard<std::mutex> lock(w.lock);
+            w.shutdown = true;
         }
-        m_signal.notify_one();
-        m_update_thread->join();
+        w.signal.notify_one();
+        w.thread->join();
     }
 }
 
@@ -140,26 +189,36 @@ void ResponsePublisher::publish(const std::string &table, const std::string &key
 void ResponsePublisher::writeToDB(const std::string &table, const std::string &key,
                                   const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace)
 {
-    if (m_update_thread != nullptr)
+    if (m_db_write_thread)
     {
+        auto &w = getWriter(table);
+        bool idle;
+        {
+            std::lock_guard<std::mutex> lock(w.lock);
+            // The thread is only signaled when it may be waiting, writes
+            // queued while it is busy are taken with the current batch.
+            idle = w.queue.empty();
+            w.queue.emplace_back(table, key, values, op, replace);
+            w.stats.queued++;
+        }
+        if (idle)
         {
-            std::lock_guard<std::mutex> lock(m_lock);
-            m_queue.emplace(table, key, values, op, replace, /*flush=*/false, /*shutdown=*/false);
+            w.signal.notify_one();
         }
-        m_signal.notify_one();
     }
     else
     {
-        writeToDBInternal(table, key, values, op, replace);
+        writeToDBInternal(m_db_pipe.get(), table, key, values, op, replace);
+        m_written.fetch_add(1, std::memory_order_relaxed);
     }
     RecordDBWrite(table, key, values, op);
 }
 
-void ResponsePublisher::writeToDBInternal(const std::string &table, const std::string &key,
+void ResponsePublisher::writeToDBInternal(swss::RedisPipeline *pipe, const std::string &table, const std::string &key,
                                           const std::vector<swss::FieldValueTuple> &values, const std::string &op,
                                           bool replace)
 {
-    swss::Table applStateTable{m_db_pipe.get(), table, m_buffered};
+    swss::Table applStateTable{pipe, table, m_buffered};
 
     auto attrs = values;
     if (op == SET_COMMAND)
@@ -168,6 +227,15 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
         {
             applStateTable.del(key);
         }
+
+        // The existing entry only matters for NULL attributes, which are
+        // written to a new entry only. Other attributes are written as is,
+        // without reading the entry back, which would flush the pipeline.
+        if (!HasNullAttribute(values))
+        {
+            applStateTable.set(key, attrs);
+            return;
+        }
         if (!values.size())
         {
             attrs.push_back(swss::FieldValueTuple("NULL", "NULL"));
@@ -176,7 +244,7 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
         // Write to DB only if the key does not exist or non-NULL attributes are
         // being written to the entry.
         std::vector<swss::FieldValueTuple> fv;
-        if (!applStateTable.get(key, fv))
+        if (replace || !applStateTable.get(key, fv))
         {
             applStateTable.set(key, attrs);
             return;
@@ -206,14 +274,18 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
 void ResponsePublisher::flush()
 {
     m_ntf_pipe->flush();
-    if (m_update_thread != nullptr)
+    if (m_db_write_thread)
     {
+        std::lock_guard<std::mutex> writers_lock(m_writers_lock);
+        for (auto &it : m_writers)
         {
-            std::lock_guard<std::mutex> lock(m_lock);
-            m_queue.emplace(/*table=*/"", /*key=*/"", /*values =*/std::vector<swss::FieldValueTuple>{}, /*op=*/"",
-                            /*replace=*/false, /*flush=*/true, /*shutdown=*/false);
+            auto &w = *it.second;
+            {
+                std::lock_guard<std::mutex> lock(w.lock);
+                w.flush = true;
+            }
+            w.signal.notify_one();
         }
-        m_signal.notify_one();
     }
     else
     {
@@ -226,32 +298,202 @@ void ResponsePublisher::setBuffered(bool buffered)
     m_buffered = buffered;
 }
 
-void ResponsePublisher::dbUpdateThread()
+ResponsePublisher::Stats ResponsePublisher::getStats() const
 {
-    while (true)
+    Stats stats;
+    if (!m_db_write_thread)
+    {
+        stats.queued = stats.written = m_written.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::lock_guard<std::mutex> writers_lock(m_writers_lock);
+    for (const auto &it : m_writers)
     {
-        entry e;
+        const auto &w = *it.second;
+        std::lock_guard<std::mutex> lock(w.lock);
+        stats.queued += w.stats.queued;
+        stats.written += w.stats.written;
+        stats.depth += w.queue.size();
+        stats.maxLatencyUs = std::max(stats.maxLatencyUs, w.stats.maxLatencyUs);
+        stats.totalLatencyUs += w.stats.totalLatencyUs;
+    }
+    return stats;
+}
+
+std::map<std::string, ResponsePublisher::Stats> ResponsePublisher::getTotalStats()
+{
+    std::map<std::string, Stats> totals;
+
+    std::lock_guard<std::mutex> lock(PublishersLock());
+    for (const auto *publisher : Publishers())
+    {
+        auto stats = publisher->getStats();
+        auto &total = totals[publisher->m_db_name];
+        total.queued += stats.queued;
+        total.written += stats.written;
+        total.depth += stats.depth;
+        total.maxLatencyUs = std::max(total.maxLatencyUs, stats.maxLatencyUs);
+        total.totalLatencyUs += stats.totalLatencyUs;
+    }
+    return totals;
+}
+
+ResponsePublisher::writer &ResponsePublisher::getWriter(const std::string &table)
+{
+    std::lock_guard<std::mutex> lock(m_writers_lock);
+    auto &w = m_writers[table];
+    if (!w)
+    {
+        w = std::make_unique<writer>();
+        // Each thread writes through its own connection.
+        if (m_buffered)
+        {
+            w->pipe = std::make_unique<swss::RedisPipeline>(m_db.get());
+        }
+        else
         {
-            std::unique_lock<std::mutex> lock(m_lock);
-            while (m_queue.empty())
+            w->pipe = std::make_unique<swss::RedisPipeline>(m_db.get(), 1);
+        }
+        w->key_prefix = table + swss::SonicDBConfig::getSeparator(m_db.get());
+        w->multi_write_sha = w->pipe->loadRedisScript(kMultiWriteScript);
+        w->thread = std::make_unique<std::thread>(&ResponsePublisher::dbUpdateThread, this, std::ref(*w));
+    }
+    return *w;
+}
+
+void ResponsePublisher::writeBatch(writer &w, const std::vector<entry> &batch)
+{
+    std::vector<std::string> keys;
+    std::vector<std::string> args;
+    auto multiWrite = [&]() {
+        if (keys.empty())
+        {
+            return;
+        }
+
+        std::vector<const char *> argv;
+        std::vector<size_t> argvlen;
+        auto add = [&](const std::string &arg) {
+            argv.push_back(arg.c_str());
+            argvlen.push_back(arg.size());
+        };
+        std::string numkeys = std::to_string(keys.size());
+        std::string evalsha = "EVALSHA";
+        add(evalsha);
+        add(w.multi_write_sha);
+        add(numkeys);
+        for (const auto &key : keys)
+        {
+            add(key);
+        }
+        for (const auto &arg : args)
+        {
+            add(arg);
+        }
+
+        swss::RedisCommand command;
+        command.formatArgv(static_cast<int>(argv.size()), argv.data(), argvlen.data());
+        w.pipe->push(command, REDIS_REPLY_NIL);
+        keys.clear();
+        args.clear();
+    };
+
+    for (const auto &e : batch)
+    {
+        if (e.op != SET_COMMAND && e.op != DEL_COMMAND)
+        {
+            continue;
+        }
+
+        // A SET of NULL attributes reads the entry back, so it is written on
+        // its own, after the keys before it.
+        if (e.op == SET_COMMAND && !e.replace && HasNullAttribute(e.values))
+        {
+            multiWrite();
+            writeToDBInternal(w.pipe.get(), e.table, e.key, e.values, e.op, e.replace);
+            continue;
+        }
+
+        keys.push_back(w.key_prefix + e.key);
+        if (e.op == SET_COMMAND)
+        {
+            args.push_back(e.replace ? "r" : "s");
+            if (!e.values.size())
             {
-                m_signal.wait(lock);
+                args.push_back("1");
+                args.push_back("NULL");
+                args.push_back("NULL");
             }
+            else
+            {
+                args.push_back(std::to_string(e.values.size()));
+                for (const auto &fv : e.values)
+                {
+                    args.push_back(fvField(fv));
+                    args.push_back(fvValue(fv));
+                }
+            }
+        }
+        else
+        {
+            args.push_back("d");
+            args.push_back("0");
+        }
+
+        if (keys.size() == kMaxMultiWriteKeys)
+        {
+            multiWrite();
+        }
+    }
+    multiWrite();
+}
+
+void ResponsePublisher::dbUpdateThread(writer &w)
+{
+    std::vector<entry> batch;
+    while (true)
+    {
+        bool flush;
+        bool shutdown;
+        {
+            std::unique_lock<std::mutex> lock(w.lock);
+            w.signal.wait(lock, [&] { return !w.queue.empty() || w.flush || w.shutdown; });
 
-            e = m_queue.front();
-            m_queue.pop();
+            batch.clear();
+            batch.swap(w.queue);
+            flush = w.flush;
+            shutdown = w.shutdown;
+            w.flush = false;
         }
-        if (e.shutdown)
+
+        writeBatch(w, batch);
+        if (flush || shutdown)
         {
-            break;
+            w.pipe->flush();
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        uint64_t max_latency = 0;
+        uint64_t total_latency = 0;
+        for (const auto &e : batch)
+        {
+            auto latency = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - e.queued).count());
+            max_latency = std::max(max_latency, latency);
+            total_latency += latency;
         }
-        if (e.flush)
+
         {
-            m_db_pipe->flush();
+            std::lock_guard<std::mutex> lock(w.lock);
+            w.stats.written += batch.size();
+            w.stats.maxLatencyUs = std::max(w.stats.maxLatencyUs, max_latency);
+            w.stats.totalLatencyUs += total_latency;
         }
-        else
+
+        if (shutdown)
         {
-            writeToDBInternal(e.table, e.key, e.values, e.op, e.replace);
+            break;
         }
     }
 }
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -18,9 +20,26 @@
 // This class performs two tasks when publish is called:
 // 1. Sends a notification into the redis channel.
 // 2. Writes the operation into the DB.
+//
+// With db_write_thread, the DB writes of each table are done by a thread of
+// the table with its own pipeline. The writes of a table are done in order,
+// but writes to different tables may be reordered. The writes a thread takes
+// at once are coalesced into multi-key writes.
 class ResponsePublisher : public ResponsePublisherInterface
 {
   public:
+    struct Stats
+    {
+        // DB writes requested and done so far.
+        uint64_t queued = 0;
+        uint64_t written = 0;
+        // DB writes waiting for a write thread.
+        uint64_t depth = 0;
+        // Time between a DB write request and its write to the pipeline.
+        uint64_t maxLatencyUs = 0;
+        uint64_t totalLatencyUs = 0;
+    };
+
     explicit ResponsePublisher(const std::string &dbName, bool buffered = false, bool db_write_thread = false);
 
     virtual ~ResponsePublisher();
@@ -60,6 +79,18 @@ class ResponsePublisher : public ResponsePublisherInterface
      */
     void setBuffered(bool buffered);
 
+    /**
+     * @brief Get the DB write counters
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief Get the DB write counters of all publishers, summed by DB
+     *
+     * The max latency is the max of all publishers.
+     */
+    static std::map<std::string, Stats> getTotalStats();
+
   private:
     struct entry
     {
@@ -68,32 +99,53 @@ class ResponsePublisher : public ResponsePublisherInterface
         std::vector<swss::FieldValueTuple> values;
         std::string op;
         bool replace;
-        bool flush;
-        bool shutdown;
-
-        entry()
-        {
-        }
+        std::chrono::steady_clock::time_point queued;
 
         entry(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &values,
-              const std::string &op, bool replace, bool flush, bool shutdown)
-            : table(table), key(key), values(values), op(op), replace(replace), flush(flush), shutdown(shutdown)
+              const std::string &op, bool replace)
+            : table(table), key(key), values(values), op(op), replace(replace),
+              queued(std::chrono::steady_clock::now())
         {
         }
     };
 
-    void dbUpdateThread();
-    void writeToDBInternal(const std::string &table, const std::string &key,
+    // The DB write thread of a table and the writes it has to do.
+    struct writer
+    {
+        std::unique_ptr<swss::RedisPipeline> pipe;
+        // The table name and separator, prepended to the keys.
+        std::string key_prefix;
+        // SHA of the multi-key write script loaded in the pipeline.
+        std::string multi_write_sha;
+        // Taken as a whole by the thread, so a burst of writes costs one
+        // wake-up.
+        std::vector<entry> queue;
+        bool flush{false};
+        bool shutdown{false};
+        Stats stats;
+        mutable std::mutex lock;
+        std::condition_variable signal;
+        std::unique_ptr<std::thread> thread;
+    };
+
+    writer &getWriter(const std::string &table);
+    void dbUpdateThread(writer &w);
+    void writeBatch(writer &w, const std::vector<entry> &batch);
+    void writeToDBInternal(swss::RedisPipeline *pipe, const std::string &table, const std::string &key,
                            const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace);
 
+    std::string m_db_name;
     std::unique_ptr<swss::DBConnector> m_db;
     std::unique_ptr<swss::RedisPipeline> m_ntf_pipe;
     std::unique_ptr<swss::RedisPipeline> m_db_pipe;
 
     bool m_buffered{false};
-    // Thread to write to DB.
-    std::unique_ptr<std::thread> m_update_thread;
-    std::queue<entry> m_queue;
-    mutable std::mutex m_lock;
-    std::condition_variable m_signal;
+    // Write to DB from a thread of each table, else from the caller.
+    bool m_db_write_thread{false};
+    // Threads to write to DB by table, added on the first write of a table.
+    std::unordered_map<std::string, std::unique_ptr<writer>> m_writers;
+    // Held to add a writer, the stats are read from other threads.
+    mutable std::mutex m_writers_lock;
+    // Writes done from the caller, which may be a ring thread.
+    std::atomic<uint64_t> m_written{0};
 };
@@ -13,6 +13,7 @@
 #include "swssnet.h"
 #include "crmorch.h"
 #include "directory.h"
+#include "routetrace.h"
 
 extern sai_object_id_t gVirtualRouterId;
 extern sai_object_id_t gSwitchId;
@@ -31,6 +32,7 @@ extern FlowCounterRouteOrch *gFlowCounterRouteOrch;
 extern TunnelDecapOrch *gTunneldecapOrch;
 
 extern size_t gMaxBulkSize;
+extern bool gAsyncRouteBulk;
 extern string gMySwitchType;
 
 /* Default maximum number of next hop groups */
@@ -56,6 +58,21 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     m_publisher.setBuffered(true);
 
+    /* Routes do not depend on the order of other route keys, keep pending routes in a flat SyncMap */
+    auto routeConsumer = dynamic_cast<ConsumerBase *>(getExecutor(APP_ROUTE_TABLE_NAME));
+    if (routeConsumer)
+    {
+        routeConsumer->m_toSync.setFlat(true);
+    }
+
+    /* The pending completions are run on the main thread, the ring threads would race with them */
+    if (gAsyncRouteBulk && !gRingBuffer)
+    {
+        m_bulkFlushEvent = new RouteBulkFlushEvent(this);
+        Orch::addExecutor(m_bulkFlushEvent);
+        SWSS_LOG_NOTICE("Route bulks are flushed asynchronously");
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_SWITCH_ATTR_NUMBER_OF_ECMP_GROUPS;
 
@@ -317,18 +334,16 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
         observerEntry = m_nextHopObservers.find(host);
 
         /* Find the prefixes that cover the destination IP */
-        if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
+        auto routeTable = m_syncdRoutes.find(vrf_id);
+        if (routeTable != m_syncdRoutes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
+            routeTable->second.forEachCovering(dstAddr, [&](const RouteTable::value_type &route)
             {
-                if (route.first.isAddressInSubnet(dstAddr))
-                {
-                    SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
-                    observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
-                }
-            }
+                SWSS_LOG_INFO("Prefix %s covers destination address",
+                        route.first.to_string().c_str());
+                observerEntry->second.routeTable.emplace(
+                        route.first, route.second);
+            });
         }
     }
 
@@ -616,18 +631,15 @@ void RouteOrch::doTask(ConsumerBase& consumer)
         return;
     }
 
+    /* Routes of a bulk still in flight are in m_toSync until its post processing ran */
+    Executor::runPendingCompletions();
+
     /* Default handling is for APP_ROUTE_TABLE_NAME */
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
         // Route bulk results will be stored in a map
-        std::map<
-                std::pair<
-                        std::string,            // Key
-                        std::string             // Op
-                >,
-                RouteBulkContext
-        >                                       toBulk;
+        RouteBulkContextMap toBulk;
 
         // Add or remove routes with a route bulker
         while (it != consumer.m_toSync.end())
@@ -637,6 +649,8 @@ void RouteOrch::doTask(ConsumerBase& consumer)
             string key = kfvKey(t);
             string op = kfvOp(t);
 
+            RouteTracer::Instance().stamp(key, RouteTracer::ORCH_DOTASK);
+
             auto rc = toBulk.emplace(std::piecewise_construct,
                     std::forward_as_tuple(key, op),
                     std::forward_as_tuple(key, (op == SET_COMMAND)));
@@ -662,7 +676,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                 {
                     /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
                     SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
+                    for (const auto &j : m_syncdRoutes)
                     {
                         string vrf;
 
@@ -671,7 +685,7 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                             vrf = m_vrfOrch->getVRFname(j.first) + ":";
                         }
 
-                        for (auto i : j.second)
+                        for (const auto &i : j.second)
                         {
                             vector<FieldValueTuple> v;
                             key = vrf + i.first.to_string();
@@ -719,6 +733,15 @@ void RouteOrch::doTask(ConsumerBase& consumer)
                 ip_prefix = IpPrefix(key);
             }
 
+            /* Routes are keyed by subnet, reject prefixes with host bits set */
+            if (!(ip_prefix.getSubnet() == ip_prefix))
+            {
+                SWSS_LOG_ERROR("Route %s has host bits set, expected %s",
+                        key.c_str(), ip_prefix.getSubnet().to_string().c_str());
+                it = consumer.m_toSync.erase(it);
+                continue;
+            }
+
             if (op == SET_COMMAND)
             {
                 string ips;
@@ -1103,138 +1126,163 @@ void RouteOrch::doTask(ConsumerBase& consumer)
         }
 
         // Flush the route bulker, so routes will be written to syncd and ASIC
-        gRouteBulker.flush();
-
-        // Go through the bulker results
-        auto it_prev = consumer.m_toSync.begin();
-        m_bulkNhgReducedRefCnt.clear();
-        NextHopGroupKey v4_default_nhg_key;
-        NextHopGroupKey v6_default_nhg_key;
-        m_bulkSrv6NhgReducedVec.clear();
-
-        while (it_prev != it)
+        if (m_bulkFlushEvent && it == consumer.m_toSync.end())
         {
-            KeyOpFieldsValuesTuple t = it_prev->second;
+            /*
+             * Keep the bulk in flight while the main loop waits for and pops the next batch.
+             * The post processing updates the state the next batch is checked against, so
+             * it completes before any other task runs.
+             */
+            auto pending = std::make_shared<RouteBulkContextMap>(std::move(toBulk));
+            auto event = m_bulkFlushEvent;
+            gRouteBulker.flush_async([event]() { event->notify(); });
+            Executor::addPendingCompletion([this, &consumer, pending]() {
+                gRouteBulker.wait();
+                RouteTracer::Instance().stampAll(RouteTracer::BULK_FLUSH);
+                postRouteBulk(consumer, *pending, consumer.m_toSync.end());
+            });
+            return;
+        }
 
-            string key = kfvKey(t);
-            string op = kfvOp(t);
-            auto found = toBulk.find(make_pair(key, op));
-            if (found == toBulk.end())
-            {
-                it_prev++;
-                continue;
-            }
+        gRouteBulker.flush();
+        RouteTracer::Instance().stampAll(RouteTracer::BULK_FLUSH);
+        postRouteBulk(consumer, toBulk, it);
+    }
+}
 
-            const auto& ctx = found->second;
-            const auto& object_statuses = ctx.object_statuses;
-            if (object_statuses.empty())
-            {
-                it_prev++;
-                continue;
-            }
+void RouteOrch::postRouteBulk(ConsumerBase& consumer, RouteBulkContextMap& toBulk, SyncMap::iterator it)
+{
+    SWSS_LOG_ENTER();
 
-            const sai_object_id_t& vrf_id = ctx.vrf_id;
-            const IpPrefix& ip_prefix = ctx.ip_prefix;
+    // Go through the bulker results
+    auto it_prev = consumer.m_toSync.begin();
+    m_bulkNhgReducedRefCnt.clear();
+    NextHopGroupKey v4_default_nhg_key;
+    NextHopGroupKey v6_default_nhg_key;
+    m_bulkSrv6NhgReducedVec.clear();
 
-            sai_route_entry_t route_entry;
-            route_entry.vr_id = vrf_id;
-            route_entry.switch_id = gSwitchId;
-            copy(route_entry.destination, ip_prefix);
-            
-            if (op == SET_COMMAND)
-            {
-                const bool& excp_intfs_flag = ctx.excp_intfs_flag;
+    while (it_prev != it)
+    {
+        KeyOpFieldsValuesTuple t = it_prev->second;
 
-                if (excp_intfs_flag)
-                {
-                    /* If any existing routes are updated to point to the
-                     * above interfaces, remove them from the ASIC. */
-                    if (removeRoutePost(ctx))
-                        it_prev = consumer.m_toSync.erase(it_prev);
-                    else
-                        it_prev++;
-                    continue;
-                }
+        string key = kfvKey(t);
+        string op = kfvOp(t);
+        auto found = toBulk.find(make_pair(key, op));
+        if (found == toBulk.end())
+        {
+            it_prev++;
+            continue;
+        }
 
-                const NextHopGroupKey& nhg = ctx.nhg;
+        const auto& ctx = found->second;
+        const auto& object_statuses = ctx.object_statuses;
+        if (object_statuses.empty())
+        {
+            it_prev++;
+            continue;
+        }
 
-                if (nhg.getSize() == 1 && nhg.hasIntfNextHop())
-                {
-                    if (addRoutePost(ctx, nhg))
-                        it_prev = consumer.m_toSync.erase(it_prev);
-                    else
-                        it_prev++;
-                }
-                else if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end() ||
-                         m_syncdRoutes.at(vrf_id).find(ip_prefix) == m_syncdRoutes.at(vrf_id).end() ||
-                         m_syncdRoutes.at(vrf_id).at(ip_prefix) != RouteNhg(nhg, ctx.nhg_index, ctx.context_index) ||
-                         gRouteBulker.bulk_entry_pending_removal(route_entry) ||
-                         ctx.using_temp_nhg)
-                {
-                    if (addRoutePost(ctx, nhg))
-                        it_prev = consumer.m_toSync.erase(it_prev);
-                    else
-                        it_prev++;
+        const sai_object_id_t& vrf_id = ctx.vrf_id;
+        const IpPrefix& ip_prefix = ctx.ip_prefix;
 
-		    // Save the Default Route of Default VRF to be used for 
-		    // enabling fallback to it as needed
-                    if (ip_prefix.isDefaultRoute() && vrf_id == gVirtualRouterId)
-                    {
-                       if (ip_prefix.isV4())
-                       {
-                            v4_default_nhg_key = getSyncdRouteNhgKey(gVirtualRouterId, ip_prefix);
-                       }
-                       else
-                       {
-                            v6_default_nhg_key = getSyncdRouteNhgKey(gVirtualRouterId, ip_prefix);
-                       }
-                    }
-                }
-            }
-            else if (op == DEL_COMMAND)
+        sai_route_entry_t route_entry;
+        route_entry.vr_id = vrf_id;
+        route_entry.switch_id = gSwitchId;
+        copy(route_entry.destination, ip_prefix);
+        
+        if (op == SET_COMMAND)
+        {
+            const bool& excp_intfs_flag = ctx.excp_intfs_flag;
+
+            if (excp_intfs_flag)
             {
-                /* Cannot locate the route or remove succeed */
+                /* If any existing routes are updated to point to the
+                 * above interfaces, remove them from the ASIC. */
                 if (removeRoutePost(ctx))
                     it_prev = consumer.m_toSync.erase(it_prev);
                 else
                     it_prev++;
+                continue;
             }
-        }
 
-        /* Remove next hop group if the reference count decreases to zero */
-        for (auto& it_nhg : m_bulkNhgReducedRefCnt)
-        {
-            if (it_nhg.first.is_overlay_nexthop() && it_nhg.second != 0)
+            const NextHopGroupKey& nhg = ctx.nhg;
+
+            if (nhg.getSize() == 1 && nhg.hasIntfNextHop())
             {
-                removeOverlayNextHops(it_nhg.second, it_nhg.first);
+                if (addRoutePost(ctx, nhg))
+                    it_prev = consumer.m_toSync.erase(it_prev);
+                else
+                    it_prev++;
             }
-            else if (m_syncdNextHopGroups[it_nhg.first].ref_count == 0)
+            else if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end() ||
+                     m_syncdRoutes.at(vrf_id).find(ip_prefix) == m_syncdRoutes.at(vrf_id).end() ||
+                     m_syncdRoutes.at(vrf_id).at(ip_prefix) != RouteNhg(nhg, ctx.nhg_index, ctx.context_index) ||
+                     gRouteBulker.bulk_entry_pending_removal(route_entry) ||
+                     ctx.using_temp_nhg)
             {
-                // Pass the flag to indicate if the NextHop Group as Default Route NH Members as swapped.
-                removeNextHopGroup(it_nhg.first, m_syncdNextHopGroups[it_nhg.first].is_default_route_nh_swap);
+                if (addRoutePost(ctx, nhg))
+                    it_prev = consumer.m_toSync.erase(it_prev);
+                else
+                    it_prev++;
+
+		    // Save the Default Route of Default VRF to be used for 
+		    // enabling fallback to it as needed
+                if (ip_prefix.isDefaultRoute() && vrf_id == gVirtualRouterId)
+                {
+                   if (ip_prefix.isV4())
+                   {
+                        v4_default_nhg_key = getSyncdRouteNhgKey(gVirtualRouterId, ip_prefix);
+                   }
+                   else
+                   {
+                        v6_default_nhg_key = getSyncdRouteNhgKey(gVirtualRouterId, ip_prefix);
+                   }
+                }
             }
         }
-        /* Reduce reference for srv6 next hop group */
-        /* Later delete for increase refcnt early */
-        if (!m_bulkSrv6NhgReducedVec.empty())
+        else if (op == DEL_COMMAND)
         {
-            m_srv6Orch->removeSrv6Nexthops(m_bulkSrv6NhgReducedVec);
+            /* Cannot locate the route or remove succeed */
+            if (removeRoutePost(ctx))
+                it_prev = consumer.m_toSync.erase(it_prev);
+            else
+                it_prev++;
         }
-        /* No Update to Default Route so we can return */
-        if (!(v4_default_nhg_key.getSize()) && !(v6_default_nhg_key.getSize()))
+    }
+
+    /* Remove next hop group if the reference count decreases to zero */
+    for (auto& it_nhg : m_bulkNhgReducedRefCnt)
+    {
+        if (it_nhg.first.is_overlay_nexthop() && it_nhg.second != 0)
         {
-            return;
+            removeOverlayNextHops(it_nhg.second, it_nhg.first);
         }
-	/* Update to v4 Default Route so update the data structure */
-        if (v4_default_nhg_key.getSize())
+        else if (m_syncdNextHopGroups[it_nhg.first].ref_count == 0)
         {
-            updateDefaultRouteSwapSet(v4_default_nhg_key, v4_active_default_route_nhops);
+            // Pass the flag to indicate if the NextHop Group as Default Route NH Members as swapped.
+            removeNextHopGroup(it_nhg.first, m_syncdNextHopGroups[it_nhg.first].is_default_route_nh_swap);
         }
+    }
+    /* Reduce reference for srv6 next hop group */
+    /* Later delete for increase refcnt early */
+    if (!m_bulkSrv6NhgReducedVec.empty())
+    {
+        m_srv6Orch->removeSrv6Nexthops(m_bulkSrv6NhgReducedVec);
+    }
+    /* No Update to Default Route so we can return */
+    if (!(v4_default_nhg_key.getSize()) && !(v6_default_nhg_key.getSize()))
+    {
+        return;
+    }
+	/* Update to v4 Default Route so update the data structure */
+    if (v4_default_nhg_key.getSize())
+    {
+        updateDefaultRouteSwapSet(v4_default_nhg_key, v4_active_default_route_nhops);
+    }
 	/* Update to v6 Default Route so update the data structure */
-        if (v6_default_nhg_key.getSize())
-        {
-            updateDefaultRouteSwapSet(v6_default_nhg_key, v6_active_default_route_nhops);
-        }
+    if (v6_default_nhg_key.getSize())
+    {
+        updateDefaultRouteSwapSet(v6_default_nhg_key, v6_active_default_route_nhops);
     }
 }
 
@@ -3162,6 +3210,7 @@ void RouteOrch::publishRouteState(const RouteBulkContext& ctx, const ReturnCode&
     const bool replace = false;
 
     m_publisher.publish(APP_ROUTE_TABLE_NAME, ctx.key, fvs, status, replace);
+    RouteTracer::Instance().complete(ctx.key, RouteTracer::RESPONSE);
 }
 
 inline bool RouteOrch::isVipRoute(const IpPrefix &ipPrefix, const NextHopGroupKey &nextHops)
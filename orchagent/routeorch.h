@@ -15,9 +15,11 @@
 #include "nexthopgroupkey.h"
 #include "bulker.h"
 #include "fgnhgorch.h"
+#include "prefixtrie.h"
 #include <map>
 #include "zmqorch.h"
 #include "zmqserver.h"
+#include "selectableevent.h"
 #include <unordered_map>
 
 /* Maximum next hop group number */
@@ -109,7 +111,7 @@ struct RouteKey
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
 typedef std::unordered_map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
 /* RouteTable: destination network, NextHopGroupKey */
-typedef std::map<IpPrefix, RouteNhg> RouteTable;
+typedef PrefixTrie<RouteNhg> RouteTable;
 /* RouteTables: vrf_id, RouteTable */
 typedef std::map<sai_object_id_t, RouteTable> RouteTables;
 /* LabelRouteTable: destination label, next hop address(es) */
@@ -120,12 +122,14 @@ typedef std::map<sai_object_id_t, LabelRouteTable> LabelRouteTables;
 typedef std::pair<sai_object_id_t, IpAddress> Host;
 /* NextHopObserverTable: Host, next hop observer entry */
 typedef std::map<Host, NextHopObserverEntry> NextHopObserverTable;
+/* NextHopObserverRouteTable: covering prefix, NextHopGroupKey; rbegin() is the longest match */
+typedef std::map<IpPrefix, RouteNhg> NextHopObserverRouteTable;
 /* Single Nexthop to Routemap */
 typedef std::map<NextHopKey, std::set<RouteKey>> NextHopRouteTable;
 
 struct NextHopObserverEntry
 {
-    RouteTable routeTable;
+    NextHopObserverRouteTable routeTable;
     list<Observer *> observers;
 };
 
@@ -177,6 +181,30 @@ struct RouteBulkContext
     }
 };
 
+/* Route bulk contexts of one batch, by (key, op) */
+typedef std::map<std::pair<std::string, std::string>, RouteBulkContext> RouteBulkContextMap;
+
+/* Wakes up the select loop once an asynchronous route bulk flush completed */
+class RouteBulkFlushEvent : public Executor
+{
+public:
+    RouteBulkFlushEvent(Orch *orch)
+        : Executor(new swss::SelectableEvent(), orch, "ROUTE_BULK_FLUSH_EVENT")
+    {
+    }
+
+    void notify()
+    {
+        static_cast<swss::SelectableEvent *>(getSelectable())->notify();
+    }
+
+    void execute() override
+    {
+        // The pending route bulk completion runs ahead of any task
+        processAnyTask([]() {});
+    }
+};
+
 struct LabelRouteBulkContext
 {
     std::deque<sai_status_t>            object_statuses;    // Bulk statuses
@@ -303,6 +331,9 @@ private:
     EntityBulker<sai_mpls_api_t>            gLabelRouteBulker;
     ObjectBulker<sai_next_hop_group_api_t>  gNextHopGroupMemberBulker;
 
+    /* Set if route bulks are flushed asynchronously, see gAsyncRouteBulk */
+    RouteBulkFlushEvent *m_bulkFlushEvent = nullptr;
+
     void addTempRoute(RouteBulkContext& ctx, const NextHopGroupKey&);
 
     void addTempLabelRoute(LabelRouteBulkContext& ctx, const NextHopGroupKey&);
@@ -315,6 +346,8 @@ private:
 
     void doTask(ConsumerBase& consumer);
     void doLabelTask(ConsumerBase& consumer);
+    /* Handle the bulk results of the tasks before 'it', erasing the completed ones */
+    void postRouteBulk(ConsumerBase& consumer, RouteBulkContextMap& toBulk, SyncMap::iterator it);
 
     const NhgBase &getNhg(const std::string& nhg_index);
 
@@ -0,0 +1,539 @@
+#ifndef SWSS_SYNCMAP_H
+#define SWSS_SYNCMAP_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "table.h"
+
+/*
+ * SyncMap holds the pending tasks of a Consumer (m_toSync).
+ *
+ * By default it is a std::multimap ordered by key, so tasks with the same key keep their
+ * insertion order (e.g. DEL then SET). With setFlat(true) the tasks are kept in a pooled,
+ * insertion-ordered list instead, indexed by an open-addressing hash table on the key:
+ * - tasks with the same key are still adjacent and in insertion order,
+ * - keys are iterated in the order they were first added, not in key order,
+ * - adding or erasing a task reuses a pooled node and does not rebalance a tree.
+ *
+ * Both modes offer the part of the multimap interface used by the Orchs. As with the
+ * multimap, an iterator stays valid until the task it points to is erased.
+ */
+class SyncMap
+{
+public:
+    typedef std::string key_type;
+    typedef swss::KeyOpFieldsValuesTuple mapped_type;
+    typedef std::pair<const std::string, swss::KeyOpFieldsValuesTuple> value_type;
+    typedef size_t size_type;
+
+private:
+    typedef std::multimap<key_type, mapped_type> ordered_map;
+
+    static constexpr size_t npos = SIZE_MAX;
+
+    struct Node
+    {
+        typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type storage;
+        size_t prev;
+        size_t next;
+
+        value_type &value() { return *reinterpret_cast<value_type *>(&storage); }
+        const value_type &value() const { return *reinterpret_cast<const value_type *>(&storage); }
+    };
+
+    /* Index slot: first and last node of the run of tasks sharing a key */
+    struct Slot
+    {
+        size_t hash;
+        size_t head = npos;
+        size_t tail = npos;
+    };
+
+public:
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef SyncMap::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const value_type *, value_type *>::type pointer;
+        typedef typename std::conditional<Const, const value_type &, value_type &>::type reference;
+
+        Iterator() = default;
+
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false> &other)
+            : m_map(other.m_map)
+            , m_it(other.m_it)
+            , m_node(other.m_node)
+        {
+        }
+
+        reference operator*() const
+        {
+            return m_map->m_flat ? m_map->m_nodes[m_node].value() : *m_it;
+        }
+
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        Iterator &operator++()
+        {
+            if (m_map->m_flat)
+                m_node = m_map->m_nodes[m_node].next;
+            else
+                ++m_it;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Iterator &operator--()
+        {
+            if (m_map->m_flat)
+                m_node = (m_node == npos) ? m_map->m_tail : m_map->m_nodes[m_node].prev;
+            else
+                --m_it;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return m_map->m_flat ? m_node == other.m_node : m_it == other.m_it;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class SyncMap;
+        friend class Iterator<!Const>;
+
+        typedef typename std::conditional<Const, const SyncMap *, SyncMap *>::type map_pointer;
+        typedef typename std::conditional<Const, ordered_map::const_iterator, ordered_map::iterator>::type base_iterator;
+
+        Iterator(map_pointer map, base_iterator it) : m_map(map), m_it(it) { }
+        Iterator(map_pointer map, size_t node) : m_map(map), m_node(node) { }
+
+        map_pointer m_map = nullptr;
+        base_iterator m_it;
+        size_t m_node = npos;
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    SyncMap() = default;
+    ~SyncMap() { clearFlat(); }
+
+    SyncMap(const SyncMap&) = delete;
+    SyncMap& operator=(const SyncMap&) = delete;
+
+    bool isFlat() const { return m_flat; }
+
+    /* Switch the backing store, pending tasks are kept */
+    void setFlat(bool flat)
+    {
+        if (flat == m_flat)
+            return;
+
+        if (flat)
+        {
+            m_flat = true;
+            for (auto &entry : m_ordered)
+            {
+                emplace(entry.first, std::move(entry.second));
+            }
+            m_ordered.clear();
+        }
+        else
+        {
+            for (size_t n = m_head; n != npos; n = m_nodes[n].next)
+            {
+                m_ordered.emplace(m_nodes[n].value().first, std::move(m_nodes[n].value().second));
+            }
+            clearFlat();
+            m_flat = false;
+        }
+    }
+
+    iterator begin() { return m_flat ? iterator(this, m_head) : iterator(this, m_ordered.begin()); }
+    iterator end() { return m_flat ? iterator(this, npos) : iterator(this, m_ordered.end()); }
+    const_iterator begin() const { return m_flat ? const_iterator(this, m_head) : const_iterator(this, m_ordered.begin()); }
+    const_iterator end() const { return m_flat ? const_iterator(this, npos) : const_iterator(this, m_ordered.end()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    bool empty() const { return size() == 0; }
+    size_type size() const { return m_flat ? m_size : m_ordered.size(); }
+
+    void clear()
+    {
+        m_ordered.clear();
+        clearFlat();
+    }
+
+    template <typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        if (!m_flat)
+        {
+            return iterator(this, m_ordered.emplace(std::forward<Args>(args)...));
+        }
+
+        size_t n = allocNode(std::forward<Args>(args)...);
+        const std::string &key = m_nodes[n].value().first;
+        size_t hash = std::hash<std::string>()(key);
+
+        size_t slot = findSlot(key, hash);
+        if (slot == npos)
+        {
+            /* New key, append at the end of the list */
+            linkAfter(n, m_tail);
+            insertSlot(hash, n);
+        }
+        else
+        {
+            /* Keep the tasks of one key adjacent, after the last one */
+            linkAfter(n, m_slots[slot].tail);
+            m_slots[slot].tail = n;
+        }
+
+        return iterator(this, n);
+    }
+
+    iterator find(const key_type &key)
+    {
+        if (!m_flat)
+            return iterator(this, m_ordered.find(key));
+
+        size_t slot = findSlot(key, std::hash<std::string>()(key));
+        return iterator(this, slot == npos ? npos : m_slots[slot].head);
+    }
+
+    const_iterator find(const key_type &key) const
+    {
+        if (!m_flat)
+            return const_iterator(this, m_ordered.find(key));
+
+        size_t slot = findSlot(key, std::hash<std::string>()(key));
+        return const_iterator(this, slot == npos ? npos : m_slots[slot].head);
+    }
+
+    size_type count(const key_type &key) const
+    {
+        if (!m_flat)
+            return m_ordered.count(key);
+
+        size_t slot = findSlot(key, std::hash<std::string>()(key));
+        if (slot == npos)
+            return 0;
+
+        size_type cnt = 1;
+        for (size_t n = m_slots[slot].head; n != m_slots[slot].tail; n = m_nodes[n].next)
+        {
+            cnt++;
+        }
+        return cnt;
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type &key)
+    {
+        if (!m_flat)
+        {
+            auto range = m_ordered.equal_range(key);
+            return std::make_pair(iterator(this, range.first), iterator(this, range.second));
+        }
+
+        size_t slot = findSlot(key, std::hash<std::string>()(key));
+        if (slot == npos)
+            return std::make_pair(end(), end());
+
+        return std::make_pair(iterator(this, m_slots[slot].head),
+                              iterator(this, m_nodes[m_slots[slot].tail].next));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        if (!m_flat)
+            return iterator(this, m_ordered.erase(pos.m_it));
+
+        size_t n = pos.m_node;
+        size_t next = m_nodes[n].next;
+        const std::string &key = m_nodes[n].value().first;
+        size_t slot = findSlot(key, std::hash<std::string>()(key));
+
+        if (m_slots[slot].head == n && m_slots[slot].tail == n)
+        {
+            eraseSlot(slot);
+        }
+        else if (m_slots[slot].head == n)
+        {
+            m_slots[slot].head = next;
+        }
+        else if (m_slots[slot].tail == n)
+        {
+            m_slots[slot].tail = m_nodes[n].prev;
+        }
+
+        unlink(n);
+        freeNode(n);
+
+        return iterator(this, next);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        while (first != last)
+        {
+            first = erase(first);
+        }
+        return toIterator(last);
+    }
+
+    size_type erase(const key_type &key)
+    {
+        if (!m_flat)
+            return m_ordered.erase(key);
+
+        size_type cnt = 0;
+        auto range = equal_range(key);
+        for (auto it = range.first; it != range.second; cnt++)
+        {
+            it = erase(it);
+        }
+        return cnt;
+    }
+
+private:
+    iterator toIterator(const_iterator pos)
+    {
+        if (!m_flat)
+            return iterator(this, m_ordered.erase(pos.m_it, pos.m_it));
+
+        return iterator(this, pos.m_node);
+    }
+
+    size_t takeNode()
+    {
+        size_t n;
+        if (m_free != npos)
+        {
+            n = m_free;
+            m_free = m_nodes[n].next;
+        }
+        else
+        {
+            n = m_nodes.size();
+            m_nodes.emplace_back();
+        }
+        m_nodes[n].prev = npos;
+        m_nodes[n].next = npos;
+        return n;
+    }
+
+    template <typename... Args>
+    size_t allocNode(Args&&... args)
+    {
+        size_t n = takeNode();
+        try
+        {
+            new (&m_nodes[n].storage) value_type(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_nodes[n].next = m_free;
+            m_free = n;
+            throw;
+        }
+        m_size++;
+        return n;
+    }
+
+    void freeNode(size_t n)
+    {
+        m_nodes[n].value().~value_type();
+        m_nodes[n].prev = npos;
+        m_nodes[n].next = m_free;
+        m_free = n;
+        m_size--;
+    }
+
+    void linkAfter(size_t n, size_t prev)
+    {
+        size_t next = (prev == npos) ? m_head : m_nodes[prev].next;
+
+        m_nodes[n].prev = prev;
+        m_nodes[n].next = next;
+
+        if (prev == npos)
+            m_head = n;
+        else
+            m_nodes[prev].next = n;
+
+        if (next == npos)
+            m_tail = n;
+        else
+            m_nodes[next].prev = n;
+    }
+
+    void unlink(size_t n)
+    {
+        size_t prev = m_nodes[n].prev;
+        size_t next = m_nodes[n].next;
+
+        if (prev == npos)
+            m_head = next;
+        else
+            m_nodes[prev].next = next;
+
+        if (next == npos)
+            m_tail = prev;
+        else
+            m_nodes[next].prev = prev;
+    }
+
+    size_t findSlot(const key_type &key, size_t hash) const
+    {
+        if (m_slots.empty())
+            return npos;
+
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = hash & mask; m_slots[i].head != npos; i = (i + 1) & mask)
+        {
+            if (m_slots[i].hash == hash && m_nodes[m_slots[i].head].value().first == key)
+                return i;
+        }
+        return npos;
+    }
+
+    void insertSlot(size_t hash, size_t n)
+    {
+        /* Keep the load factor at or below 1/2 */
+        if ((m_keys + 1) * 2 > m_slots.size())
+        {
+            rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+        }
+
+        size_t mask = m_slots.size() - 1;
+        size_t i = hash & mask;
+        while (m_slots[i].head != npos)
+        {
+            i = (i + 1) & mask;
+        }
+
+        m_slots[i].hash = hash;
+        m_slots[i].head = n;
+        m_slots[i].tail = n;
+        m_keys++;
+    }
+
+    /* Linear probing removal with backward shift, no tombstones are left behind */
+    void eraseSlot(size_t i)
+    {
+        size_t mask = m_slots.size() - 1;
+        size_t j = i;
+
+        while (true)
+        {
+            j = (j + 1) & mask;
+            if (m_slots[j].head == npos)
+                break;
+
+            size_t home = m_slots[j].hash & mask;
+            /* Move slot j back to i unless its home lies cyclically in (i, j] */
+            bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!stays)
+            {
+                m_slots[i] = m_slots[j];
+                i = j;
+            }
+        }
+
+        m_slots[i] = Slot();
+        m_keys--;
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old;
+        old.swap(m_slots);
+        m_slots.resize(capacity);
+
+        size_t mask = capacity - 1;
+        for (const auto &slot : old)
+        {
+            if (slot.head == npos)
+                continue;
+
+            size_t i = slot.hash & mask;
+            while (m_slots[i].head != npos)
+            {
+                i = (i + 1) & mask;
+            }
+            m_slots[i] = slot;
+        }
+    }
+
+    void clearFlat()
+    {
+        for (size_t n = m_head; n != npos; n = m_nodes[n].next)
+        {
+            m_nodes[n].value().~value_type();
+        }
+        m_nodes.clear();
+        m_slots.clear();
+        m_head = m_tail = m_free = npos;
+        m_size = m_keys = 0;
+    }
+
+    bool m_flat = false;
+    ordered_map m_ordered;
+
+    std::deque<Node> m_nodes;
+    std::vector<Slot> m_slots;
+    size_t m_head = npos;
+    size_t m_tail = npos;
+    size_t m_free = npos;
+    size_t m_size = 0;
+    size_t m_keys = 0;
+};
+
+#endif /* SWSS_SYNCMAP_H */
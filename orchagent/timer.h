@@ -20,7 +20,9 @@ public:
 
     void execute()
     {
-        m_orch->doTask(*getSelectableTimer());
+        processLaneTask([this]() {
+            m_orch->doTask(*getSelectableTimer());
+        });
     }
 };
 
@@ -987,7 +987,8 @@ NextHopGroupKey VNetRouteOrch::getActiveNHSet(const string& vnet,
     // to identify the ones which are active based on their monitor session state.
     // These next hops are collected into another next hop group key called nhg_custom and returned.
     NextHopGroupKey nhg_custom("", true);
-    set<NextHopKey> next_hop_set = nexthops.getNextHops();
+    set<NextHopKey> active_nhs;
+    const set<NextHopKey> &next_hop_set = nexthops.getNextHops();
     for (auto it : next_hop_set)
     {
         if(monitor_info_.find(vnet) != monitor_info_.end() &&
@@ -1000,7 +1001,7 @@ NextHopGroupKey VNetRouteOrch::getActiveNHSet(const string& vnet,
                     if (monitor.second.state == MONITOR_SESSION_STATE_UP)
                     {
                         // monitor session exists and is up
-                        nhg_custom.add(it);
+                        active_nhs.insert(it);
 
                     }
                     continue;
@@ -1008,6 +1009,7 @@ NextHopGroupKey VNetRouteOrch::getActiveNHSet(const string& vnet,
             }
         }
     }
+    nhg_custom.add(active_nhs);
     return nhg_custom;
 }
 
@@ -1536,6 +1538,13 @@ bool VNetRouteOrch::setAndDeleteRoutesWithRouteOrch(const sai_object_id_t vr_id,
 {
     auto& bulkNhgReducedRefCnt = gRouteOrch->getBulkNhgReducedRefCnt();
 
+    // Route orch only holds subnet prefixes
+    if (!(ipPrefix.getSubnet() == ipPrefix))
+    {
+        SWSS_LOG_ERROR("Route %s has host bits set", ipPrefix.to_string().c_str());
+        return false;
+    }
+
     // Get vnet name from vrf id
     std::string vnet_name;
     if (!vnet_orch_->getVnetNameByVrfId(vr_id, vnet_name))
@@ -2989,6 +2998,7 @@ bool VNetRouteOrch::handleTunnel(const Request& request)
         nhg_secondary = NextHopGroupKey("", true);
     }
     NextHopGroupKey nhg("", true);
+    set<NextHopKey> nhs, primary_nhs, secondary_nhs;
     map<NextHopKey, IpAddress> monitors;
     for (size_t idx_ip = 0; idx_ip < ip_list.size(); idx_ip++)
     {
@@ -3028,15 +3038,19 @@ bool VNetRouteOrch::handleTunnel(const Request& request)
             if (std::find(primary_list.begin(), primary_list.end(), ip) != primary_list.end())
             {
                 // only add the primary endpoint ips.
-                nhg_primary.add(nh);
+                primary_nhs.insert(nh);
             }
             else
             {
-                nhg_secondary.add(nh);
+                secondary_nhs.insert(nh);
             }
         }
-        nhg.add(nh);
+        nhs.insert(nh);
     }
+    // intern each next hop set once rather than once per endpoint
+    nhg_primary.add(primary_nhs);
+    nhg_secondary.add(secondary_nhs);
+    nhg.add(nhs);
     if (!has_adv_pfx)
     {
         adv_prefix = ip_pfx;
@@ -19,6 +19,7 @@ extern "C" {
 #include "tokenize.h"
 #include "sai_serialize.h"
 #include "flex_counter_manager.h"
+#include "counterratesorch.h"
 #include "converter.h"
 
 /* Global variables */
@@ -31,6 +32,7 @@ extern PortsOrch*       gPortsOrch;
 extern sai_object_id_t  gUnderlayIfId;
 extern FlexManagerDirectory g_FlexManagerDirectory;
 extern bool gTraditionalFlexCounter;
+extern bool gNativeCounterRates;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -1205,8 +1207,17 @@ VxlanTunnelOrch::VxlanTunnelOrch(DBConnector *statedb, DBConnector *db, const st
     m_asic_db = shared_ptr<DBConnector>(new DBConnector("ASIC_DB", 0));
     try
     {
-        string tunnel_rate_script = swss::loadLuaScript(tunnel_rate_plugin);
-        string tunnel_rate_sha = swss::loadRedisScript(m_counter_db.get(), tunnel_rate_script);
+        string tunnel_rate_sha;
+        /* Tunnel rates are computed by CounterRatesOrch then, once told the counters are polled */
+        if (gNativeCounterRates)
+        {
+            tunnel_rate_sha = CounterRatesOrch::loadPollPlugin(m_counter_db.get(), "TUNNEL");
+        }
+        else
+        {
+            string tunnel_rate_script = swss::loadLuaScript(tunnel_rate_plugin);
+            tunnel_rate_sha = swss::loadRedisScript(m_counter_db.get(), tunnel_rate_script);
+        }
         fv = FieldValueTuple(TUNNEL_PLUGIN_FIELD, tunnel_rate_sha);
     }
     catch (const runtime_error &e)
@@ -1,7 +1,10 @@
 #include <dirent.h>
+#include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <set>
@@ -9,10 +12,9 @@
 
 #include "logger.h"
 #include "dbconnector.h"
-#include "producerstatetable.h"
 #include "zmqclient.h"
-#include "zmqproducerstatetable.h"
 #include "orch_zmq_config.h"
+#include "tablewriter.h"
 #include <nlohmann/json.hpp>
 
 using namespace std;
@@ -25,10 +27,17 @@ const int el_count = 2;
 
 const string SWSS_CONFIG_DIR    = "/etc/swss/config.d/";
 
+/* Entries parsed between two checks of the progress report timer */
+#define PROGRESS_CHECK_INTERVAL 1000
+
 void usage()
 {
-    cout << "Usage: swssconfig [FILE...]" << endl;
+    cout << "Usage: swssconfig [-j WRITERS] [-p] [FILE...]" << endl;
     cout << "       (default config folder is /etc/swss/config.d/)" << endl;
+    cout << "  -j WRITERS  Write the tables through WRITERS connections in parallel," << endl;
+    cout << "              entries of different tables may then be written out of order" << endl;
+    cout << "              (default: 1, entries are written in file order)" << endl;
+    cout << "  -p          Report progress on stderr" << endl;
 }
 
 void dump_db_item(KeyOpFieldsValuesTuple &db_item)
@@ -43,130 +52,158 @@ void dump_db_item(KeyOpFieldsValuesTuple &db_item)
     SWSS_LOG_DEBUG("]");
 }
 
-shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<ProducerStateTable>> &table_map, RedisPipeline &pipeline, string table_name, set<string> &zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+/* Convert one element of the root array, {"<table>:<key>": {fields}, "OP": op} */
+bool parse_db_item(const json &arr_item, string &table_name, KeyOpFieldsValuesTuple &db_item)
 {
-    shared_ptr<ProducerStateTable> p_table= nullptr;
-    auto findResult = table_map.find(table_name);
-    if (findResult == table_map.end())
+    if (!arr_item.is_object())
     {
-        if ((zmq_tables.find(table_name) != zmq_tables.end()) && (zmq_client != nullptr)) {
-            p_table = make_shared<ZmqProducerStateTable>(&pipeline, table_name, *zmq_client, true);
-        }
-        else {
-            p_table = make_shared<ProducerStateTable>(&pipeline, table_name, true);
-        }
-
-        table_map.emplace(table_name, p_table);
+        SWSS_LOG_ERROR("Child elements must be objects. element:%s", arr_item.dump().c_str());
+        return false;
     }
-    else
+
+    if (el_count != arr_item.size())
     {
-        p_table = findResult->second;
+        SWSS_LOG_ERROR("Child elements must have both key and op entry. %s",
+                       arr_item.dump().c_str());
+        return false;
     }
 
-    return p_table;
-}
-
-bool write_db_data(vector<KeyOpFieldsValuesTuple> &db_items, set<string>  &zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
-{
-    DBConnector db("APPL_DB", 0, false);
-    RedisPipeline pipeline(&db); // dtor of RedisPipeline will automatically flush data
-    unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
-
-    for (auto &db_item : db_items)
+    string key;
+    for (auto child_it = arr_item.begin(); child_it != arr_item.end(); child_it++)
     {
-        dump_db_item(db_item);
+        auto &cur_obj = child_it.value();
 
-        string key = kfvKey(db_item);
-        size_t pos = key.find(name_delimiter);
-        if ((string::npos == pos) || ((key.size() - 1) == pos))
+        if (cur_obj.is_object())
         {
-            SWSS_LOG_ERROR("Invalid formatted hash:%s\n", key.c_str());
-            return false;
+            key = child_it.key();
+            for (auto cur_obj_it = cur_obj.begin(); cur_obj_it != cur_obj.end(); cur_obj_it++)
+            {
+                string value_str;
+                if ((*cur_obj_it).is_number())
+                    value_str = to_string((*cur_obj_it).get<int>());
+                else if ((*cur_obj_it).is_string())
+                    value_str = (*cur_obj_it).get<string>();
+                kfvFieldsValues(db_item).push_back(FieldValueTuple(cur_obj_it.key(), value_str));
+            }
         }
-        string table_name = key.substr(0, pos);
-        string key_name = key.substr(pos + 1);
-
-        auto p_table= get_table(table_map, pipeline, table_name, zmq_tables, zmq_client);
-
-        if (kfvOp(db_item) == SET_COMMAND)
-            p_table->set(key_name, kfvFieldsValues(db_item), SET_COMMAND);
-        else if (kfvOp(db_item) == DEL_COMMAND)
-            p_table->del(key_name, DEL_COMMAND);
         else
         {
-            SWSS_LOG_ERROR("Invalid operation: %s\n", kfvOp(db_item).c_str());
-            return false;
+            if (op_name != child_it.key())
+            {
+                SWSS_LOG_ERROR("Invalid entry. %s", arr_item.dump().c_str());
+                return false;
+            }
+            kfvOp(db_item) = cur_obj.get<string>();
         }
     }
 
-    return true;
-}
-
-bool load_json_db_data(ifstream &fs, vector<KeyOpFieldsValuesTuple> &db_items)
-{
-    json json_array;
-    fs >> json_array;
+    size_t pos = key.find(name_delimiter);
+    if ((string::npos == pos) || ((key.size() - 1) == pos))
+    {
+        SWSS_LOG_ERROR("Invalid formatted hash:%s\n", key.c_str());
+        return false;
+    }
+    table_name = key.substr(0, pos);
+    kfvKey(db_item) = key.substr(pos + 1);
 
-    if (!json_array.is_array())
+    if (kfvOp(db_item) != SET_COMMAND && kfvOp(db_item) != DEL_COMMAND)
     {
-        SWSS_LOG_ERROR("Root element must be an array.");
+        SWSS_LOG_ERROR("Invalid operation: %s\n", kfvOp(db_item).c_str());
         return false;
     }
 
-    for (size_t i = 0; i < json_array.size(); i++)
+    return true;
+}
+
+/*
+ * Parse the JSON array and hand every element to the writer as soon as it
+ * is parsed, so the whole file is never held in memory. Without a writer
+ * the file is only validated.
+ */
+bool load_json_db_data(istream &fs, TableWriter *writer, bool progress)
+{
+    bool valid = true;
+    uint64_t parsed = 0;
+    auto last_report = chrono::steady_clock::now();
+
+    json::parser_callback_t cb = [&](int depth, json::parse_event_t event, json &parsed_item)
     {
-        auto &arr_item = json_array[i];
+        if (!valid)
+        {
+            return false;
+        }
 
-        if (arr_item.is_object())
+        if (depth == 0)
         {
-            if (el_count != arr_item.size())
+            if (event == json::parse_event_t::object_start)
             {
-                SWSS_LOG_ERROR("Child elements must have both key and op entry. %s",
-                               arr_item.dump().c_str());
-                return false;
+                SWSS_LOG_ERROR("Root element must be an array.");
+                valid = false;
             }
+            return valid;
+        }
 
-            db_items.push_back(KeyOpFieldsValuesTuple());
-            auto &cur_db_item = db_items[db_items.size() - 1];
-
-            for (json::iterator child_it = arr_item.begin(); child_it != arr_item.end(); child_it++) {
-                auto cur_obj_key = child_it.key();
-                auto &cur_obj = child_it.value();
+        if (depth != 1)
+        {
+            return true;
+        }
 
-                string field_str;
-                string value_str;
+        switch (event)
+        {
+            case json::parse_event_t::object_end:
+            {
+                string table_name;
+                KeyOpFieldsValuesTuple db_item;
+                if (!parse_db_item(parsed_item, table_name, db_item))
+                {
+                    valid = false;
+                    return false;
+                }
 
-                if (cur_obj.is_object()) {
-                    kfvKey(cur_db_item) = cur_obj_key;
-                    for (json::iterator cur_obj_it = cur_obj.begin(); cur_obj_it != cur_obj.end(); cur_obj_it++)
-                    {
-                        string field_str = cur_obj_it.key();
-                        string value_str;
-                        if ((*cur_obj_it).is_number())
-                            value_str = to_string((*cur_obj_it).get<int>());
-                        else if ((*cur_obj_it).is_string())
-                            value_str = (*cur_obj_it).get<string>();
-                        kfvFieldsValues(cur_db_item).push_back(FieldValueTuple(field_str, value_str));
-                    }
+                if (writer == nullptr)
+                {
+                    return false;
                 }
-                else
+
+                dump_db_item(db_item);
+                writer->write(table_name, move(db_item));
+                parsed++;
+
+                if (progress && parsed % PROGRESS_CHECK_INTERVAL == 0)
                 {
-                    if (op_name != child_it.key())
+                    auto now = chrono::steady_clock::now();
+                    if (now - last_report >= chrono::seconds(1))
                     {
-                        SWSS_LOG_ERROR("Invalid entry. %s", arr_item.dump().c_str());
-                        return false;
+                        last_report = now;
+                        cerr << "Parsed " << parsed << " entries, written " << writer->getWritten() << endl;
                     }
-                    kfvOp(cur_db_item) = cur_obj.get<string>();
-                 }
+                }
+
+                /* Drop the element from the root array */
+                return false;
             }
+            case json::parse_event_t::array_end:
+            case json::parse_event_t::value:
+                SWSS_LOG_ERROR("Child elements must be objects. element:%s", parsed_item.dump().c_str());
+                valid = false;
+                return false;
+            default:
+                return true;
         }
-        else
-        {
-            SWSS_LOG_ERROR("Child elements must be objects. element:%s", arr_item.dump().c_str());
-            return false;
-        }
+    };
+
+    auto root = json::parse(fs, cb);
+    if (valid && !root.is_array())
+    {
+        SWSS_LOG_ERROR("Root element must be an array.");
+        valid = false;
     }
-    return true;
+
+    if (writer != nullptr)
+    {
+        writer->flush();
+    }
+    return valid;
 }
 
 vector<string> read_directory(const string &path)
@@ -192,19 +229,42 @@ vector<string> read_directory(const string &path)
 
 int main(int argc, char **argv)
 {
-    vector<string> files;
-    if (argc == 1)
+    size_t writers = 1;
+    bool progress = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "j:ph")) != -1)
     {
-        files = read_directory(SWSS_CONFIG_DIR);
+        switch (opt)
+        {
+            case 'j':
+                writers = strtoul(optarg, nullptr, 10);
+                if (writers == 0)
+                {
+                    usage();
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'p':
+                progress = true;
+                break;
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
     }
-    if (argc == 2 && !strcmp(argv[1], "-h"))
+
+    vector<string> files;
+    if (optind == argc)
     {
-        usage();
-        exit(EXIT_SUCCESS);
+        files = read_directory(SWSS_CONFIG_DIR);
     }
     else
     {
-        for (auto i = 1; i < argc; i++)
+        for (auto i = optind; i < argc; i++)
         {
             files.push_back(string(argv[i]));
         }
@@ -221,7 +281,6 @@ int main(int argc, char **argv)
     {
         SWSS_LOG_NOTICE("Loading config from JSON file:%s...", i.c_str());
 
-        vector<KeyOpFieldsValuesTuple> db_items;
         try
         {
             ifstream fs(i);
@@ -232,17 +291,36 @@ int main(int argc, char **argv)
                 return EXIT_FAILURE;
             }
 
-            if (!load_json_db_data(fs, db_items))
+            /* Nothing of a file is written unless all of it is valid */
+            if (!load_json_db_data(fs, nullptr, false))
             {
                 SWSS_LOG_ERROR("Failed loading data from JSON file %s", i.c_str());
                 return EXIT_FAILURE;
             }
 
-            if (!write_db_data(db_items, zmq_tables, zmq_client))
+            fs.clear();
+            if (!fs.seekg(0))
+            {
+                SWSS_LOG_ERROR("Failed to rewind file %s", i.c_str());
+                cerr << "Failed to rewind file " << i.c_str() << endl;
+                return EXIT_FAILURE;
+            }
+
+            /* Files are applied one after the other */
+            TableWriter writer(writers, zmq_tables, zmq_client);
+            auto start = chrono::steady_clock::now();
+
+            if (!load_json_db_data(fs, &writer, progress))
             {
-                SWSS_LOG_ERROR("Failed applying data from JSON file %s", i.c_str());
+                SWSS_LOG_ERROR("Failed loading data from JSON file %s", i.c_str());
                 return EXIT_FAILURE;
             }
+
+            if (progress)
+            {
+                auto ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+                cerr << "Wrote " << writer.getWritten() << " entries from " << i << " in " << ms << " ms" << endl;
+            }
         }
         catch(const exception &e)
         {
@@ -1,8 +1,14 @@
+#include <getopt.h>
+#include <time.h>
+
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
+#include <redisreply.h>
 #include "zmqclient.h"
 #include "zmqproducerstatetable.h"
 #include "orch_zmq_config.h"
@@ -12,13 +18,46 @@
 using namespace std;
 using namespace swss;
 
+typedef chrono::steady_clock Clock;
+
+/* Entries written between two pipeline flushes by default */
+#define DEFAULT_BATCH_SIZE 128
+/* How often and how long to wait for orchagent to drain the tables */
+#define DRAIN_POLL_INTERVAL_MS 10
+#define DEFAULT_DRAIN_TIMEOUT_S 600
+
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
+static RedisPipeline pipeline(&db);
+
+struct ReplayOptions
+{
+	/* Reproduce the recorded timing, divided by speed */
+	bool timed = false;
+	double speed = 1.0;
+	/* Entries written between two pipeline flushes */
+	size_t batch = DEFAULT_BATCH_SIZE;
+	/* Wait for orchagent to consume the tables, 0 to not wait */
+	int drainTimeout = 0;
+};
+
+struct ReplayStats
+{
+	uint64_t ops = 0;
+	uint64_t skipped = 0;
+	/* Longest delay behind the recorded timing */
+	Clock::duration maxLag = Clock::duration::zero();
+};
 
 void usage()
 {
-	cout << "Usage: swssplayer <file>" << endl;
-	/* TODO: Add sample input file */
+	cout << "Usage: swssplayer [-t] [-s SPEED] [-b BATCH] [-w[SECONDS]] <file>" << endl;
+	cout << "  -t          Reproduce the recorded timing between the entries" << endl;
+	cout << "  -s SPEED    With -t, replay SPEED times faster than recorded" << endl;
+	cout << "  -b BATCH    Entries written between two flushes (default " << DEFAULT_BATCH_SIZE << ")" << endl;
+	cout << "  -w[SECONDS] Wait for orchagent to consume the replayed tables" << endl;
+	cout << "              and report the drain time (default " << DEFAULT_DRAIN_TIMEOUT_S << " seconds)" << endl;
+	cout << "Without -t the file is replayed as fast as possible." << endl;
 }
 
 vector<FieldValueTuple> processFieldsValuesTuple(string s)
@@ -37,6 +76,35 @@ vector<FieldValueTuple> processFieldsValuesTuple(string s)
 	return result;
 }
 
+/* Parse a recorder timestamp, 2024-01-01.12:00:00.123456 in local time */
+bool parseTimestamp(const string &ts, chrono::microseconds &time)
+{
+	struct tm tm = {};
+	const char *end = strptime(ts.c_str(), "%Y-%m-%d.%H:%M:%S", &tm);
+	if (end == nullptr || *end != '.')
+	{
+		return false;
+	}
+
+	char *usec_end = nullptr;
+	long usec = strtol(end + 1, &usec_end, 10);
+	if (usec_end == end + 1)
+	{
+		return false;
+	}
+
+	/* The recorder stamps are in local time, let mktime work out DST */
+	tm.tm_isdst = -1;
+	time_t sec = mktime(&tm);
+	if (sec == -1)
+	{
+		return false;
+	}
+
+	time = chrono::seconds(sec) + chrono::microseconds(usec);
+	return true;
+}
+
 shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, string table_name, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
 {
     shared_ptr<ProducerStateTable> p_table= nullptr;
@@ -44,10 +112,10 @@ shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<Produc
     if (findResult == table_map.end())
     {
         if ((zmq_tables.find(table_name) != zmq_tables.end()) && (zmq_client != nullptr)) {
-            p_table = make_shared<ZmqProducerStateTable>(&db, table_name, *zmq_client, true);
+            p_table = make_shared<ZmqProducerStateTable>(&pipeline, table_name, *zmq_client, true);
         }
         else {
-            p_table = make_shared<ProducerStateTable>(&db, table_name);
+            p_table = make_shared<ProducerStateTable>(&pipeline, table_name, true);
         }
 
         table_map.emplace(table_name, p_table);
@@ -60,54 +128,236 @@ shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<Produc
     return p_table;
 }
 
-void processTokens(vector<string> tokens, unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+bool processTokens(vector<string> tokens, unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
 {
+	/* Skip the recording started lines */
+	if (tokens.size() < 3)
+	{
+		return false;
+	}
+
 	auto key = tokens[1];
 
 	/* Process the key */
 	auto v_key = tokenize(key, ':', 1);
+	if (v_key.size() != 2)
+	{
+		return false;
+	}
 	auto table_name = v_key[0];
 	auto key_name = v_key[1];
 
-	auto p_producer= get_table(table_map, table_name, zmq_tables, zmq_client);
-
 	/* Process the operation */
 	auto op = tokens[2];
 	if (op == SET_COMMAND)
 	{
-		auto tuples = processFieldsValuesTuple(tokens[3]);
+		auto p_producer= get_table(table_map, table_name, zmq_tables, zmq_client);
+		auto tuples = tokens.size() > 3 ? processFieldsValuesTuple(tokens[3]) : vector<FieldValueTuple>();
 		p_producer->set(key_name, tuples, SET_COMMAND);
 	}
 	else if (op == DEL_COMMAND)
 	{
+		auto p_producer= get_table(table_map, table_name, zmq_tables, zmq_client);
 		p_producer->del(key_name, DEL_COMMAND);
 	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+ReplayStats replay(ifstream &file, const ReplayOptions &options,
+                   unordered_map<string, shared_ptr<ProducerStateTable>>& table_map,
+                   set<string> zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+{
+	ReplayStats stats;
+	string line;
+	size_t pending = 0;
+
+	bool started = false;
+	chrono::microseconds first_ts(0);
+	Clock::time_point start;
+
+	while (getline(file, line))
+	{
+		line_index++;
+
+		auto tokens = tokenize(line, '|', 3);
+
+		if (options.timed)
+		{
+			chrono::microseconds ts;
+			if (!tokens.empty() && parseTimestamp(tokens[0], ts))
+			{
+				if (!started)
+				{
+					started = true;
+					first_ts = ts;
+					start = Clock::now();
+				}
+
+				auto offset = chrono::duration_cast<Clock::duration>((ts - first_ts) / options.speed);
+				auto target = start + max(offset, Clock::duration::zero());
+				auto now = Clock::now();
+				if (target > now)
+				{
+					/* Write what is due before going to sleep */
+					pipeline.flush();
+					pending = 0;
+					this_thread::sleep_until(target);
+				}
+				else
+				{
+					stats.maxLag = max(stats.maxLag, now - target);
+				}
+			}
+		}
+
+		if (!processTokens(tokens, table_map, zmq_tables, zmq_client))
+		{
+			stats.skipped++;
+			continue;
+		}
+
+		stats.ops++;
+		if (++pending >= options.batch)
+		{
+			pipeline.flush();
+			pending = 0;
+		}
+	}
+
+	pipeline.flush();
+	return stats;
+}
+
+/* Wait until orchagent popped every key set the replay wrote to */
+bool waitForDrain(unordered_map<string, shared_ptr<ProducerStateTable>>& table_map,
+                  set<string> zmq_tables, int timeout)
+{
+	auto deadline = Clock::now() + chrono::seconds(timeout);
+
+	for (auto &table : table_map)
+	{
+		/* ZMQ tables are not consumed through the key sets */
+		if (zmq_tables.find(table.first) != zmq_tables.end())
+		{
+			continue;
+		}
+
+		while (true)
+		{
+			RedisCommand scard;
+			scard.format("SCARD %s", table.second->getKeySetName().c_str());
+			RedisReply r(&db, scard, REDIS_REPLY_INTEGER);
+			if (r.getContext()->integer == 0)
+			{
+				break;
+			}
+
+			if (Clock::now() >= deadline)
+			{
+				return false;
+			}
+			this_thread::sleep_for(chrono::milliseconds(DRAIN_POLL_INTERVAL_MS));
+		}
+	}
+
+	return true;
 }
 
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	ReplayOptions options;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "ts:b:w::h")) != -1)
+	{
+		switch (opt)
+		{
+			case 't':
+				options.timed = true;
+				break;
+			case 's':
+				options.speed = strtod(optarg, nullptr);
+				if (options.speed <= 0)
+				{
+					usage();
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'b':
+				options.batch = strtoul(optarg, nullptr, 10);
+				if (options.batch == 0)
+				{
+					usage();
+					exit(EXIT_FAILURE);
+				}
+				break;
+			case 'w':
+				options.drainTimeout = optarg ? atoi(optarg) : DEFAULT_DRAIN_TIMEOUT_S;
+				break;
+			case 'h':
+				usage();
+				exit(EXIT_SUCCESS);
+			default:
+				usage();
+				exit(EXIT_FAILURE);
+		}
+	}
+
+	if (optind != argc - 1)
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
-	string line;
+	ifstream file(argv[optind]);
+	if (!file)
+	{
+		cerr << "Failed to open file " << argv[optind] << endl;
+		exit(EXIT_FAILURE);
+	}
 
-    auto zmq_tables = load_zmq_tables();
-    std::shared_ptr<ZmqClient> zmq_client = nullptr;
-    if (zmq_tables.size() > 0)
-    {
-        zmq_client = create_zmq_client(ZMQ_LOCAL_ADDRESS);
-    }
+	auto zmq_tables = load_zmq_tables();
+	std::shared_ptr<ZmqClient> zmq_client = nullptr;
+	if (zmq_tables.size() > 0)
+	{
+		zmq_client = create_zmq_client(ZMQ_LOCAL_ADDRESS);
+	}
 
-    unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
-	while (getline(file, line))
+	unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
+
+	auto start = Clock::now();
+	auto stats = replay(file, options, table_map, zmq_tables, zmq_client);
+	auto replayed = Clock::now();
+
+	auto replay_ms = chrono::duration_cast<chrono::milliseconds>(replayed - start).count();
+	double ops_per_sec = replay_ms > 0 ? static_cast<double>(stats.ops) * 1000 / static_cast<double>(replay_ms) : 0;
+	cout << "Replayed " << stats.ops << " entries (" << stats.skipped << " lines skipped) in "
+	     << replay_ms << " ms, " << static_cast<uint64_t>(ops_per_sec) << " ops/sec" << endl;
+	if (options.timed)
 	{
-		auto tokens = tokenize(line, '|', 3);
-		processTokens(tokens, table_map, zmq_tables, zmq_client);
+		cout << "Max lag behind the recorded timing: "
+		     << chrono::duration_cast<chrono::milliseconds>(stats.maxLag).count() << " ms" << endl;
+	}
 
-		line_index++;
+	if (options.drainTimeout > 0)
+	{
+		if (!waitForDrain(table_map, zmq_tables, options.drainTimeout))
+		{
+			cerr << "Tables not drained after " << options.drainTimeout << " seconds" << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		auto drain_ms = chrono::duration_cast<chrono::milliseconds>(Clock::now() - replayed).count();
+		auto total_ms = chrono::duration_cast<chrono::milliseconds>(Clock::now() - start).count();
+		cout << "Drained in " << drain_ms << " ms after the replay, "
+		     << (total_ms > 0 ? stats.ops * 1000 / static_cast<uint64_t>(total_ms) : 0)
+		     << " ops/sec end to end" << endl;
 	}
+
+	return EXIT_SUCCESS;
 }
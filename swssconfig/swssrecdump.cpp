@@ -0,0 +1,64 @@
+#include <string.h>
+
+#include <fstream>
+#include <iostream>
+
+#include "recorder.h"
+
+using namespace std;
+using namespace swss;
+
+void usage()
+{
+    cout << "Usage: swssrecdump <file.bin>..." << endl;
+    cout << "       Print binary swss.rec/responsepublisher.rec recordings in the text format" << endl;
+}
+
+bool dump(const char *path)
+{
+    ifstream in(path, ifstream::binary);
+    if (!in)
+    {
+        cerr << "Failed to open file " << path << endl;
+        return false;
+    }
+
+    string magic(BinaryRecord::MAGIC.size(), '\0');
+    if (!in.read(&magic[0], magic.size()) || magic != BinaryRecord::MAGIC)
+    {
+        cerr << path << " is not a binary recording" << endl;
+        return false;
+    }
+
+    BinaryRecord rec;
+    while (in.peek() != EOF)
+    {
+        if (!rec.decode(in))
+        {
+            cerr << path << " ends with a truncated or corrupted record" << endl;
+            return false;
+        }
+        cout << rec.toText() << '\n';
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || !strcmp(argv[1], "-h"))
+    {
+        usage();
+        exit(argc < 2 ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!dump(argv[i]))
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
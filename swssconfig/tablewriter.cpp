@@ -0,0 +1,207 @@
+#include "tablewriter.h"
+#include "logger.h"
+#include "zmqproducerstatetable.h"
+
+using namespace std;
+using namespace swss;
+
+/* Entries handed over to a writer at once */
+#define TABLE_WRITER_BATCH_SIZE 512
+/* Batches queued per writer before the producer waits */
+#define TABLE_WRITER_MAX_QUEUED 8
+
+TableWriter::TableWriter(size_t writers, const set<string> &zmqTables, shared_ptr<ZmqClient> zmqClient) :
+    m_zmqTables(zmqTables),
+    m_zmqClient(zmqClient),
+    m_written(0)
+{
+    if (writers == 0)
+    {
+        writers = 1;
+    }
+
+    for (size_t i = 0; i < writers; i++)
+    {
+        m_writers.emplace_back(new Writer());
+        auto writer = m_writers.back().get();
+        writer->thread = thread(&TableWriter::run, this, ref(*writer));
+    }
+}
+
+TableWriter::~TableWriter()
+{
+    for (auto &writer : m_writers)
+    {
+        {
+            lock_guard<mutex> lock(writer->mutex);
+            writer->stop = true;
+        }
+        writer->cv.notify_all();
+        writer->thread.join();
+    }
+}
+
+void TableWriter::write(const string &table, KeyOpFieldsValuesTuple &&entry)
+{
+    auto it = m_tableWriters.find(table);
+    if (it == m_tableWriters.end())
+    {
+        Writer *writer;
+        if (m_zmqClient != nullptr && m_zmqTables.find(table) != m_zmqTables.end())
+        {
+            writer = m_writers.front().get();
+        }
+        else
+        {
+            writer = m_writers[m_nextWriter++ % m_writers.size()].get();
+        }
+        it = m_tableWriters.emplace(table, writer).first;
+    }
+
+    auto &writer = *it->second;
+    writer.pending.emplace_back(table, move(entry));
+    if (writer.pending.size() >= TABLE_WRITER_BATCH_SIZE)
+    {
+        submit(writer);
+    }
+}
+
+void TableWriter::flush()
+{
+    for (auto &writer : m_writers)
+    {
+        if (!writer->pending.empty())
+        {
+            submit(*writer);
+        }
+    }
+
+    for (auto &writer : m_writers)
+    {
+        unique_lock<mutex> lock(writer->mutex);
+        writer->cv.wait(lock, [&] { return (writer->queue.empty() && !writer->busy) || writer->error; });
+        lock.unlock();
+        checkError(*writer);
+    }
+}
+
+uint64_t TableWriter::getWritten() const
+{
+    return m_written.load();
+}
+
+void TableWriter::submit(Writer &writer)
+{
+    {
+        unique_lock<mutex> lock(writer.mutex);
+        writer.cv.wait(lock, [&] { return writer.queue.size() < TABLE_WRITER_MAX_QUEUED || writer.error; });
+        if (!writer.error)
+        {
+            writer.queue.push_back(move(writer.pending));
+        }
+    }
+    writer.pending = Batch();
+    writer.cv.notify_all();
+
+    checkError(writer);
+}
+
+void TableWriter::checkError(Writer &writer)
+{
+    exception_ptr error;
+    {
+        lock_guard<mutex> lock(writer.mutex);
+        error = writer.error;
+    }
+
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
+void TableWriter::run(Writer &writer)
+{
+    while (true)
+    {
+        Batch batch;
+        {
+            unique_lock<mutex> lock(writer.mutex);
+            writer.cv.wait(lock, [&] { return !writer.queue.empty() || writer.stop; });
+            if (writer.queue.empty())
+            {
+                return;
+            }
+            batch = move(writer.queue.front());
+            writer.queue.pop_front();
+            writer.busy = true;
+        }
+        writer.cv.notify_all();
+
+        exception_ptr error;
+        try
+        {
+            writeBatch(writer, batch);
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+
+        {
+            lock_guard<mutex> lock(writer.mutex);
+            writer.busy = false;
+            if (error)
+            {
+                writer.error = error;
+                writer.queue.clear();
+            }
+        }
+        writer.cv.notify_all();
+
+        if (error)
+        {
+            return;
+        }
+    }
+}
+
+void TableWriter::writeBatch(Writer &writer, Batch &batch)
+{
+    for (auto &item : batch)
+    {
+        const auto &table = item.first;
+        auto &entry = item.second;
+
+        auto it = writer.tables.find(table);
+        if (it == writer.tables.end())
+        {
+            shared_ptr<ProducerStateTable> p_table;
+            if (m_zmqClient != nullptr && m_zmqTables.find(table) != m_zmqTables.end())
+            {
+                p_table = make_shared<ZmqProducerStateTable>(&writer.pipeline, table, *m_zmqClient, true);
+            }
+            else
+            {
+                p_table = make_shared<ProducerStateTable>(&writer.pipeline, table, true);
+            }
+            it = writer.tables.emplace(table, p_table).first;
+        }
+
+        if (kfvOp(entry) == SET_COMMAND)
+        {
+            it->second->set(kfvKey(entry), kfvFieldsValues(entry), SET_COMMAND);
+        }
+        else if (kfvOp(entry) == DEL_COMMAND)
+        {
+            it->second->del(kfvKey(entry), DEL_COMMAND);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Invalid operation: %s", kfvOp(entry).c_str());
+        }
+    }
+
+    writer.pipeline.flush();
+    m_written += batch.size();
+}
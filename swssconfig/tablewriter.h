@@ -0,0 +1,101 @@
+#ifndef SWSS_TABLEWRITER_H
+#define SWSS_TABLEWRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "dbconnector.h"
+#include "producerstatetable.h"
+#include "redispipeline.h"
+#include "table.h"
+#include "zmqclient.h"
+
+namespace swss {
+
+/*
+ * TableWriter writes APPL_DB entries through several writer threads, each
+ * with its own connection and pipeline. All the entries of a table go to
+ * the same writer, so they are written in order, but entries of different
+ * tables may be written in any order. With a single writer, entries are
+ * written in the order they are given.
+ *
+ * Entries are handed over in batches and at most a few batches are queued
+ * per writer, so a producer faster than Redis is slowed down rather than
+ * buffering the whole input.
+ *
+ * ZMQ tables all go to the first writer, so the ZMQ client is only used
+ * from one thread.
+ */
+class TableWriter
+{
+public:
+    TableWriter(size_t writers,
+                const std::set<std::string> &zmqTables = {},
+                std::shared_ptr<ZmqClient> zmqClient = nullptr);
+    /* Call flush() first, entries not flushed may be dropped */
+    ~TableWriter();
+
+    /* Queue a SET or DEL of the key of entry in table */
+    void write(const std::string &table, KeyOpFieldsValuesTuple &&entry);
+
+    /* Wait until everything queued is written to Redis */
+    void flush();
+
+    /* Entries written to Redis so far */
+    uint64_t getWritten() const;
+
+private:
+    typedef std::vector<std::pair<std::string, KeyOpFieldsValuesTuple>> Batch;
+
+    struct Writer
+    {
+        Writer() :
+            db("APPL_DB", 0, false),
+            pipeline(&db)
+        {
+        }
+
+        DBConnector db;
+        RedisPipeline pipeline;
+        std::unordered_map<std::string, std::shared_ptr<ProducerStateTable>> tables;
+
+        /* Batch being filled by the producer */
+        Batch pending;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Batch> queue;
+        bool busy = false;
+        bool stop = false;
+        std::exception_ptr error;
+
+        std::thread thread;
+    };
+
+    void run(Writer &writer);
+    void writeBatch(Writer &writer, Batch &batch);
+    void submit(Writer &writer);
+    void checkError(Writer &writer);
+
+    std::vector<std::unique_ptr<Writer>> m_writers;
+    std::unordered_map<std::string, Writer *> m_tableWriters;
+    size_t m_nextWriter = 0;
+
+    std::set<std::string> m_zmqTables;
+    std::shared_ptr<ZmqClient> m_zmqClient;
+
+    std::atomic<uint64_t> m_written;
+};
+
+}
+
+#endif /* SWSS_TABLEWRITER_H */
@@ -380,7 +380,28 @@ class TestAcl(object):
                             priority=3, action=Action.ACTION_PERMIT, terminating=False,
                             src_addr=["192.168.0.1/32", "192.168.1.2/30"], dst_addr=["192.168.0.1/32", "192.168.1.2/30"],
                             src_port=[PortRange(0,1)], dst_port=[PortRange(0,1)])
-        ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=4)
+        # Setting ACL_RULE_2 again replaces it
+        ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=3)
+
+    def test_acl_rule_replace(self, ctx):
+        ctx.create_acl_group(ACL_GROUP_1, IpVersion.IP_VERSION_IPV4)
+
+        ctx.create_acl_rule(ACL_GROUP_1, ACL_RULE_1,
+                            priority=1, action=Action.ACTION_PERMIT, terminating=False,
+                            src_addr=["192.168.0.1/32", "192.168.1.2/30"], dst_addr=["192.168.0.1/32", "192.168.1.2/30"],
+                            src_port=[PortRange(0,1)], dst_port=[PortRange(0,1)])
+        rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+
+        # Setting an existing rule replaces it
+        ctx.create_acl_rule(ACL_GROUP_1, ACL_RULE_1,
+                            priority=1, action=Action.ACTION_DENY, terminating=False,
+                            src_addr=["192.168.0.1/32", "192.168.1.2/30"], dst_addr=["192.168.0.1/32", "192.168.1.2/30"],
+                            src_port=[PortRange(0,1)], dst_port=[PortRange(0,1)])
+        ctx.asic_dash_acl_rule_table.wait_for_deleted_keys(deleted_keys=[rule1_id])
+        rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        assert rule1_attr["SAI_DASH_ACL_RULE_ATTR_PRIORITY"] == "1"
+        assert rule1_attr["SAI_DASH_ACL_RULE_ATTR_ACTION"] == "SAI_DASH_ACL_RULE_ACTION_DENY_AND_CONTINUE"
 
     def test_acl_group(self, ctx):
         ctx.create_acl_group(ACL_GROUP_1, IpVersion.IP_VERSION_IPV6)
@@ -505,8 +526,8 @@ class TestAcl(object):
         ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=2)
 
 
-    # @pytest.mark.parametrize("bind_group", [True, False])
-    def test_prefix_single_tag(self, ctx):
+    @pytest.mark.parametrize("bind_group", [True, False])
+    def test_prefix_single_tag(self, ctx, bind_group):
         tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
         ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
         tag2_prefixes = {"192.168.1.0/30", "192.168.2.0/30", "192.168.3.0/30"}
@@ -526,43 +547,42 @@ class TestAcl(object):
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # Updating tags will not be supported until full tag support is implemented in SAI
-        # if bind_group:
-            # self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
+        if bind_group:
+            self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
 
-        # tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
-        # ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
+        tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
+        ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # if bind_group:
-        #     new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
-        #     assert new_group1_id != group1_id
-        #     self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
+        if bind_group:
+            # The group is updated in place or swapped for an updated copy, depending on the SAI
+            new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+            self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # tag2_prefixes = {"192.168.2.0/30", "192.168.3.0/30"}
-        # ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
+        tag2_prefixes = {"192.168.2.0/30", "192.168.3.0/30"}
+        ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)
-        # rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)
+        rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # if bind_group:
-        #     ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
+        if bind_group:
+            ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
 
-    # @pytest.mark.parametrize("bind_group", [True, False])
-    def test_multiple_tags(self, ctx):
+    @pytest.mark.parametrize("bind_group", [True, False])
+    def test_multiple_tags(self, ctx, bind_group):
         tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
         ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
@@ -587,35 +607,32 @@ class TestAcl(object):
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes.union(tag2_prefixes)
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes.union(tag3_prefixes)
 
-        # Updating tags will not be supported until full tag support is implemented in SAI
-        # if bind_group:
-            # self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
-
-        # tag2_prefixes = {"192.168.10.0/30", "192.168.11.0/30", "192.168.12.0/30"}
-        # ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
+        if bind_group:
+            self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
 
-        # tag3_prefixes = {"3.13.0.0/16", "3.14.0.0/16", "4.14.4.0/24", "5.15.5.0/24"}
-        # ctx.create_prefix_tag(TAG_3, IpVersion.IP_VERSION_IPV4, tag3_prefixes)
+        tag2_prefixes = {"192.168.10.0/30", "192.168.11.0/30", "192.168.12.0/30"}
+        ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
 
-        # time.sleep(3)
+        tag3_prefixes = {"3.13.0.0/16", "3.14.0.0/16", "4.14.4.0/24", "5.15.5.0/24"}
+        ctx.create_prefix_tag(TAG_3, IpVersion.IP_VERSION_IPV4, tag3_prefixes)
 
-        # if bind_group:
-        #     new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
-        #     assert new_group1_id != group1_id
+        time.sleep(3)
 
-        #     self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
+        if bind_group:
+            new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+            self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
 
-        # rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes.union(tag2_prefixes)
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes.union(tag3_prefixes)
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes.union(tag2_prefixes)
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes.union(tag3_prefixes)
 
-        # if bind_group:
-        #     ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
+        if bind_group:
+            ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
 
-    # @pytest.mark.parametrize("bind_group", [True, False])
-    def test_multiple_tags_and_prefixes(self, ctx):
+    @pytest.mark.parametrize("bind_group", [True, False])
+    def test_multiple_tags_and_prefixes(self, ctx, bind_group):
         tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
         ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
@@ -645,40 +662,38 @@ class TestAcl(object):
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == super_set
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == prefix_list
 
-        # Updating tags will not be supported until full tag support is implemented in SAI
-        # if bind_group:
-        #     self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
+        if bind_group:
+            self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
 
-        # tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
-        # ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
+        tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
+        ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
-        # tag2_prefixes = {"192.168.1.2/32", "192.168.2.2/32", "192.168.1.2/32"}
-        # ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
+        tag2_prefixes = {"192.168.1.2/32", "192.168.2.2/32", "192.168.1.2/32"}
+        ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
 
-        # tag3_prefixes = {"3.3.0.0/16", "3.4.0.0/16", "4.4.4.0/24", "5.5.5.0/24"}
-        # ctx.create_prefix_tag(TAG_3, IpVersion.IP_VERSION_IPV4, tag3_prefixes)
+        tag3_prefixes = {"3.3.0.0/16", "3.4.0.0/16", "4.4.4.0/24", "5.5.5.0/24"}
+        ctx.create_prefix_tag(TAG_3, IpVersion.IP_VERSION_IPV4, tag3_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # if bind_group:
-        #     new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
-        #     assert new_group1_id != group1_id
-        #     self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
+        if bind_group:
+            new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+            self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
 
-        # rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # super_set = set()
-        # super_set.update(tag1_prefixes, tag2_prefixes, tag3_prefixes)
+        super_set = set()
+        super_set.update(tag1_prefixes, tag2_prefixes, tag3_prefixes)
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == super_set
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == prefix_list
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == super_set
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == prefix_list
 
-        # if bind_group:
-        #     ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
+        if bind_group:
+            ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
 
-    # @pytest.mark.parametrize("bind_group", [True, False])
-    def test_multiple_groups_prefix_single_tag(self, ctx):
+    @pytest.mark.parametrize("bind_group", [True, False])
+    def test_multiple_groups_prefix_single_tag(self, ctx, bind_group):
         groups = [ACL_GROUP_1, ACL_GROUP_2, ACL_GROUP_3]
         stages = [ACL_STAGE_1, ACL_STAGE_2, ACL_STAGE_3]
 
@@ -699,38 +714,37 @@ class TestAcl(object):
             rule_attrs = ctx.asic_dash_acl_rule_table[rid]
             assert prefix_list_to_set(rule_attrs["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
 
-        # Updating tags will not be supported until full tag support is implemented in SAI
-        # if bind_group:
-        #     eni_stages = []
-        #     eni_key = ctx.asic_eni_table.get_keys()[0]
-        #     for stage, group in zip(stages, groups):
-        #         ctx.bind_acl_in(self.eni_name, stage, group)
-        #         eni_stages.append(get_sai_stage(outbound=False, v4=True, stage_num=stage))
+        if bind_group:
+            eni_stages = []
+            eni_key = ctx.asic_eni_table.get_keys()[0]
+            for stage, group in zip(stages, groups):
+                ctx.bind_acl_in(self.eni_name, stage, group)
+                eni_stages.append(get_sai_stage(outbound=False, v4=True, stage_num=stage))
 
-        #     ctx.asic_eni_table.wait_for_fields(key=eni_key, expected_fields=eni_stages)
-        #     for stage in eni_stages:
-        #         assert ctx.asic_eni_table[eni_key][stage] in group_ids
+            ctx.asic_eni_table.wait_for_fields(key=eni_key, expected_fields=eni_stages)
+            for stage in eni_stages:
+                assert ctx.asic_eni_table[eni_key][stage] in group_ids
 
-        # tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
-        # ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
+        tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
+        ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # rule_ids = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=3)
+        rule_ids = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=3)
 
-        # for rid in rule_ids:
-        #     rule_attrs = ctx.asic_dash_acl_rule_table[rid]
-        #     assert prefix_list_to_set(rule_attrs["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        for rid in rule_ids:
+            rule_attrs = ctx.asic_dash_acl_rule_table[rid]
+            assert prefix_list_to_set(rule_attrs["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
 
-        # if bind_group:
-        #     new_group_ids = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=3)
+        if bind_group:
+            new_group_ids = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=3)
 
-        #     ctx.asic_eni_table.wait_for_fields(key=eni_key, expected_fields=eni_stages)
-        #     for stage in eni_stages:
-        #         assert ctx.asic_eni_table[eni_key][stage] in new_group_ids
+            ctx.asic_eni_table.wait_for_fields(key=eni_key, expected_fields=eni_stages)
+            for stage in eni_stages:
+                assert ctx.asic_eni_table[eni_key][stage] in new_group_ids
 
-        #     for stage in stages:
-        #         ctx.unbind_acl_in(self.eni_name, stage)
+            for stage in stages:
+                ctx.unbind_acl_in(self.eni_name, stage)
 
     def test_tag_remove(self, ctx):
         tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
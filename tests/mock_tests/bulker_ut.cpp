@@ -1,5 +1,7 @@
 #include "ut_helper.h"
 #include "bulker.h"
+#include <atomic>
+#include <thread>
 
 extern sai_route_api_t *sai_route_api;
 extern sai_neighbor_api_t *sai_neighbor_api;
@@ -8,6 +10,64 @@ namespace bulker_test
 {
     using namespace std;
 
+    atomic<bool> release_bulk;
+    atomic<uint32_t> created_routes;
+
+    sai_status_t create_route_entries_blocking(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        while (!release_bulk)
+        {
+            this_thread::yield();
+        }
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        created_routes += object_count;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t create_route_entries_limited(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        // Reject bulks above a vendor limit of 100 entries as a whole
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = object_count > 100 ? SAI_STATUS_INSUFFICIENT_RESOURCES : SAI_STATUS_SUCCESS;
+        }
+        return object_count > 100 ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t create_dash_acl_rules_partial(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        // Stop on the third rule as the table is full
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = i < 2 ? 0x1000 + i : SAI_NULL_OBJECT_ID;
+            object_statuses[i] = i < 2 ? SAI_STATUS_SUCCESS : (i == 2 ? SAI_STATUS_TABLE_FULL : SAI_STATUS_NOT_EXECUTED);
+        }
+        return SAI_STATUS_FAILURE;
+    }
+
     struct BulkerTest : public ::testing::Test
     {
         BulkerTest()
@@ -173,4 +233,200 @@ namespace bulker_test
         // Confirm neighbor entry is pending removal
         ASSERT_TRUE(gNeighBulker.bulk_entry_pending_removal(neighbor_entry_remove));
     }
+
+    TEST_F(BulkerTest, BulkerAsyncFlush)
+    {
+        sai_route_api->create_route_entries = create_route_entries_blocking;
+        release_bulk = false;
+        created_routes = 0;
+
+        EntityBulker<sai_route_api_t> gRouteBulker(sai_route_api, 1000);
+        deque<sai_status_t> object_statuses;
+
+        sai_route_entry_t route_entry;
+        route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        route_entry.destination.addr.ip4 = htonl(0x0a00000f);
+        route_entry.destination.mask.ip4 = htonl(0xffffff00);
+        route_entry.vr_id = 0x0;
+        route_entry.switch_id = 0x0;
+
+        sai_attribute_t route_attr;
+        route_attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        route_attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+        object_statuses.emplace_back();
+        gRouteBulker.create_entry(&object_statuses.back(), &route_entry, 1, &route_attr);
+
+        atomic<bool> done(false);
+        gRouteBulker.flush_async([&done]() { done = true; });
+        ASSERT_TRUE(gRouteBulker.flush_in_flight());
+
+        // The next batch is built while the first one is in flight
+        ASSERT_EQ(gRouteBulker.creating_entries_count(), 0);
+        route_entry.destination.addr.ip4 = htonl(0x0a00010f);
+        object_statuses.emplace_back();
+        gRouteBulker.create_entry(&object_statuses.back(), &route_entry, 1, &route_attr);
+        ASSERT_EQ(gRouteBulker.creating_entries_count(), 1);
+        ASSERT_FALSE(done);
+
+        release_bulk = true;
+        gRouteBulker.wait();
+        ASSERT_TRUE(done);
+        ASSERT_FALSE(gRouteBulker.flush_in_flight());
+        ASSERT_EQ(created_routes, 1);
+        ASSERT_EQ(object_statuses.front(), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(object_statuses.back(), SAI_STATUS_NOT_EXECUTED);
+
+        gRouteBulker.flush();
+        ASSERT_EQ(created_routes, 2);
+        ASSERT_EQ(object_statuses.back(), SAI_STATUS_SUCCESS);
+    }
+
+    TEST_F(BulkerTest, BulkSizerAdaptive)
+    {
+        BulkSizer sizer(1000);
+        BulkSizer::setAdaptive(true);
+        BulkSizer::setLatencyTarget(100000);
+
+        ASSERT_EQ(sizer.size(), 1000);
+        ASSERT_EQ(sizer.getMinBulkSize(), size_t(BulkSizer::DEFAULT_MIN_BULK_SIZE));
+
+        // Too slow, scale down to the latency target
+        sizer.record(1000, 0, chrono::milliseconds(400));
+        ASSERT_EQ(sizer.size(), 250);
+
+        // A full bulk well within the target grows the size
+        sizer.record(250, 0, chrono::milliseconds(1));
+        ASSERT_EQ(sizer.size(), 312);
+
+        // A partial bulk says nothing about the limit
+        sizer.record(50, 0, chrono::milliseconds(1));
+        ASSERT_EQ(sizer.size(), 312);
+
+        // The max guard holds
+        for (int i = 0; i < 100; i++)
+        {
+            sizer.record(sizer.size(), 0, chrono::milliseconds(1));
+        }
+        ASSERT_EQ(sizer.size(), 1000);
+
+        // Most entries failed, halve the size and stay below the failed size
+        sizer.record(1000, 900, chrono::milliseconds(1));
+        ASSERT_EQ(sizer.size(), 500);
+        for (int i = 0; i < 100; i++)
+        {
+            sizer.record(sizer.size(), 0, chrono::milliseconds(1));
+        }
+        ASSERT_GT(sizer.size(), 900);
+        ASSERT_LT(sizer.size(), 1000);
+
+        // The min guard holds
+        for (int i = 0; i < 10; i++)
+        {
+            sizer.record(sizer.size(), sizer.size(), chrono::milliseconds(1));
+        }
+        ASSERT_EQ(sizer.size(), size_t(BulkSizer::DEFAULT_MIN_BULK_SIZE));
+
+        // The failed size is tried again after enough successful calls
+        for (uint64_t i = 1; i < BulkSizer::CEILING_EXPIRY_CALLS; i++)
+        {
+            sizer.record(sizer.size(), 0, chrono::milliseconds(1));
+        }
+        ASSERT_EQ(sizer.size(), size_t(BulkSizer::DEFAULT_MIN_BULK_SIZE));
+        for (int i = 0; i < 100; i++)
+        {
+            sizer.record(sizer.size(), 0, chrono::milliseconds(1));
+        }
+        ASSERT_EQ(sizer.size(), 1000);
+
+        auto stats = sizer.getStats();
+        ASSERT_EQ(stats.calls, 313 + BulkSizer::CEILING_EXPIRY_CALLS);
+        ASSERT_EQ(stats.shrinks, 8);
+        ASSERT_EQ(stats.maxLatencyUs, 400000);
+
+        BulkSizer::setAdaptive(false);
+        BulkSizer::setLatencyTarget(BulkSizer::DEFAULT_LATENCY_TARGET_US);
+        ASSERT_EQ(sizer.size(), 1000);
+    }
+
+    TEST_F(BulkerTest, BulkerAdaptiveSize)
+    {
+        sai_route_api->create_route_entries = create_route_entries_limited;
+        BulkSizer::setAdaptive(true);
+
+        EntityBulker<sai_route_api_t> gRouteBulker(sai_route_api, 1000);
+        gRouteBulker.sizer = make_shared<BulkSizer>(1000);
+        deque<sai_status_t> object_statuses;
+
+        sai_route_entry_t route_entry;
+        route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        route_entry.destination.mask.ip4 = htonl(0xffffff00);
+        route_entry.vr_id = 0x0;
+        route_entry.switch_id = 0x0;
+
+        sai_attribute_t route_attr;
+        route_attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        route_attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+        // Retry the failed routes until the bulk size settles below the vendor limit
+        size_t failed = 0;
+        for (int round = 0; round < 20; round++)
+        {
+            object_statuses.clear();
+            for (uint32_t i = 0; i < 400; i++)
+            {
+                route_entry.destination.addr.ip4 = htonl(0x0a000000 + (i << 8));
+                object_statuses.emplace_back();
+                gRouteBulker.create_entry(&object_statuses.back(), &route_entry, 1, &route_attr);
+            }
+            gRouteBulker.flush();
+
+            failed = count_if(object_statuses.begin(), object_statuses.end(),
+                    [](sai_status_t status) { return status != SAI_STATUS_SUCCESS; });
+        }
+
+        ASSERT_EQ(failed, 0);
+        ASSERT_LE(gRouteBulker.bulk_size(), 100);
+        ASSERT_GE(gRouteBulker.sizer->getStats().failedEntries, 400);
+
+        BulkSizer::setAdaptive(false);
+        ASSERT_EQ(gRouteBulker.bulk_size(), 1000);
+    }
+
+    TEST_F(BulkerTest, ObjectBulkerCreateStatus)
+    {
+        sai_dash_acl_api_t dash_acl_api = {};
+        dash_acl_api.create_dash_acl_rules = create_dash_acl_rules_partial;
+
+        ObjectBulker<sai_dash_acl_api_t> bulker(&dash_acl_api, 0x0, 1000);
+
+        sai_attribute_t attr;
+        attr.id = SAI_DASH_ACL_RULE_ATTR_PRIORITY;
+        attr.value.u32 = 1;
+
+        deque<sai_object_id_t> object_ids;
+        deque<sai_status_t> object_statuses;
+        for (int i = 0; i < 4; i++)
+        {
+            object_ids.emplace_back();
+            object_statuses.emplace_back();
+            ASSERT_EQ(bulker.create_entry(&object_ids.back(), &object_statuses.back(), 1, &attr), SAI_STATUS_NOT_EXECUTED);
+        }
+        // An entry without a status is still created
+        sai_object_id_t no_status_id;
+        bulker.create_entry(&no_status_id, 1, &attr);
+
+        bulker.flush();
+
+        ASSERT_EQ(object_ids[0], 0x1000);
+        ASSERT_EQ(object_ids[1], 0x1001);
+        ASSERT_EQ(object_ids[2], SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(object_ids[3], SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(no_status_id, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(object_statuses[0], SAI_STATUS_SUCCESS);
+        ASSERT_EQ(object_statuses[1], SAI_STATUS_SUCCESS);
+        ASSERT_EQ(object_statuses[2], SAI_STATUS_TABLE_FULL);
+        ASSERT_EQ(object_statuses[3], SAI_STATUS_NOT_EXECUTED);
+        ASSERT_TRUE(bulker.creating_statuses.empty());
+    }
 }
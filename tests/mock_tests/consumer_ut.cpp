@@ -342,6 +342,99 @@ namespace consumer_test
 
     }
 
+    TEST_F(ConsumerTest, ConsumerAddToSync_Flat_Del_Set_Setnew)
+    {
+        // Test case, flat SyncMap keeps the DEL, SET then merged SET semantics
+        consumer->m_toSync.setFlat(true);
+
+        auto entrya = KeyOpFieldsValuesTuple(
+            { key,
+                DEL_COMMAND,
+                { { } } });
+
+        auto entryb = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1a },
+                    { f2, v2a } } });
+
+        auto entryc = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1b },
+                    { f3, v3a } } });
+
+        for (auto x = 0; x < 100; x++)
+        {
+            kofv_q.push_back(entrya);
+            kofv_q.push_back(entryb);
+            kofv_q.push_back(entryc);
+            consumer->addToSync(kofv_q);
+            kofv_q.clear();
+
+            // expect DEL then SET with new values and new fields
+            exp_kofv = entrya;
+            validate_syncmap(consumer->m_toSync, 2, key, exp_kofv);
+
+            exp_kofv = KeyOpFieldsValuesTuple(
+                { key,
+                    SET_COMMAND,
+                    { { f2, v2a },
+                        { f1, v1b },
+                        { f3, v3a } } });
+
+            validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
+        }
+    }
+
+    TEST_F(ConsumerTest, ConsumerAddToSync_Flat_Order)
+    {
+        auto set = [](const string &k) {
+            return KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { "f", "v" } } });
+        };
+        auto del = [](const string &k) {
+            return KeyOpFieldsValuesTuple({ k, DEL_COMMAND, { } });
+        };
+
+        consumer->m_toSync.setFlat(true);
+
+        // Test case, keys are kept in arrival order, the tasks of one key stay adjacent
+        kofv_q = { set("c"), set("a"), del("b"), set("b"), del("c"), set("c") };
+        consumer->addToSync(kofv_q);
+
+        // a DEL drops the pending tasks of its key, so "c" is queued again at the end
+        vector<pair<string, string>> expected = {
+            { "a", SET_COMMAND },
+            { "b", DEL_COMMAND }, { "b", SET_COMMAND },
+            { "c", DEL_COMMAND }, { "c", SET_COMMAND }
+        };
+
+        ASSERT_EQ(consumer->m_toSync.size(), expected.size());
+        ASSERT_EQ(consumer->m_toSync.count("c"), 2u);
+        size_t i = 0;
+        for (auto &entry : consumer->m_toSync)
+        {
+            EXPECT_EQ(entry.first, expected[i].first);
+            EXPECT_EQ(kfvOp(entry.second), expected[i].second);
+            i++;
+        }
+
+        // Test case, walk back over the pending DEL of a key as NeighOrch does
+        auto it = consumer->m_toSync.find("b");
+        ASSERT_EQ(kfvOp(it->second), DEL_COMMAND);
+        it = consumer->m_toSync.erase(next(it));
+        auto rit = make_reverse_iterator(it);
+        ASSERT_TRUE(rit != consumer->m_toSync.rend());
+        EXPECT_EQ(rit->first, "b");
+        consumer->m_toSync.erase(next(rit).base());
+        EXPECT_EQ(consumer->m_toSync.count("b"), 0u);
+
+        // Test case, switching back to the ordered map keeps pending tasks
+        consumer->m_toSync.setFlat(false);
+        ASSERT_EQ(consumer->m_toSync.size(), 3u);
+        EXPECT_EQ(consumer->m_toSync.begin()->first, "a");
+    }
+
     TEST_F(ConsumerTest, ConsumerPops_notification_count)
     {
         int consumer_pops_batch_size = 10;
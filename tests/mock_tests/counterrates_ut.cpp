@@ -0,0 +1,189 @@
+#include "ut_helper.h"
+#include "counterrates.h"
+
+namespace counterrates_test
+{
+    using namespace std;
+
+    static const CounterRateSpec &getSpec(const string &type)
+    {
+        for (const auto &spec : CounterRates::getSpecs())
+        {
+            if (spec.type == type)
+            {
+                return spec;
+            }
+        }
+        throw out_of_range(type);
+    }
+
+    static string getField(const vector<FieldValueTuple> &fvs, const string &field)
+    {
+        for (const auto &fv : fvs)
+        {
+            if (fvField(fv) == field)
+            {
+                return fvValue(fv);
+            }
+        }
+        return "";
+    }
+
+    /* Snapshot with every counter set to value, some overridden */
+    static vector<string> snapshot(const CounterRates &rates, uint64_t value, const map<string, string> &overrides = {})
+    {
+        vector<string> values;
+        for (const auto &counter : rates.getCounters())
+        {
+            auto it = overrides.find(counter);
+            values.push_back(it == overrides.end() ? to_string(value) : it->second);
+        }
+        return values;
+    }
+
+    TEST(CounterRates, RifRatesSmoothed)
+    {
+        CounterRates rates(getSpec("RIF"));
+        vector<FieldValueTuple> values, state;
+
+        ASSERT_TRUE(rates.update("oid:0x6000000000001", snapshot(rates, 1000), 1000, 0.5, 0, values, state));
+        EXPECT_EQ(getField(state, "INIT_DONE"), "COUNTERS_LAST");
+        EXPECT_EQ(getField(values, "RX_BPS"), "");
+        EXPECT_EQ(getField(values, "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS_last"), "1000");
+
+        /* The first rates are not smoothed */
+        values.clear();
+        state.clear();
+        ASSERT_TRUE(rates.update("oid:0x6000000000001", snapshot(rates, 3000), 1000, 0.5, 0, values, state));
+        EXPECT_EQ(getField(state, "INIT_DONE"), "DONE");
+        EXPECT_EQ(getField(values, "RX_BPS"), "2000");
+        EXPECT_EQ(getField(values, "TX_PPS"), "2000");
+
+        /* 0.5 * 500 / 0.5s + 0.5 * 2000 */
+        values.clear();
+        state.clear();
+        ASSERT_TRUE(rates.update("oid:0x6000000000001", snapshot(rates, 3500), 500, 0.5, 0, values, state));
+        EXPECT_TRUE(state.empty());
+        EXPECT_EQ(getField(values, "RX_BPS"), "1500");
+
+        values.clear();
+        ASSERT_TRUE(rates.update("oid:0x6000000000001", snapshot(rates, 3500), 1000, 0.5, 0, values, state));
+        EXPECT_EQ(getField(values, "RX_BPS"), "750");
+    }
+
+    TEST(CounterRates, PortPpsSumsCounters)
+    {
+        CounterRates rates(getSpec("PORT"));
+        vector<FieldValueTuple> values, state;
+
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0), 1000, 1, 0, values, state));
+
+        values.clear();
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0, {
+            { "SAI_PORT_STAT_IF_IN_UCAST_PKTS", "100" },
+            { "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS", "50" },
+        }), 1000, 1, 0, values, state));
+        EXPECT_EQ(getField(values, "RX_PPS"), "150");
+        EXPECT_EQ(getField(values, "TX_PPS"), "0");
+    }
+
+    TEST(CounterRates, MissingCounters)
+    {
+        vector<FieldValueTuple> values, state;
+
+        /* A port missing a counter is skipped */
+        CounterRates portRates(getSpec("PORT"));
+        EXPECT_FALSE(portRates.update("oid:0x1000000000002", snapshot(portRates, 1, { { "SAI_PORT_STAT_IF_OUT_OCTETS", "" } }),
+                                      1000, 0.5, 0, values, state));
+        EXPECT_TRUE(values.empty());
+        EXPECT_TRUE(portRates.getObjects().empty());
+
+        /* A trap missing its counter counts from 0 */
+        CounterRates trapRates(getSpec("TRAP"));
+        ASSERT_TRUE(trapRates.update("oid:0x2000000000003", snapshot(trapRates, 0, { { "SAI_COUNTER_STAT_PACKETS", "" } }),
+                                     10000, 0.5, 0, values, state));
+        EXPECT_EQ(getField(values, "SAI_COUNTER_STAT_PACKETS_last"), "0");
+
+        values.clear();
+        ASSERT_TRUE(trapRates.update("oid:0x2000000000003", snapshot(trapRates, 100), 10000, 0.5, 0, values, state));
+        EXPECT_EQ(getField(values, "RX_PPS"), "10");
+    }
+
+    TEST(CounterRates, PortFecBer)
+    {
+        /* 4 x 25G lanes */
+        double serdesRate = CounterRates::getSerdesRate(4, 100000);
+        EXPECT_DOUBLE_EQ(serdesRate, 4 * 25.78125e+9);
+        EXPECT_EQ(CounterRates::getSerdesRate(3, 100000), 0);
+
+        CounterRates rates(getSpec("PORT"));
+        vector<FieldValueTuple> values, state;
+
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0), 1000, 0.5, serdesRate, values, state));
+        EXPECT_EQ(getField(values, "FEC_PRE_BER"), "-1");
+        EXPECT_EQ(getField(values, "FEC_MAX_T"), "");
+        EXPECT_EQ(getField(values, "SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last"), "0");
+
+        values.clear();
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0, {
+            { "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", "103125" },
+            { "SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S1", "7" },
+            { "SAI_PORT_STAT_IF_IN_FEC_CODEWORD_ERRORS_S3", "2" },
+        }), 1000, 0.5, serdesRate, values, state));
+        EXPECT_EQ(getField(values, "FEC_PRE_BER"), "1e-06");
+        EXPECT_EQ(getField(values, "FEC_PRE_BER_MAX"), "1e-06");
+        EXPECT_EQ(getField(values, "FEC_POST_BER"), "0");
+        EXPECT_EQ(getField(values, "FEC_MAX_T"), "3");
+
+        /* The max is only written when it grows */
+        values.clear();
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0, {
+            { "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", "103125" },
+        }), 1000, 0.5, serdesRate, values, state));
+        EXPECT_EQ(getField(values, "FEC_PRE_BER"), "0");
+        EXPECT_EQ(getField(values, "FEC_PRE_BER_MAX"), "");
+        EXPECT_EQ(getField(values, "FEC_MAX_T"), "-1");
+    }
+
+    TEST(CounterRates, FecPreBerMaxSeeded)
+    {
+        double serdesRate = CounterRates::getSerdesRate(4, 100000);
+        CounterRates rates(getSpec("PORT"));
+        vector<FieldValueTuple> values, state;
+
+        /* The max already in RATES is kept until a higher BER is seen */
+        rates.setFecPreBerMax("oid:0x1000000000002", 2e-06);
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0), 1000, 0.5, serdesRate, values, state));
+        EXPECT_EQ(getField(state, "INIT_DONE"), "COUNTERS_LAST");
+
+        values.clear();
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0, {
+            { "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", "103125" },
+        }), 1000, 0.5, serdesRate, values, state));
+        EXPECT_EQ(getField(values, "FEC_PRE_BER"), "1e-06");
+        EXPECT_EQ(getField(values, "FEC_PRE_BER_MAX"), "");
+
+        values.clear();
+        ASSERT_TRUE(rates.update("oid:0x1000000000002", snapshot(rates, 0, {
+            { "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", "412500" },
+        }), 1000, 0.5, serdesRate, values, state));
+        EXPECT_EQ(getField(values, "FEC_PRE_BER_MAX"), "3e-06");
+    }
+
+    TEST(CounterRates, RemoveObject)
+    {
+        CounterRates rates(getSpec("TUNNEL"));
+        vector<FieldValueTuple> values, state;
+
+        ASSERT_TRUE(rates.update("oid:0x2a000000000004", snapshot(rates, 10), 10000, 0.5, 0, values, state));
+        ASSERT_EQ(rates.getObjects().size(), 1u);
+
+        rates.remove("oid:0x2a000000000004");
+        EXPECT_TRUE(rates.getObjects().empty());
+
+        /* A new object with the same key starts over */
+        state.clear();
+        ASSERT_TRUE(rates.update("oid:0x2a000000000004", snapshot(rates, 10), 10000, 0.5, 0, values, state));
+        EXPECT_EQ(getField(state, "INIT_DONE"), "COUNTERS_LAST");
+    }
+}
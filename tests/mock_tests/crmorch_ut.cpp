@@ -0,0 +1,80 @@
+#include "mock_orch_test.h"
+#include "mock_table.h"
+
+extern CrmOrch *gCrmOrch;
+
+namespace crmorch_test
+{
+    using namespace std;
+    using namespace swss;
+    using namespace mock_orch_test;
+
+    class CrmOrchTest : public MockOrchTest
+    {
+    protected:
+        string getCounter(const string &field)
+        {
+            DBConnector counters_db("COUNTERS_DB", 0);
+            Table crm_table(&counters_db, COUNTERS_CRM_TABLE);
+
+            string value;
+            crm_table.hget("STATS", field, value);
+            return value;
+        }
+
+        void setCounter(const string &field, const string &value)
+        {
+            DBConnector counters_db("COUNTERS_DB", 0);
+            Table crm_table(&counters_db, COUNTERS_CRM_TABLE);
+
+            crm_table.hset("STATS", field, value);
+        }
+    };
+
+    TEST_F(CrmOrchTest, IncrementalPolling)
+    {
+        Portal::CrmOrchInternal::handleSetCommand(gCrmOrch, "Config", { { "incremental_polling", "true" } });
+
+        // The first poll is a full one
+        Portal::CrmOrchInternal::poll(gCrmOrch);
+        auto nexthop_used = getCounter("crm_stats_ipv4_nexthop_used");
+        ASSERT_NE(getCounter("crm_stats_ipv4_route_used"), "");
+        ASSERT_NE(nexthop_used, "");
+
+        for (const auto &res : Portal::CrmOrchInternal::getResourceMap(gCrmOrch))
+        {
+            for (const auto &cnt : res.second.countersMap)
+            {
+                EXPECT_FALSE(cnt.second.dirty);
+            }
+        }
+
+        // Only the changed counters are queried and written until the next
+        // full poll
+        setCounter("crm_stats_ipv4_route_used", "stale");
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEXTHOP);
+        ASSERT_TRUE(Portal::CrmOrchInternal::getResourceMap(gCrmOrch).at(CrmResourceType::CRM_IPV4_NEXTHOP).countersMap.at("STATS").dirty);
+
+        for (int i = 0; i < 9; i++)
+        {
+            Portal::CrmOrchInternal::poll(gCrmOrch);
+        }
+        ASSERT_FALSE(Portal::CrmOrchInternal::getResourceMap(gCrmOrch).at(CrmResourceType::CRM_IPV4_NEXTHOP).countersMap.at("STATS").dirty);
+        ASSERT_EQ(getCounter("crm_stats_ipv4_nexthop_used"), to_string(stoul(nexthop_used) + 1));
+        ASSERT_EQ(getCounter("crm_stats_ipv4_route_used"), "stale");
+
+        Portal::CrmOrchInternal::poll(gCrmOrch);
+        ASSERT_NE(getCounter("crm_stats_ipv4_route_used"), "stale");
+    }
+
+    TEST_F(CrmOrchTest, FullPolling)
+    {
+        Portal::CrmOrchInternal::poll(gCrmOrch);
+        ASSERT_NE(getCounter("crm_stats_ipv4_route_used"), "");
+
+        // Every poll rewrites all the counters
+        setCounter("crm_stats_ipv4_route_used", "stale");
+        Portal::CrmOrchInternal::poll(gCrmOrch);
+        ASSERT_NE(getCounter("crm_stats_ipv4_route_used"), "stale");
+    }
+}
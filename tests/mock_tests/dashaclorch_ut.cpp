@@ -0,0 +1,657 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#define private public
+#include "dash/dashaclorch.h"
+#undef private
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_dash_orch_test.h"
+#include "dash_api/acl_group.pb.h"
+#include "dash_api/acl_rule.pb.h"
+#include "dash_api/acl_in.pb.h"
+#include "dash_api/prefix_tag.pb.h"
+#include "gtest/gtest.h"
+
+extern sai_dash_acl_api_t *sai_dash_acl_api;
+extern sai_dash_eni_api_t *sai_dash_eni_api;
+
+namespace dashaclorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    sai_dash_acl_api_t ut_sai_dash_acl_api;
+    sai_dash_acl_api_t *pold_sai_dash_acl_api;
+    sai_dash_eni_api_t ut_sai_dash_eni_api;
+    sai_dash_eni_api_t *pold_sai_dash_eni_api;
+
+    sai_object_id_t next_oid;
+    set<sai_object_id_t> acl_groups;
+    // Priority of each rule in the SAI
+    map<sai_object_id_t, uint32_t> acl_rules;
+    // Rules of these priorities fail to be created
+    set<uint32_t> failing_priorities;
+    // Size of each bulk call, "create" or "remove"
+    vector<pair<string, uint32_t>> rule_bulks;
+    // Number of source prefixes of each rule in the SAI
+    map<sai_object_id_t, uint32_t> acl_rule_sips;
+    uint32_t rule_sets;
+    // Groups fail to be removed while set
+    bool acl_groups_in_use;
+    // ACL group bound to each stage of the ENI
+    map<sai_attr_id_t, sai_object_id_t> eni_acl_stages;
+    // Number of ACL group binds that succeed before one fails, -1 for none failing
+    int eni_binds_before_failure;
+
+    sai_status_t _ut_stub_create_dash_acl_group(
+        _Out_ sai_object_id_t *object_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        *object_id = ++next_oid;
+        acl_groups.insert(*object_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_remove_dash_acl_group(
+        _In_ sai_object_id_t object_id)
+    {
+        if (acl_groups_in_use)
+        {
+            return SAI_STATUS_OBJECT_IN_USE;
+        }
+
+        acl_groups.erase(object_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_create_dash_acl_rules(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        rule_bulks.emplace_back("create", object_count);
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+                continue;
+            }
+
+            uint32_t priority = 0;
+            uint32_t sips = 0;
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                if (attr_list[i][j].id == SAI_DASH_ACL_RULE_ATTR_PRIORITY)
+                {
+                    priority = attr_list[i][j].value.u32;
+                }
+                else if (attr_list[i][j].id == SAI_DASH_ACL_RULE_ATTR_SIP)
+                {
+                    sips = attr_list[i][j].value.ipprefixlist.count;
+                }
+            }
+
+            if (failing_priorities.find(priority) != failing_priorities.end())
+            {
+                // Stops on the error like the bulker asks for
+                object_statuses[i] = SAI_STATUS_TABLE_FULL;
+                status = SAI_STATUS_FAILURE;
+                continue;
+            }
+
+            object_id[i] = ++next_oid;
+            acl_rules[object_id[i]] = priority;
+            acl_rule_sips[object_id[i]] = sips;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+
+        return status;
+    }
+
+    sai_status_t _ut_stub_remove_dash_acl_rules(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        rule_bulks.emplace_back("remove", object_count);
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = acl_rules.erase(object_id[i]) ? SAI_STATUS_SUCCESS : SAI_STATUS_ITEM_NOT_FOUND;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_remove_dash_acl_rule(
+        _In_ sai_object_id_t object_id)
+    {
+        return acl_rules.erase(object_id) ? SAI_STATUS_SUCCESS : SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    sai_status_t _ut_stub_set_dash_acl_rule_attribute(
+        _In_ sai_object_id_t object_id,
+        _In_ const sai_attribute_t *attr)
+    {
+        rule_sets++;
+        if (attr->id == SAI_DASH_ACL_RULE_ATTR_SIP)
+        {
+            acl_rule_sips[object_id] = attr->value.ipprefixlist.count;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_set_eni_attribute(
+        _In_ sai_object_id_t eni_id,
+        _In_ const sai_attribute_t *attr)
+    {
+        if (attr->value.oid != SAI_NULL_OBJECT_ID && eni_binds_before_failure >= 0 && eni_binds_before_failure-- == 0)
+        {
+            return SAI_STATUS_TABLE_FULL;
+        }
+
+        eni_acl_stages[attr->id] = attr->value.oid;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    class DashAclOrchTest : public MockDashOrchTest
+    {
+    protected:
+        DashAclOrch *m_dashAclOrch;
+        map<string, unique_ptr<Consumer>> m_consumers;
+
+        void ApplySaiMock() override
+        {
+            // The rule bulker takes the API when the orch is created
+            pold_sai_dash_acl_api = sai_dash_acl_api;
+            memset(&ut_sai_dash_acl_api, 0, sizeof(ut_sai_dash_acl_api));
+            ut_sai_dash_acl_api.create_dash_acl_group = _ut_stub_create_dash_acl_group;
+            ut_sai_dash_acl_api.remove_dash_acl_group = _ut_stub_remove_dash_acl_group;
+            ut_sai_dash_acl_api.create_dash_acl_rules = _ut_stub_create_dash_acl_rules;
+            ut_sai_dash_acl_api.remove_dash_acl_rules = _ut_stub_remove_dash_acl_rules;
+            ut_sai_dash_acl_api.remove_dash_acl_rule = _ut_stub_remove_dash_acl_rule;
+            ut_sai_dash_acl_api.set_dash_acl_rule_attribute = _ut_stub_set_dash_acl_rule_attribute;
+            sai_dash_acl_api = &ut_sai_dash_acl_api;
+
+            pold_sai_dash_eni_api = sai_dash_eni_api;
+            ut_sai_dash_eni_api = *sai_dash_eni_api;
+            ut_sai_dash_eni_api.set_eni_attribute = _ut_stub_set_eni_attribute;
+            sai_dash_eni_api = &ut_sai_dash_eni_api;
+
+            next_oid = 0x1000;
+            acl_groups.clear();
+            acl_rules.clear();
+            failing_priorities.clear();
+            rule_bulks.clear();
+            acl_rule_sips.clear();
+            rule_sets = 0;
+            acl_groups_in_use = false;
+            eni_acl_stages.clear();
+            eni_binds_before_failure = -1;
+        }
+
+        void PostSetUp() override
+        {
+            vector<string> dash_acl_tables = {
+                APP_DASH_PREFIX_TAG_TABLE_NAME,
+                APP_DASH_ACL_IN_TABLE_NAME,
+                APP_DASH_ACL_OUT_TABLE_NAME,
+                APP_DASH_ACL_GROUP_TABLE_NAME,
+                APP_DASH_ACL_RULE_TABLE_NAME
+            };
+            m_dashAclOrch = new DashAclOrch(m_app_db.get(), dash_acl_tables, m_DashOrch, m_dpu_app_state_db.get(), nullptr);
+        }
+
+        void PreTearDown() override
+        {
+            m_consumers.clear();
+            delete m_dashAclOrch;
+            m_dashAclOrch = nullptr;
+            sai_dash_acl_api = pold_sai_dash_acl_api;
+            sai_dash_eni_api = pold_sai_dash_eni_api;
+        }
+
+        // Runs the tasks, along with the ones left to retry, returns the number of tasks left
+        size_t doAclTask(const string &table_name, const deque<KeyOpFieldsValuesTuple> &entries = {})
+        {
+            auto &consumer = m_consumers[table_name];
+            if (!consumer)
+            {
+                consumer = make_unique<Consumer>(
+                    new swss::ConsumerStateTable(m_app_db.get(), table_name),
+                    m_dashAclOrch, table_name);
+            }
+            consumer->addToSync(entries);
+            static_cast<Orch *>(m_dashAclOrch)->doTask(*consumer);
+            return consumer->m_toSync.size();
+        }
+
+        KeyOpFieldsValuesTuple groupTask(const string &group_id, const string &op = SET_COMMAND)
+        {
+            dash::acl_group::AclGroup group;
+            group.set_ip_version(dash::types::IP_VERSION_IPV4);
+            return KeyOpFieldsValuesTuple(group_id, op, { { "pb", group.SerializeAsString() } });
+        }
+
+        KeyOpFieldsValuesTuple ruleTask(const string &rule_key, uint32_t priority,
+                                        dash::acl_rule::Action action = dash::acl_rule::ACTION_PERMIT,
+                                        const vector<string> &src_tags = {})
+        {
+            dash::acl_rule::AclRule rule;
+            rule.set_priority(priority);
+            rule.set_action(action);
+            rule.set_terminating(false);
+            for (const auto &tag_id : src_tags)
+            {
+                rule.add_src_tag(tag_id);
+            }
+            return KeyOpFieldsValuesTuple(rule_key, SET_COMMAND, { { "pb", rule.SerializeAsString() } });
+        }
+
+        KeyOpFieldsValuesTuple ruleDelTask(const string &rule_key)
+        {
+            return KeyOpFieldsValuesTuple(rule_key, DEL_COMMAND, {});
+        }
+
+        KeyOpFieldsValuesTuple tagTask(const string &tag_id, const vector<string> &prefixes)
+        {
+            dash::tag::PrefixTag tag;
+            tag.set_ip_version(dash::types::IP_VERSION_IPV4);
+            for (const auto &prefix : prefixes)
+            {
+                IpPrefix ip_prefix(prefix);
+                auto pb_prefix = tag.add_prefix_list();
+                pb_prefix->mutable_ip()->set_ipv4(ip_prefix.getIp().getV4Addr());
+                pb_prefix->mutable_mask()->set_ipv4(ip_prefix.getMask().getV4Addr());
+            }
+            return KeyOpFieldsValuesTuple(tag_id, SET_COMMAND, { { "pb", tag.SerializeAsString() } });
+        }
+
+        KeyOpFieldsValuesTuple aclInTask(const string &stage, const string &group_id)
+        {
+            dash::acl_in::AclIn acl_in;
+            acl_in.set_v4_acl_group_id(group_id);
+            return KeyOpFieldsValuesTuple(eni1 + ":" + stage, SET_COMMAND, { { "pb", acl_in.SerializeAsString() } });
+        }
+
+        const DashAclGroup &getGroup(const string &group_id)
+        {
+            return m_dashAclOrch->getDashAclGroupMgr().m_groups_table.at(group_id);
+        }
+
+        // group1 with rule1 using tag1 and rule2 using no tag
+        void createTaggedGroup()
+        {
+            ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "1.1.1.0/24", "2.2.0.0/16" }) }), 0u);
+            ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+            ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+                ruleTask("group1:rule1", 1, dash::acl_rule::ACTION_PERMIT, { "tag1" }),
+                ruleTask("group1:rule2", 2)
+            }), 0u);
+            ASSERT_EQ(acl_rule_sips.at(getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id), 2u);
+            rule_bulks.clear();
+        }
+
+        // Binds group1 to the inbound stages of an ENI known to DashOrch
+        void bindTaggedGroup(const vector<string> &stages)
+        {
+            m_DashOrch->eni_entries_[eni1] = { 0x5000, BuildEniEntry() };
+
+            deque<KeyOpFieldsValuesTuple> entries;
+            for (const auto &stage : stages)
+            {
+                entries.push_back(aclInTask(stage, "group1"));
+            }
+            ASSERT_EQ(doAclTask(APP_DASH_ACL_IN_TABLE_NAME, entries), 0u);
+            ASSERT_TRUE(m_dashAclOrch->getDashAclGroupMgr().isBound("group1"));
+        }
+
+        void setRulePrefixSetSupported(bool supported)
+        {
+            m_dashAclOrch->getDashAclGroupMgr().m_rule_prefix_set_supported = supported;
+        }
+    };
+
+    TEST_F(DashAclOrchTest, RulesCreatedInOneBulk)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 1),
+            ruleTask("group1:rule2", 2),
+            ruleTask("group1:rule3", 3)
+        }), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 1u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("create"), 3u));
+        EXPECT_EQ(acl_rules.size(), 3u);
+        EXPECT_EQ(getGroup("group1").m_dash_acl_rule_table.size(), 3u);
+    }
+
+    TEST_F(DashAclOrchTest, RepeatedRuleKeySplitsBulk)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, { ruleTask("group1:rule1", 1) }), 0u);
+        auto old_rule_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+        rule_bulks.clear();
+
+        // The DEL and the SET of the rule are kept apart by the consumer
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleDelTask("group1:rule1"),
+            ruleTask("group1:rule1", 2),
+            ruleTask("group1:rule2", 3)
+        }), 0u);
+
+        // The second task of rule1 starts a new bulk, after the removal is flushed
+        ASSERT_EQ(rule_bulks.size(), 2u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("remove"), 1u));
+        EXPECT_EQ(rule_bulks[1], make_pair(string("create"), 2u));
+
+        const auto &rules = getGroup("group1").m_dash_acl_rule_table;
+        ASSERT_EQ(rules.size(), 2u);
+        EXPECT_NE(rules.at("rule1").m_dash_acl_rule_id, old_rule_id);
+        EXPECT_EQ(acl_rules.count(old_rule_id), 0u);
+        EXPECT_EQ(acl_rules.at(rules.at("rule1").m_dash_acl_rule_id), 2u);
+    }
+
+    TEST_F(DashAclOrchTest, RuleReplacedAfterCreate)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, { ruleTask("group1:rule1", 1) }), 0u);
+        auto old_rule_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+        rule_bulks.clear();
+
+        // The existing rule is removed once the new one is created
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, { ruleTask("group1:rule1", 2) }), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 2u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("create"), 1u));
+        EXPECT_EQ(rule_bulks[1], make_pair(string("remove"), 1u));
+
+        const auto &rules = getGroup("group1").m_dash_acl_rule_table;
+        ASSERT_EQ(rules.size(), 1u);
+        EXPECT_NE(rules.at("rule1").m_dash_acl_rule_id, old_rule_id);
+        EXPECT_EQ(acl_rules.count(old_rule_id), 0u);
+        EXPECT_EQ(acl_rules.at(rules.at("rule1").m_dash_acl_rule_id), 2u);
+    }
+
+    TEST_F(DashAclOrchTest, FailedReplaceKeepsRule)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 1),
+            ruleTask("group1:rule2", 2)
+        }), 0u);
+        auto old_rule_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+        rule_bulks.clear();
+
+        // rule2 fails, the new rule1 is rolled back and the old one stays programmed
+        failing_priorities.insert(4);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 3),
+            ruleTask("group1:rule2", 4)
+        }), 2u);
+
+        ASSERT_EQ(rule_bulks.size(), 2u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("create"), 2u));
+        EXPECT_EQ(rule_bulks[1], make_pair(string("remove"), 1u));
+        EXPECT_EQ(getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id, old_rule_id);
+        EXPECT_EQ(acl_rules.at(old_rule_id), 1u);
+        EXPECT_EQ(acl_rules.size(), 2u);
+
+        // Both rules are replaced on the retry
+        failing_priorities.clear();
+        rule_bulks.clear();
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 2u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("create"), 2u));
+        EXPECT_EQ(rule_bulks[1], make_pair(string("remove"), 2u));
+        const auto &rules = getGroup("group1").m_dash_acl_rule_table;
+        EXPECT_EQ(acl_rules.at(rules.at("rule1").m_dash_acl_rule_id), 3u);
+        EXPECT_EQ(acl_rules.at(rules.at("rule2").m_dash_acl_rule_id), 4u);
+        EXPECT_EQ(acl_rules.size(), 2u);
+    }
+
+    TEST_F(DashAclOrchTest, FailedRuleRollsBackItsGroupOnly)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1"), groupTask("group2") }), 0u);
+
+        // group2:rule2 fails, group2:rule1 created in the same bulk is removed again
+        failing_priorities.insert(4);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 1),
+            ruleTask("group1:rule2", 2),
+            ruleTask("group2:rule1", 3),
+            ruleTask("group2:rule2", 4)
+        }), 2u);
+
+        ASSERT_EQ(rule_bulks.size(), 2u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("create"), 4u));
+        EXPECT_EQ(rule_bulks[1], make_pair(string("remove"), 1u));
+        EXPECT_EQ(getGroup("group1").m_dash_acl_rule_table.size(), 2u);
+        EXPECT_TRUE(getGroup("group2").m_dash_acl_rule_table.empty());
+        EXPECT_EQ(acl_rules.size(), 2u);
+
+        // The rules of group2 are retried together
+        failing_priorities.clear();
+        rule_bulks.clear();
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 1u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("create"), 2u));
+        EXPECT_EQ(getGroup("group2").m_dash_acl_rule_table.size(), 2u);
+        EXPECT_EQ(acl_rules.size(), 4u);
+    }
+
+    TEST_F(DashAclOrchTest, NotExecutedRulesRetried)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1"), groupTask("group2") }), 0u);
+
+        // group1:rule1 fails, the bulk stops before the rules of group2
+        failing_priorities.insert(1);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 1),
+            ruleTask("group2:rule1", 2),
+            ruleTask("group2:rule2", 3)
+        }), 3u);
+        EXPECT_TRUE(acl_rules.empty());
+
+        failing_priorities.clear();
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME), 0u);
+        EXPECT_EQ(acl_rules.size(), 3u);
+    }
+
+    TEST_F(DashAclOrchTest, RuleRemoved)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 1),
+            ruleTask("group1:rule2", 2)
+        }), 0u);
+        rule_bulks.clear();
+
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, { ruleDelTask("group1:rule1") }), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 1u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("remove"), 1u));
+        const auto &rules = getGroup("group1").m_dash_acl_rule_table;
+        ASSERT_EQ(rules.size(), 1u);
+        EXPECT_EQ(rules.count("rule2"), 1u);
+        EXPECT_EQ(acl_rules.size(), 1u);
+
+        // Removing a rule that is gone is a no-op
+        rule_bulks.clear();
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, { ruleDelTask("group1:rule1") }), 0u);
+        EXPECT_TRUE(rule_bulks.empty());
+    }
+
+    TEST_F(DashAclOrchTest, GroupRemovalRemovesRulesInBulk)
+    {
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1") }), 0u);
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_RULE_TABLE_NAME, {
+            ruleTask("group1:rule1", 1),
+            ruleTask("group1:rule2", 2),
+            ruleTask("group1:rule3", 3)
+        }), 0u);
+        rule_bulks.clear();
+
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME, { groupTask("group1", DEL_COMMAND) }), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 1u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("remove"), 3u));
+        EXPECT_TRUE(acl_rules.empty());
+        EXPECT_TRUE(acl_groups.empty());
+        EXPECT_FALSE(m_dashAclOrch->getDashAclGroupMgr().exists("group1"));
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateWithoutDeltaIsNoop)
+    {
+        createTaggedGroup();
+        setRulePrefixSetSupported(true);
+        auto rule_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+
+        // The same prefixes in another order
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "2.2.0.0/16", "1.1.1.0/24" }) }), 0u);
+
+        EXPECT_TRUE(rule_bulks.empty());
+        EXPECT_EQ(rule_sets, 0u);
+        EXPECT_EQ(getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id, rule_id);
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateSetsRulePrefixesInPlace)
+    {
+        createTaggedGroup();
+        setRulePrefixSetSupported(true);
+        bindTaggedGroup({ "1" });
+        auto group_id = getGroup("group1").m_dash_acl_group_id;
+        auto rule_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "1.1.1.0/24", "2.2.0.0/16", "3.3.3.0/24" }) }), 0u);
+
+        // Only the source prefixes of the rule using the tag are set
+        EXPECT_TRUE(rule_bulks.empty());
+        EXPECT_EQ(rule_sets, 1u);
+        EXPECT_EQ(acl_rule_sips.at(rule_id), 3u);
+        EXPECT_EQ(getGroup("group1").m_dash_acl_group_id, group_id);
+        EXPECT_EQ(getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id, rule_id);
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateReplacesRulesOfUnboundGroup)
+    {
+        createTaggedGroup();
+        setRulePrefixSetSupported(false);
+        auto group_id = getGroup("group1").m_dash_acl_group_id;
+        auto rule1_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+        auto rule2_id = getGroup("group1").m_dash_acl_rule_table.at("rule2").m_dash_acl_rule_id;
+
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "1.1.1.0/24", "2.2.0.0/16", "3.3.3.0/24" }) }), 0u);
+
+        ASSERT_EQ(rule_bulks.size(), 2u);
+        EXPECT_EQ(rule_bulks[0], make_pair(string("remove"), 1u));
+        EXPECT_EQ(rule_bulks[1], make_pair(string("create"), 1u));
+
+        const auto &rules = getGroup("group1").m_dash_acl_rule_table;
+        EXPECT_EQ(getGroup("group1").m_dash_acl_group_id, group_id);
+        EXPECT_NE(rules.at("rule1").m_dash_acl_rule_id, rule1_id);
+        EXPECT_EQ(rules.at("rule2").m_dash_acl_rule_id, rule2_id);
+        EXPECT_EQ(acl_rule_sips.at(rules.at("rule1").m_dash_acl_rule_id), 3u);
+        EXPECT_EQ(acl_rules.size(), 2u);
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateSwapsBoundGroup)
+    {
+        createTaggedGroup();
+        setRulePrefixSetSupported(false);
+        bindTaggedGroup({ "1" });
+        auto group_id = getGroup("group1").m_dash_acl_group_id;
+        ASSERT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], group_id);
+
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "1.1.1.0/24", "2.2.0.0/16", "3.3.3.0/24" }) }), 0u);
+
+        // All the rules are created on a copy that takes the place of the group on the ENI
+        const auto &group = getGroup("group1");
+        EXPECT_NE(group.m_dash_acl_group_id, group_id);
+        EXPECT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], group.m_dash_acl_group_id);
+        EXPECT_EQ(acl_groups, set<sai_object_id_t>({ group.m_dash_acl_group_id }));
+        EXPECT_EQ(acl_rules.size(), 2u);
+        EXPECT_EQ(acl_rule_sips.at(group.m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id), 3u);
+        EXPECT_TRUE(m_dashAclOrch->getDashAclGroupMgr().isBound("group1"));
+        EXPECT_TRUE(m_dashAclOrch->getDashAclGroupMgr().m_outdated_groups.empty());
+    }
+
+    TEST_F(DashAclOrchTest, TagUpdateBindFailureKeepsBoundGroup)
+    {
+        createTaggedGroup();
+        setRulePrefixSetSupported(false);
+        bindTaggedGroup({ "1", "2" });
+        auto group_id = getGroup("group1").m_dash_acl_group_id;
+        auto rule1_id = getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id;
+
+        // The copy is bound to one stage and fails on the other one
+        eni_binds_before_failure = 1;
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "1.1.1.0/24", "2.2.0.0/16", "3.3.3.0/24" }) }), 1u);
+
+        EXPECT_EQ(getGroup("group1").m_dash_acl_group_id, group_id);
+        EXPECT_EQ(getGroup("group1").m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id, rule1_id);
+        EXPECT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], group_id);
+        EXPECT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE2_DASH_ACL_GROUP_ID], group_id);
+        EXPECT_EQ(acl_groups, set<sai_object_id_t>({ group_id }));
+        EXPECT_EQ(acl_rules.size(), 2u);
+
+        // The update of the group is retried along with the tag
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME), 0u);
+
+        const auto &group = getGroup("group1");
+        EXPECT_NE(group.m_dash_acl_group_id, group_id);
+        EXPECT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], group.m_dash_acl_group_id);
+        EXPECT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE2_DASH_ACL_GROUP_ID], group.m_dash_acl_group_id);
+        EXPECT_EQ(acl_groups, set<sai_object_id_t>({ group.m_dash_acl_group_id }));
+        EXPECT_EQ(acl_rule_sips.at(group.m_dash_acl_rule_table.at("rule1").m_dash_acl_rule_id), 3u);
+    }
+
+    TEST_F(DashAclOrchTest, OutdatedGroupRemovalRetried)
+    {
+        createTaggedGroup();
+        setRulePrefixSetSupported(false);
+        bindTaggedGroup({ "1" });
+        auto group_id = getGroup("group1").m_dash_acl_group_id;
+        auto &group_mgr = m_dashAclOrch->getDashAclGroupMgr();
+
+        // The update is done even though the previous group can't be removed yet
+        acl_groups_in_use = true;
+        ASSERT_EQ(doAclTask(APP_DASH_PREFIX_TAG_TABLE_NAME, { tagTask("tag1", { "1.1.1.0/24", "2.2.0.0/16", "3.3.3.0/24" }) }), 0u);
+
+        auto new_group_id = getGroup("group1").m_dash_acl_group_id;
+        EXPECT_NE(new_group_id, group_id);
+        EXPECT_EQ(eni_acl_stages[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], new_group_id);
+        ASSERT_EQ(group_mgr.m_outdated_groups.size(), 1u);
+        EXPECT_EQ(group_mgr.m_outdated_groups[0].m_dash_acl_group_id, group_id);
+        EXPECT_EQ(acl_groups, set<sai_object_id_t>({ group_id, new_group_id }));
+        EXPECT_EQ(acl_rules.size(), 2u);
+
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME), 0u);
+        EXPECT_EQ(group_mgr.m_outdated_groups.size(), 1u);
+
+        // The removal is retried with the next ACL tasks
+        acl_groups_in_use = false;
+        ASSERT_EQ(doAclTask(APP_DASH_ACL_GROUP_TABLE_NAME), 0u);
+        EXPECT_TRUE(group_mgr.m_outdated_groups.empty());
+        EXPECT_EQ(acl_groups, set<sai_object_id_t>({ new_group_id }));
+    }
+}
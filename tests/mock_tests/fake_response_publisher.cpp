@@ -9,7 +9,7 @@
 std::unique_ptr<MockResponsePublisher> gMockResponsePublisher;
 
 ResponsePublisher::ResponsePublisher(const std::string& dbName, bool buffered, bool db_write_thread) :
-    m_db(std::make_unique<swss::DBConnector>(dbName, 0)), m_buffered(buffered) {}
+    m_db_name(dbName), m_db(std::make_unique<swss::DBConnector>(dbName, 0)), m_buffered(buffered) {}
 
 ResponsePublisher::~ResponsePublisher() {}
 
@@ -44,3 +44,13 @@ void ResponsePublisher::writeToDB(
 void ResponsePublisher::flush() {}
 
 void ResponsePublisher::setBuffered(bool buffered) {}
+
+ResponsePublisher::Stats ResponsePublisher::getStats() const
+{
+    return Stats();
+}
+
+std::map<std::string, ResponsePublisher::Stats> ResponsePublisher::getTotalStats()
+{
+    return {};
+}
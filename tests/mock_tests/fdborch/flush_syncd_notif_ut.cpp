@@ -150,6 +150,7 @@ namespace fdb_syncd_flush_test
         m_portsOrch->m_portList[alias] = vlan;
         m_portsOrch->m_port_ref_count[alias] = 0;
         m_portsOrch->saiOidToAlias[oid] = alias;
+        m_portsOrch->m_vlanIdToAlias[40] = alias;
     }
 
     void setUpPort(PortsOrch* m_portsOrch){
@@ -261,6 +262,43 @@ namespace fdb_syncd_flush_test
         ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:7c:fe:90:12:22:ec", "type", entry_type), false);
     }
 
+    /* Test the port lookups FDB events go through */
+    TEST_F(FdbOrchTest, PortLookupsWithoutCopy)
+    {
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+
+        auto vlan = m_portsOrch->findVlanByVlanId(40);
+        ASSERT_NE(vlan, nullptr);
+        ASSERT_EQ(vlan, &m_portsOrch->m_portList[VLAN40]);
+        ASSERT_EQ(m_portsOrch->findPort(vlan->m_vlan_info.vlan_oid), vlan);
+        ASSERT_EQ(m_portsOrch->findVlanByVlanId(41), nullptr);
+
+        auto port = m_portsOrch->findPortByBridgePortId(m_portsOrch->m_portList[ETH0].m_bridge_port_id);
+        ASSERT_NE(port, nullptr);
+        ASSERT_EQ(port->m_alias, ETH0);
+        ASSERT_EQ(m_portsOrch->findPort(ETH0), port);
+        ASSERT_EQ(m_portsOrch->findPort("Ethernet4"), nullptr);
+
+        Port vlanCopy;
+        ASSERT_TRUE(m_portsOrch->getVlanByVlanId(40, vlanCopy));
+        ASSERT_EQ(vlanCopy.m_alias, VLAN40);
+
+        /* Learn and age a MAC, the counters are updated in place */
+        vector<uint8_t> mac_addr = {124, 254, 144, 18, 34, 236};
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac_addr, port->m_bridge_port_id,
+                      vlan->m_vlan_info.vlan_oid);
+        ASSERT_EQ(vlan->m_fdb_count, 1);
+        ASSERT_EQ(port->m_fdb_count, 1);
+
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_AGED, mac_addr, port->m_bridge_port_id,
+                      vlan->m_vlan_info.vlan_oid);
+        ASSERT_EQ(vlan->m_fdb_count, 0);
+        ASSERT_EQ(port->m_fdb_count, 0);
+    }
+
     /* Test Consolidated Flush All */
     TEST_F(FdbOrchTest, ConsolidatedFlushAll)
     {   
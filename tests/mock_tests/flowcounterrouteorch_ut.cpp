@@ -4,6 +4,9 @@
 #define protected public
 #include "orch.h"
 #undef protected
+#define private public
+#include "flowcounterrouteorch.h"
+#undef private
 #include "ut_helper.h"
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
@@ -374,6 +377,44 @@ namespace flowcounterrouteorch_test
 
     }
 
+    TEST_F(FlowcounterRouteOrchTest, PatternMaxMatchCountFollowsPrefixOrder)
+    {
+        // Routes nested at several depths under the pattern, the trie walks them in pre-order
+        set<IpPrefix> matched = { IpPrefix("1.1.1.1/32") };
+        Table routeTable = Table(m_app_db.get(), APP_ROUTE_TABLE_NAME);
+        for (const auto &prefix : { "1.1.0.0/17", "1.1.2.0/24", "1.1.1.128/25", "1.1.128.0/24", "1.1.0.0/24" })
+        {
+            routeTable.set(prefix, { {"ifname", "Ethernet0" },
+                                     {"nexthop", "10.0.0.2" }});
+            matched.insert(IpPrefix(prefix));
+        }
+        gRouteOrch->addExistingData(&routeTable);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        auto current_counter_num = num_created_counter;
+        entries.push_back({"1.1.0.0/16", "SET", { {"max_match_count", "3"}}});
+        auto consumer = dynamic_cast<Consumer *>(gFlowCounterRouteOrch->getExecutor(CFG_FLOW_COUNTER_ROUTE_PATTERN_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gFlowCounterRouteOrch)->doTask();
+        ASSERT_EQ(num_created_counter - current_counter_num, 3);
+
+        // The first max_match_count prefixes in IpPrefix order get the counters
+        set<IpPrefix> expected(matched.begin(), next(matched.begin(), 3));
+        set<IpPrefix> bound;
+        ASSERT_EQ(gFlowCounterRouteOrch->mBoundRouteCounters.size(), 1u);
+        for (const auto &entry : gFlowCounterRouteOrch->mBoundRouteCounters.begin()->second)
+        {
+            bound.insert(entry.first);
+        }
+        ASSERT_EQ(bound, expected);
+
+        entries.push_back({"1.1.0.0/16", "DEL", { {"max_match_count", "3"}}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gFlowCounterRouteOrch)->doTask();
+        ASSERT_EQ(num_created_counter, current_counter_num);
+    }
+
     TEST_F(FlowcounterRouteOrchTest, DelayAddVRF)
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
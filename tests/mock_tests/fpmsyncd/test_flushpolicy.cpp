@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "fpmsyncd/flushpolicy.h"
+
+using namespace swss;
+using namespace std::chrono;
+
+namespace flushpolicy_test
+{
+    class FlushPolicyTest : public ::testing::Test
+    {
+    protected:
+        FlushPolicy m_policy{100};
+        FlushPolicy::Clock::time_point m_now = FlushPolicy::Clock::now();
+    };
+
+    TEST_F(FlushPolicyTest, LoneUpdateIsFlushedImmediately)
+    {
+        EXPECT_FALSE(m_policy.shouldFlush(0, m_now));
+        EXPECT_EQ(m_policy.getTimeout(), FlushPolicy::INFINITE);
+
+        m_now += milliseconds(1000);
+        EXPECT_TRUE(m_policy.shouldFlush(1, m_now));
+        m_policy.onFlush(1, m_now, m_now);
+        EXPECT_EQ(m_policy.getTimeout(), FlushPolicy::INFINITE);
+    }
+
+    TEST_F(FlushPolicyTest, BatchesGrowUnderLoad)
+    {
+        size_t pending = 0;
+        size_t maxBatch = 0;
+        int flushes = 0;
+
+        m_policy.shouldFlush(0, m_now);
+
+        /* 1000 entries per millisecond, flushing costs 0.1 us per entry */
+        for (int i = 0; i < 2000; i++)
+        {
+            m_now += milliseconds(1);
+            pending += 1000;
+
+            if (m_policy.shouldFlush(pending, m_now))
+            {
+                auto start = m_now;
+                m_now += microseconds(pending / 10);
+                m_policy.onFlush(pending, start, m_now);
+                maxBatch = std::max(maxBatch, pending);
+                pending = 0;
+                flushes++;
+            }
+            else
+            {
+                EXPECT_GT(m_policy.getTimeout(), 0);
+                EXPECT_LE(m_policy.getTimeout(), m_policy.getLatencyTarget());
+            }
+        }
+
+        EXPECT_LT(flushes, 100);
+        EXPECT_GT(maxBatch, 10000u);
+
+        /* Once the load is gone a lone update is not held back by the old rate */
+        m_now += milliseconds(2000);
+        m_policy.shouldFlush(0, m_now);
+        m_now += milliseconds(3000);
+        EXPECT_TRUE(m_policy.shouldFlush(1, m_now));
+    }
+
+    TEST_F(FlushPolicyTest, SetLatencyTarget)
+    {
+        m_policy.setLatencyTarget(20);
+        EXPECT_EQ(m_policy.getLatencyTarget(), 20);
+
+        m_policy.shouldFlush(0, m_now);
+        m_now += milliseconds(1);
+        m_policy.shouldFlush(1000, m_now);
+        m_now += milliseconds(1);
+        if (!m_policy.shouldFlush(2000, m_now))
+        {
+            EXPECT_LE(m_policy.getTimeout(), 20);
+        }
+    }
+}
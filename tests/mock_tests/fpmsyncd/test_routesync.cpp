@@ -1024,6 +1024,139 @@ TEST_F(FpmSyncdResponseTest, TestGetNextHopWt)
     EXPECT_EQ(m_mockRouteSync.getNextHopWt(test_route.get()), "1,1");
 }
 
+static void addRtAttr(struct nlmsghdr *nlh, unsigned short type, const void *data, size_t len)
+{
+    struct rtattr *rta = (struct rtattr *)((char *)nlh + NLMSG_ALIGN(nlh->nlmsg_len));
+    rta->rta_type = type;
+    rta->rta_len = (unsigned short)RTA_LENGTH(len);
+    memcpy(RTA_DATA(rta), data, len);
+    nlh->nlmsg_len = NLMSG_ALIGN(nlh->nlmsg_len) + RTA_ALIGN(rta->rta_len);
+}
+
+static struct nlmsghdr *createRouteMsgHdr(uint16_t type, const char *dst, uint8_t dst_len)
+{
+    struct nlmsghdr *nlh = (struct nlmsghdr *)calloc(1, NLMSG_SPACE(MAX_PAYLOAD));
+    nlh->nlmsg_type = type;
+    nlh->nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+
+    struct rtmsg *rtm = (struct rtmsg *)NLMSG_DATA(nlh);
+    rtm->rtm_family = AF_INET;
+    rtm->rtm_dst_len = dst_len;
+    rtm->rtm_protocol = RTPROT_STATIC;
+    rtm->rtm_type = RTN_UNICAST;
+
+    struct in_addr addr;
+    inet_pton(AF_INET, dst, &addr);
+    addRtAttr(nlh, RTA_DST, &addr, sizeof(addr));
+    return nlh;
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteMsgFastPath)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<FieldValueTuple> fieldValues;
+
+    EXPECT_CALL(m_mockRouteSync, getIfName(_, _, _))
+        .WillRepeatedly([](int32_t if_index, char* ifname, size_t size) {
+            snprintf(ifname, size, "Ethernet%d", if_index);
+            return true;
+        });
+
+    // Multipath route, written on flush only
+    struct nlmsghdr *nlh = createRouteMsgHdr(RTM_NEWROUTE, "10.2.0.0", 16);
+    char mp[MAX_PAYLOAD] = {0};
+    size_t mp_len = 0;
+    const char *gateways[] = { test_gateway, test_gateway_ };
+    for (int i = 0; i < 2; i++)
+    {
+        struct rtnexthop *rtnh = (struct rtnexthop *)(mp + mp_len);
+        rtnh->rtnh_ifindex = i + 1;
+        rtnh->rtnh_hops = (unsigned char)(i * 2);
+        struct rtattr *rta = (struct rtattr *)RTNH_DATA(rtnh);
+        rta->rta_type = RTA_GATEWAY;
+        rta->rta_len = (unsigned short)RTA_LENGTH(sizeof(struct in_addr));
+        inet_pton(AF_INET, gateways[i], RTA_DATA(rta));
+        rtnh->rtnh_len = (unsigned short)(sizeof(*rtnh) + RTA_ALIGN(rta->rta_len));
+        mp_len += RTNH_ALIGN(rtnh->rtnh_len);
+    }
+    addRtAttr(nlh, RTA_MULTIPATH, mp, mp_len);
+
+    m_mockRouteSync.setRouteBatching(true);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgFast(nlh));
+    EXPECT_FALSE(route_table.get("10.2.0.0/16", fieldValues));
+    m_mockRouteSync.setRouteBatching(false);
+
+    ASSERT_TRUE(route_table.get("10.2.0.0/16", fieldValues));
+    map<string, string> fields;
+    for (const auto &fv : fieldValues)
+    {
+        fields[fvField(fv)] = fvValue(fv);
+    }
+    EXPECT_EQ(fields["protocol"], "static");
+    EXPECT_EQ(fields["nexthop"], "192.168.1.1,192.168.1.2");
+    EXPECT_EQ(fields["ifname"], "Ethernet1,Ethernet2");
+    EXPECT_EQ(fields["weight"], "1,2");
+    free(nlh);
+
+    // Host route with a single next hop
+    nlh = createRouteMsgHdr(RTM_NEWROUTE, "10.3.0.1", 32);
+    struct in_addr gw;
+    inet_pton(AF_INET, test_gateway__, &gw);
+    int oif = 3;
+    addRtAttr(nlh, RTA_GATEWAY, &gw, sizeof(gw));
+    addRtAttr(nlh, RTA_OIF, &oif, sizeof(oif));
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgFast(nlh));
+    ASSERT_TRUE(route_table.get("10.3.0.1", fieldValues));
+    free(nlh);
+
+    // Encapsulated next hops are left to the libnl path
+    nlh = createRouteMsgHdr(RTM_NEWROUTE, "10.4.0.0", 16);
+    uint16_t encap = 100; // VXLAN
+    addRtAttr(nlh, RTA_ENCAP_TYPE, &encap, sizeof(encap));
+    EXPECT_FALSE(m_mockRouteSync.onRouteMsgFast(nlh));
+    EXPECT_FALSE(route_table.get("10.4.0.0/16", fieldValues));
+    free(nlh);
+
+    // Delete
+    nlh = createRouteMsgHdr(RTM_DELROUTE, "10.2.0.0", 16);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgFast(nlh));
+    EXPECT_FALSE(route_table.get("10.2.0.0/16", fieldValues));
+    free(nlh);
+}
+
+TEST_F(FpmSyncdResponseTest, TestRouteMsgFastPathNoNextHop)
+{
+    Table route_table(m_db.get(), APP_ROUTE_TABLE_NAME);
+    vector<FieldValueTuple> fieldValues;
+
+    // Unicast route with neither gateway nor OIF
+    struct nlmsghdr *nlh = createRouteMsgHdr(RTM_NEWROUTE, "10.5.0.0", 16);
+    EXPECT_TRUE(m_mockRouteSync.onRouteMsgFast(nlh));
+    ASSERT_TRUE(route_table.get("10.5.0.0/16", fieldValues));
+    map<string, string> fast_fields;
+    for (const auto &fv : fieldValues)
+    {
+        fast_fields[fvField(fv)] = fvValue(fv);
+    }
+    EXPECT_EQ(fast_fields["nexthop"], "");
+    EXPECT_EQ(fast_fields["ifname"], "");
+    route_table.del("10.5.0.0/16");
+
+    // The libnl path writes the same entry for the same message
+    rtnl_route *route_obj = nullptr;
+    ASSERT_GE(rtnl_route_parse(nlh, &route_obj), 0);
+    m_mockRouteSync.onRouteMsg(RTM_NEWROUTE, (struct nl_object *)route_obj, nullptr);
+    ASSERT_TRUE(route_table.get("10.5.0.0/16", fieldValues));
+    map<string, string> libnl_fields;
+    for (const auto &fv : fieldValues)
+    {
+        libnl_fields[fvField(fv)] = fvValue(fv);
+    }
+    EXPECT_EQ(fast_fields, libnl_fields);
+    rtnl_route_put(route_obj);
+    free(nlh);
+}
+
 class WarmRestartRouteSyncTest : public ::testing::Test
 {
 public:
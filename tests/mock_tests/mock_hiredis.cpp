@@ -1,10 +1,17 @@
 #include <stdlib.h>
 #include <hiredis/hiredis.h>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
 
 // Add a global redisReply for user to mock
 redisReply *mockReply = nullptr;
 
+// Add a global list for user to record the formatted commands appended
+std::vector<std::string> *mockAppendedCommands = nullptr;
+std::mutex mockAppendedCommandsLock;
+
 int redisGetReply(redisContext *c, void **reply)
 {
     if (mockReply == nullptr)
@@ -21,6 +28,11 @@ int redisGetReply(redisContext *c, void **reply)
 
 int redisAppendFormattedCommand(redisContext *c, const char *cmd, size_t len)
 {
+    std::lock_guard<std::mutex> lock(mockAppendedCommandsLock);
+    if (mockAppendedCommands != nullptr)
+    {
+        mockAppendedCommands->emplace_back(cmd, len);
+    }
     return 0;
 }
 
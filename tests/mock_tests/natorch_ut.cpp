@@ -0,0 +1,257 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#define private public
+#include "natorch.h"
+#undef private
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+
+extern uint32_t natTimerTickCntr;
+extern sai_nat_api_t *sai_nat_api;
+
+namespace natorch_test
+{
+    using namespace std;
+
+    shared_ptr<swss::DBConnector> m_app_db;
+    shared_ptr<swss::DBConnector> m_state_db;
+    shared_ptr<swss::DBConnector> m_counters_db;
+
+    sai_nat_api_t ut_sai_nat_api;
+    sai_nat_api_t *pold_sai_nat_api;
+
+    sai_status_t bulk_query_status;
+    uint32_t bulk_query_count;
+    uint32_t single_query_count;
+    uint64_t packet_count;
+    // Tick each source IP was queried for its hit bit on
+    map<uint32_t, uint32_t> hit_bit_queried;
+
+    sai_status_t _ut_stub_get_nat_entry_attribute(
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        single_query_count++;
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            switch (attr_list[i].id)
+            {
+                case SAI_NAT_ENTRY_ATTR_PACKET_COUNT:
+                    attr_list[i].value.u64 = packet_count;
+                    break;
+                case SAI_NAT_ENTRY_ATTR_BYTE_COUNT:
+                    attr_list[i].value.u64 = packet_count * 100;
+                    break;
+                case SAI_NAT_ENTRY_ATTR_HIT_BIT:
+                    hit_bit_queried[nat_entry->data.key.src_ip] = natTimerTickCntr;
+                    attr_list[i].value.booldata = true;
+                    break;
+                default:
+                    break;
+            }
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_get_nat_entries_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_nat_entry_t *nat_entry,
+        _Inout_ uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        bulk_query_count++;
+        if (bulk_query_status != SAI_STATUS_SUCCESS)
+        {
+            return bulk_query_status;
+        }
+
+        // The single query stub is only counted for the fallback
+        auto single = single_query_count;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = _ut_stub_get_nat_entry_attribute(&nat_entry[i], attr_count[i], attr_list[i]);
+        }
+        single_query_count = single;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    struct NatOrchTest : public ::testing::Test
+    {
+        NatOrch *m_natOrch;
+
+        void SetUp() override
+        {
+            map<string, string> profile = {
+                { "SAI_VS_SWITCH_TYPE", "SAI_VS_SWITCH_TYPE_BCM56850" },
+                { "KV_DEVICE_MAC_ADDRESS", "20:03:04:05:06:00" }
+            };
+
+            ut_helper::initSaiApi(profile);
+
+            // The VS does not have the NAT API, the entries are only queried through the stubs
+            memset(&ut_sai_nat_api, 0, sizeof(ut_sai_nat_api));
+            ut_sai_nat_api.get_nat_entry_attribute = _ut_stub_get_nat_entry_attribute;
+            ut_sai_nat_api.get_nat_entries_attribute = _ut_stub_get_nat_entries_attribute;
+            pold_sai_nat_api = sai_nat_api;
+            sai_nat_api = &ut_sai_nat_api;
+
+            bulk_query_status = SAI_STATUS_SUCCESS;
+            bulk_query_count = 0;
+            single_query_count = 0;
+            packet_count = 1;
+            hit_bit_queried.clear();
+
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+
+            vector<table_name_with_pri_t> nat_tables = {
+                { APP_NAT_TABLE_NAME, 0 },
+                { APP_NAPT_TABLE_NAME, 0 }
+            };
+            m_natOrch = new NatOrch(m_app_db.get(), m_state_db.get(), nat_tables, nullptr, nullptr);
+        }
+
+        void TearDown() override
+        {
+            delete m_natOrch;
+            m_natOrch = nullptr;
+
+            natTimerTickCntr = 0;
+            sai_nat_api = pold_sai_nat_api;
+            ut_helper::uninitSaiApi();
+        }
+
+        void addSnatEntry(const string &ip)
+        {
+            NatEntryValue value;
+            value.translated_ip = IpAddress("192.168.0.1");
+            value.nat_type = "snat";
+            value.entry_type = "dynamic";
+            value.activeTime = 0;
+            value.ageOutTime = 0;
+            value.addedToHw = true;
+            m_natOrch->m_natEntries[IpAddress(ip)] = value;
+        }
+    };
+
+    TEST_F(NatOrchTest, QueryCountersInBulk)
+    {
+        for (int i = 1; i <= 3; i++)
+        {
+            addSnatEntry("10.0.0." + to_string(i));
+        }
+
+        m_natOrch->queryCounters();
+
+        ASSERT_EQ(bulk_query_count, 1u);
+        ASSERT_EQ(single_query_count, 0u);
+        ASSERT_TRUE(m_natOrch->m_natBulkQuerySupported);
+
+        Table countersTable(m_counters_db.get(), COUNTERS_NAT_TABLE);
+        string value;
+        ASSERT_TRUE(countersTable.hget("10.0.0.2", "NAT_TRANSLATIONS_PKTS", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(countersTable.hget("10.0.0.2", "NAT_TRANSLATIONS_BYTES", value));
+        ASSERT_EQ(value, "100");
+    }
+
+    TEST_F(NatOrchTest, QueryCountersBulkNotSupported)
+    {
+        for (int i = 1; i <= 3; i++)
+        {
+            addSnatEntry("10.0.0." + to_string(i));
+        }
+
+        // The entries are queried one by one from the first failed bulk query on
+        bulk_query_status = SAI_STATUS_NOT_SUPPORTED;
+        m_natOrch->queryCounters();
+
+        ASSERT_EQ(bulk_query_count, 1u);
+        ASSERT_EQ(single_query_count, 3u);
+        ASSERT_FALSE(m_natOrch->m_natBulkQuerySupported);
+
+        Table countersTable(m_counters_db.get(), COUNTERS_NAT_TABLE);
+        string value;
+        ASSERT_TRUE(countersTable.hget("10.0.0.3", "NAT_TRANSLATIONS_PKTS", value));
+        ASSERT_EQ(value, "1");
+
+        m_natOrch->queryCounters();
+
+        ASSERT_EQ(bulk_query_count, 1u);
+        ASSERT_EQ(single_query_count, 6u);
+    }
+
+    TEST_F(NatOrchTest, QueryCountersWritesChangedOnly)
+    {
+        addSnatEntry("10.0.0.1");
+
+        Table countersTable(m_counters_db.get(), COUNTERS_NAT_TABLE);
+        string value;
+
+        m_natOrch->queryCounters();
+        ASSERT_TRUE(countersTable.hget("10.0.0.1", "NAT_TRANSLATIONS_PKTS", value));
+        ASSERT_EQ(value, "1");
+
+        // Unchanged counters are not written again
+        countersTable.del("10.0.0.1");
+        m_natOrch->queryCounters();
+        ASSERT_FALSE(countersTable.hget("10.0.0.1", "NAT_TRANSLATIONS_PKTS", value));
+
+        packet_count = 2;
+        m_natOrch->queryCounters();
+        ASSERT_TRUE(countersTable.hget("10.0.0.1", "NAT_TRANSLATIONS_PKTS", value));
+        ASSERT_EQ(value, "2");
+
+        // Counters deleted from COUNTERS_DB by the orch are written again
+        m_natOrch->deleteNatCounters(IpAddress("10.0.0.1"));
+        m_natOrch->queryCounters();
+        ASSERT_TRUE(countersTable.hget("10.0.0.1", "NAT_TRANSLATIONS_PKTS", value));
+        ASSERT_EQ(value, "2");
+    }
+
+    TEST_F(NatOrchTest, QueryHitBitsStableSlices)
+    {
+        for (int i = 1; i <= 24; i++)
+        {
+            addSnatEntry("10.0.0." + to_string(i));
+        }
+
+        for (natTimerTickCntr = 0; natTimerTickCntr < NAT_HITBIT_QUERY_MULTIPLE; natTimerTickCntr++)
+        {
+            m_natOrch->queryHitBits();
+        }
+
+        // Each entry is queried once over NAT_HITBIT_QUERY_MULTIPLE ticks
+        ASSERT_EQ(hit_bit_queried.size(), 24u);
+        auto queried = hit_bit_queried;
+
+        // Entries added or removed do not move the others to another slice
+        for (int i = 1; i <= 24; i += 2)
+        {
+            m_natOrch->m_natEntries.erase(IpAddress("10.0.0." + to_string(i)));
+            addSnatEntry("10.0.1." + to_string(i));
+        }
+
+        hit_bit_queried.clear();
+        for (natTimerTickCntr = 0; natTimerTickCntr < NAT_HITBIT_QUERY_MULTIPLE; natTimerTickCntr++)
+        {
+            m_natOrch->queryHitBits();
+        }
+
+        ASSERT_EQ(hit_bit_queried.size(), 24u);
+        for (int i = 2; i <= 24; i += 2)
+        {
+            auto ip = IpAddress("10.0.0." + to_string(i)).getV4Addr();
+            ASSERT_EQ(hit_bit_queried[ip], queried[ip]);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "ut_helper.h"
+#include "nexthopgroupkey.h"
+
+namespace nexthopgroupkey_test
+{
+    using namespace std;
+
+    struct NextHopGroupKeyTest : public ::testing::Test
+    {
+        NextHopGroupKeyTest() {}
+    };
+
+    TEST_F(NextHopGroupKeyTest, InternedGroups)
+    {
+        NextHopGroupKey nhg1("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4");
+        NextHopGroupKey nhg2("10.0.0.2@Ethernet4,10.0.0.1@Ethernet0");
+        NextHopGroupKey nhg3("10.0.0.1@Ethernet0");
+        NextHopGroupKey empty;
+
+        /* Same next hop set shares the same id and hash */
+        ASSERT_EQ(nhg1, nhg2);
+        ASSERT_EQ(nhg1.getId(), nhg2.getId());
+        ASSERT_EQ(hash<NextHopGroupKey>()(nhg1), hash<NextHopGroupKey>()(nhg2));
+        ASSERT_NE(nhg1, nhg3);
+        ASSERT_NE(nhg1.getId(), nhg3.getId());
+        ASSERT_EQ(empty.getId(), 0u);
+
+        /* Weights are part of the group */
+        NextHopGroupKey weighted1(string("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4"), string("1,2"));
+        NextHopGroupKey weighted2(string("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4"), string("1,3"));
+        ASSERT_NE(weighted1, weighted2);
+        ASSERT_TRUE(weighted1 < weighted2);
+        ASSERT_FALSE(weighted2 < weighted1);
+
+        /* Updates move the key to the group of the new set */
+        nhg3.add("10.0.0.2@Ethernet4");
+        ASSERT_EQ(nhg3, nhg1);
+        ASSERT_EQ(nhg3.getId(), nhg1.getId());
+        nhg3.remove("10.0.0.2@Ethernet4");
+        ASSERT_EQ(nhg3.getSize(), 1u);
+        ASSERT_EQ(nhg3.to_string(), "10.0.0.1@Ethernet0");
+        nhg3.clear();
+        ASSERT_EQ(nhg3, empty);
+        ASSERT_EQ(nhg1.getSize(), 2u);
+    }
+
+    TEST_F(NextHopGroupKeyTest, BatchAdd)
+    {
+        NextHopGroupKey nhg1("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4,10.0.0.3@Ethernet8");
+        NextHopGroupKey nhg2("10.0.0.1@Ethernet0");
+        auto id = nhg2.getId();
+
+        /* An empty batch leaves the key alone */
+        nhg2.add(set<NextHopKey>());
+        ASSERT_EQ(nhg2.getId(), id);
+
+        /* The batch lands in the same group as a key built from the full set */
+        nhg2.add(set<NextHopKey>{ NextHopKey("10.0.0.2@Ethernet4"), NextHopKey("10.0.0.3@Ethernet8") });
+        ASSERT_EQ(nhg2, nhg1);
+        ASSERT_EQ(nhg2.getId(), nhg1.getId());
+        ASSERT_EQ(nhg2.getSize(), 3u);
+
+        /* Overlay flag of the key is kept */
+        NextHopGroupKey overlay("", true);
+        overlay.add(nhg1.getNextHops());
+        ASSERT_TRUE(overlay.is_overlay_nexthop());
+        ASSERT_EQ(overlay.getSize(), 3u);
+    }
+}
@@ -167,6 +167,111 @@ namespace orchdaemon_test
         orchd->disableRingBuffer();
     }
 
+    TEST_F(OrchDaemonTest, RingWorkerPoolLanes)
+    {
+        auto routeRing = std::make_shared<RingBuffer>();
+        RingWorkerPool pool(routeRing, 2);
+
+        pool.addLane({"FDB_TABLE"});
+        pool.addLane({"ACL_TABLE", "ACL_RULE"});
+        pool.addLane({"CRM"});
+
+        // route lane is always served by the route ring
+        EXPECT_EQ(pool.getRing("ROUTE_TABLE"), routeRing);
+        // lanes are spread over the worker rings
+        EXPECT_EQ(pool.getRing("ACL_TABLE"), pool.getRing("ACL_RULE"));
+        EXPECT_NE(pool.getRing("FDB_TABLE"), pool.getRing("ACL_TABLE"));
+        EXPECT_EQ(pool.getRing("FDB_TABLE"), pool.getRing("CRM"));
+        // executors which are not in any lane stay on the main thread
+        EXPECT_EQ(pool.getRing("OTHER_TABLE"), nullptr);
+
+        // a dependency keeps the executor in the lane it depends on
+        pool.addDependency("ACL_RULE", "ROUTE_TABLE");
+        EXPECT_EQ(pool.getRing("ACL_TABLE"), routeRing);
+        EXPECT_EQ(pool.getRing("ACL_RULE"), routeRing);
+        pool.addDependency("CRM", "OTHER_TABLE");
+        EXPECT_NE(pool.getRing("CRM"), routeRing);
+        EXPECT_NE(pool.getRing("CRM"), nullptr);
+
+        // executors of the route lane are served by the route ring, not by a worker
+        pool.addRouteLane({"ACL_TABLE_TYPE"});
+        EXPECT_EQ(pool.getRing("ACL_TABLE_TYPE"), routeRing);
+    }
+
+    TEST_F(OrchDaemonTest, LaneTaskWithoutWorkerPool)
+    {
+        orchd->enableRingBuffer();
+
+        auto gRingBuffer = orchd->gRingBuffer;
+
+        std::vector<std::string> tables = {"ROUTE_TABLE", "OTHER_TABLE"};
+        auto orch = make_shared<Orch>(&appl_db, tables);
+        auto route_consumer = dynamic_cast<Consumer *>(orch->getExecutor("ROUTE_TABLE"));
+        auto other_consumer = dynamic_cast<Consumer *>(orch->getExecutor("OTHER_TABLE"));
+
+        gRingBuffer->thread_created = true; // set the flag to assume the ring thread is created (actually not)
+
+        int x = 0;
+        route_consumer->processAnyTask([&](){x=1;});
+        EXPECT_FALSE(Executor::isRingIdle());
+
+        // timers and notifiers do not wait for the busy route ring without the worker pool
+        int y = 0;
+        other_consumer->processLaneTask([&](){y=1;});
+        EXPECT_EQ(y, 1);
+        EXPECT_EQ(x, 0);
+
+        AnyTask task;
+        gRingBuffer->pop(task);
+        task();
+        EXPECT_EQ(x, 1);
+
+        orchd->disableRingBuffer();
+    }
+
+    TEST_F(OrchDaemonTest, PushRingWorkerPool)
+    {
+        orchd->enableRingBuffer();
+        orchd->enableRingWorkerPool(1);
+
+        auto gRingBuffer = orchd->gRingBuffer;
+        auto worker = orchd->gRingWorkerPool->getWorkers().front();
+
+        std::vector<std::string> tables = {"ROUTE_TABLE", "CRM", "OTHER_TABLE"};
+        auto orch = make_shared<Orch>(&appl_db, tables);
+        auto route_consumer = dynamic_cast<Consumer *>(orch->getExecutor("ROUTE_TABLE"));
+        auto crm_consumer = dynamic_cast<Consumer *>(orch->getExecutor("CRM"));
+        auto other_consumer = dynamic_cast<Consumer *>(orch->getExecutor("OTHER_TABLE"));
+
+        EXPECT_TRUE(gRingBuffer->serves("ROUTE_TABLE"));
+        EXPECT_TRUE(worker->serves("CRM"));
+        EXPECT_FALSE(worker->serves("OTHER_TABLE"));
+
+        gRingBuffer->thread_created = true; // set the flag to assume the ring threads are created (actually not)
+        worker->thread_created = true;
+
+        int x = 0, y = 0;
+        route_consumer->processAnyTask([&](){x=1;});
+        crm_consumer->processAnyTask([&](){y=1;});
+        // verify the tasks are pushed to the ring of their lane
+        EXPECT_TRUE(!gRingBuffer->IsEmpty() && !worker->IsEmpty() && x==0 && y==0);
+        EXPECT_FALSE(Executor::isRingIdle());
+
+        AnyTask task;
+        gRingBuffer->pop(task);
+        task();
+        worker->pop(task);
+        task();
+        EXPECT_TRUE(Executor::isRingIdle() && x==1 && y==1);
+
+        // verify the task of an executor outside of the lanes runs in place once all rings are idle
+        other_consumer->processAnyTask([&](){x=2;});
+        EXPECT_EQ(x, 2);
+
+        orchd->disableRingBuffer();
+        EXPECT_TRUE(Executor::gRingWorkerPool == nullptr);
+    }
+
     TEST_F(OrchDaemonTest, TestRedisFlushFailure)
     {
         InSequence s;
@@ -0,0 +1,287 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#define private public
+#include "routeorch.h"
+#include "neighorch.h"
+#include "aclorch.h"
+#undef private
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "perf_harness.h"
+
+/*
+ * Orchagent benchmarks.
+ *
+ * The workloads go through the same orchs, mock tables and virtual switch
+ * as the unit tests. They are sized by PERF_SCALE, the base sizes being 1M
+ * routes, 100k neighbors and 10k ACL rules. Run e.g.
+ *
+ *   PERF_SCALE=1 PERF_REPORT=perf.json ./tests_perf
+ *
+ * and compare perf.json between builds.
+ */
+namespace perf_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    // Default consumer table pop batch size of orchagent
+    static const size_t BATCH_SIZE = 128;
+
+    static const vector<string> PERF_PORTS = { ETHERNET0, ETHERNET4, ETHERNET8 };
+    // Each port has the router interface 10.<port index>.0.1/16
+    static const vector<string> PERF_NEXTHOPS = { "10.0.0.2", "10.1.0.2", "10.2.0.2" };
+
+    static string ipv4(uint32_t addr)
+    {
+        return to_string(addr >> 24) + "." + to_string((addr >> 16) & 0xff) + "." +
+               to_string((addr >> 8) & 0xff) + "." + to_string(addr & 0xff);
+    }
+
+    static string mac(uint32_t index)
+    {
+        char buf[18];
+        snprintf(buf, sizeof(buf), "02:00:%02x:%02x:%02x:%02x",
+                 (index >> 24) & 0xff, (index >> 16) & 0xff, (index >> 8) & 0xff, index & 0xff);
+        return buf;
+    }
+
+    class OrchagentPerfTest : public MockOrchTest
+    {
+    protected:
+        // Feed entries to an orch consumer in batches, timing every doTask()
+        void drive(Orch *orch, const string &table, deque<KeyOpFieldsValuesTuple> &entries, PerfRecorder *recorder)
+        {
+            auto consumer = dynamic_cast<Consumer *>(orch->getExecutor(table));
+            ASSERT_NE(consumer, nullptr);
+
+            while (!entries.empty())
+            {
+                size_t count = min(entries.size(), BATCH_SIZE);
+                deque<KeyOpFieldsValuesTuple> batch(entries.begin(), entries.begin() + static_cast<ptrdiff_t>(count));
+                entries.erase(entries.begin(), entries.begin() + static_cast<ptrdiff_t>(count));
+
+                auto task = [&]() {
+                    consumer->addToSync(batch);
+                    static_cast<Orch *>(orch)->doTask();
+                };
+
+                if (recorder)
+                {
+                    recorder->run(count, task);
+                }
+                else
+                {
+                    task();
+                }
+            }
+        }
+
+        void addNeighbors(size_t count, uint32_t firstHost, const string &op)
+        {
+            deque<KeyOpFieldsValuesTuple> entries;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                size_t port = i % PERF_PORTS.size();
+                uint32_t addr = (10u << 24) | (uint32_t(port) << 16) | (firstHost + i / uint32_t(PERF_PORTS.size()));
+                entries.push_back({ PERF_PORTS[port] + ":" + ipv4(addr), op,
+                                    { { "neigh", mac(i) }, { "family", "IPv4" } } });
+            }
+            drive(gNeighOrch, APP_NEIGH_TABLE_NAME, entries, nullptr);
+        }
+
+        void ApplyInitialConfigs() override
+        {
+            Table port_table = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+            Table intf_table = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
+
+            auto ports = ut_helper::getInitialSaiPorts();
+            for (const auto &port : PERF_PORTS)
+            {
+                port_table.set(port, ports[port]);
+            }
+            port_table.set("PortConfigDone", { { "count", to_string(PERF_PORTS.size()) } });
+            port_table.set("PortInitDone", { {} });
+
+            for (size_t i = 0; i < PERF_PORTS.size(); i++)
+            {
+                intf_table.set(PERF_PORTS[i], { { "NULL", "NULL" } });
+                intf_table.set(PERF_PORTS[i] + intf_table.getTableNameSeparator() + "10." + to_string(i) + ".0.1/16",
+                               { { "scope", "global" }, { "family", "IPv4" } });
+            }
+
+            gPortsOrch->addExistingData(&port_table);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            gIntfsOrch->addExistingData(&intf_table);
+            static_cast<Orch *>(gIntfsOrch)->doTask();
+        }
+    };
+
+    TEST_F(OrchagentPerfTest, RouteAddDel)
+    {
+        addNeighbors(PERF_NEXTHOPS.size(), 2, SET_COMMAND);
+
+        size_t count = scaled(1000000);
+        PerfRecorder add("route_add");
+        PerfRecorder del("route_del");
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            size_t nh = i % PERF_NEXTHOPS.size();
+            entries.push_back({ ipv4((20u << 24) + (i << 8)) + "/24", SET_COMMAND,
+                                { { "nexthop", PERF_NEXTHOPS[nh] }, { "ifname", PERF_PORTS[nh] } } });
+        }
+        drive(gRouteOrch, APP_ROUTE_TABLE_NAME, entries, &add);
+        ASSERT_GE(gRouteOrch->m_syncdRoutes[gVirtualRouterId].size(), count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ ipv4((20u << 24) + (i << 8)) + "/24", DEL_COMMAND, {} });
+        }
+        drive(gRouteOrch, APP_ROUTE_TABLE_NAME, entries, &del);
+        ASSERT_LT(gRouteOrch->m_syncdRoutes[gVirtualRouterId].size(), count);
+
+        add.report();
+        del.report();
+    }
+
+    TEST_F(OrchagentPerfTest, EcmpGroupChurn)
+    {
+        addNeighbors(PERF_NEXTHOPS.size(), 2, SET_COMMAND);
+
+        // Every multi path subset of the next hops
+        vector<pair<string, string>> groups;
+        for (uint32_t mask = 1; mask < (1u << PERF_NEXTHOPS.size()); mask++)
+        {
+            if (__builtin_popcount(mask) < 2)
+            {
+                continue;
+            }
+
+            string nexthops, ifnames;
+            for (size_t i = 0; i < PERF_NEXTHOPS.size(); i++)
+            {
+                if (mask & (1u << i))
+                {
+                    nexthops += (nexthops.empty() ? "" : ",") + PERF_NEXTHOPS[i];
+                    ifnames += (ifnames.empty() ? "" : ",") + PERF_PORTS[i];
+                }
+            }
+            groups.emplace_back(nexthops, ifnames);
+        }
+
+        size_t count = scaled(100000);
+        PerfRecorder churn("ecmp_churn");
+
+        for (size_t round = 0; round < groups.size() * 2; round++)
+        {
+            deque<KeyOpFieldsValuesTuple> entries;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                const auto &group = groups[(i + round) % groups.size()];
+                entries.push_back({ ipv4((30u << 24) + (i << 8)) + "/24", SET_COMMAND,
+                                    { { "nexthop", group.first }, { "ifname", group.second } } });
+            }
+            drive(gRouteOrch, APP_ROUTE_TABLE_NAME, entries, &churn);
+        }
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups.size(), min(groups.size(), count));
+
+        churn.report();
+    }
+
+    TEST_F(OrchagentPerfTest, NeighborAddDel)
+    {
+        size_t count = scaled(100000);
+        PerfRecorder add("neigh_add");
+        PerfRecorder del("neigh_del");
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            size_t port = i % PERF_PORTS.size();
+            uint32_t addr = (10u << 24) | (uint32_t(port) << 16) | (256 + i / uint32_t(PERF_PORTS.size()));
+            entries.push_back({ PERF_PORTS[port] + ":" + ipv4(addr), SET_COMMAND,
+                                { { "neigh", mac(i) }, { "family", "IPv4" } } });
+        }
+        auto dels = entries;
+        drive(gNeighOrch, APP_NEIGH_TABLE_NAME, entries, &add);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.size(), count);
+
+        for (auto &entry : dels)
+        {
+            kfvOp(entry) = DEL_COMMAND;
+            kfvFieldsValues(entry).clear();
+        }
+        drive(gNeighOrch, APP_NEIGH_TABLE_NAME, dels, &del);
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.size(), 0u);
+
+        add.report();
+        del.report();
+    }
+
+    TEST_F(OrchagentPerfTest, AclRuleAddDel)
+    {
+        const string table = "PERF_L3";
+        deque<KeyOpFieldsValuesTuple> entries = {
+            { table, SET_COMMAND, { { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                                    { ACL_TABLE_STAGE, STAGE_INGRESS },
+                                    { ACL_TABLE_PORTS, ETHERNET0 + "," + ETHERNET4 } } }
+        };
+        drive(gAclOrch, CFG_ACL_TABLE_TABLE_NAME, entries, nullptr);
+        ASSERT_NE(gAclOrch->getTableById(table), SAI_NULL_OBJECT_ID);
+
+        size_t count = scaled(10000);
+        PerfRecorder add("acl_rule_add");
+        PerfRecorder del("acl_rule_del");
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ table + "|RULE_" + to_string(i), SET_COMMAND,
+                                { { RULE_PRIORITY, to_string(1000 + i % 8000) },
+                                  { MATCH_SRC_IP, ipv4((40u << 24) + i) + "/32" },
+                                  { ACTION_PACKET_ACTION, PACKET_ACTION_DROP } } });
+        }
+        drive(gAclOrch, CFG_ACL_RULE_TABLE_NAME, entries, &add);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entries.push_back({ table + "|RULE_" + to_string(i), DEL_COMMAND, {} });
+        }
+        drive(gAclOrch, CFG_ACL_RULE_TABLE_NAME, entries, &del);
+
+        add.report();
+        del.report();
+    }
+
+    TEST_F(OrchagentPerfTest, PortFlap)
+    {
+        size_t count = scaled(10000);
+        PerfRecorder flap("port_flap");
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto &port = PERF_PORTS[i % PERF_PORTS.size()];
+            auto fvs = ports[port];
+            fvs.emplace_back("admin_status", (i / PERF_PORTS.size()) % 2 ? "up" : "down");
+            entries.push_back({ port, SET_COMMAND, fvs });
+
+            // One flap of every port per batch, a real flap is not coalesced with the next one
+            if (entries.size() == PERF_PORTS.size())
+            {
+                drive(gPortsOrch, APP_PORT_TABLE_NAME, entries, &flap);
+            }
+        }
+        drive(gPortsOrch, APP_PORT_TABLE_NAME, entries, &flap);
+
+        flap.report();
+    }
+}
@@ -0,0 +1,157 @@
+#include "perf_harness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+static std::atomic<uint64_t> gAllocations(0);
+
+/* Count the heap allocations of the benchmark binary only */
+void *operator new(size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = malloc(size ? size : 1);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+namespace perf_test
+{
+    using namespace std;
+
+    static const double DEFAULT_SCALE = 0.1;
+
+    uint64_t allocationCount()
+    {
+        return gAllocations.load(memory_order_relaxed);
+    }
+
+    size_t scaled(size_t count)
+    {
+        static double scale = []() {
+            const char *env = getenv("PERF_SCALE");
+            double value = env ? atof(env) : DEFAULT_SCALE;
+            return value > 0 ? value : DEFAULT_SCALE;
+        }();
+
+        return max(static_cast<size_t>(static_cast<double>(count) * scale), size_t(1));
+    }
+
+    PerfRecorder::PerfRecorder(const string &name) :
+        m_name(name)
+    {
+    }
+
+    void PerfRecorder::run(size_t ops, const function<void()> &batch)
+    {
+        auto allocations = allocationCount();
+        auto start = Clock::now();
+
+        batch();
+
+        auto elapsed = Clock::now() - start;
+        m_allocations += allocationCount() - allocations;
+        m_elapsed += elapsed;
+        m_ops += ops;
+        m_latencies.emplace_back(chrono::duration<double, micro>(elapsed).count(), ops);
+    }
+
+    double PerfRecorder::opsPerSec() const
+    {
+        double seconds = chrono::duration<double>(m_elapsed).count();
+        return seconds > 0 ? static_cast<double>(m_ops) / seconds : 0;
+    }
+
+    double PerfRecorder::allocationsPerOp() const
+    {
+        return m_ops ? static_cast<double>(m_allocations) / static_cast<double>(m_ops) : 0;
+    }
+
+    double PerfRecorder::latencyUs(double pct) const
+    {
+        if (m_latencies.empty())
+        {
+            return 0;
+        }
+
+        auto sorted = m_latencies;
+        sort(sorted.begin(), sorted.end());
+
+        double rank = pct * static_cast<double>(m_ops);
+        double seen = 0;
+        for (const auto &sample : sorted)
+        {
+            seen += static_cast<double>(sample.second);
+            if (seen >= rank)
+            {
+                return sample.first;
+            }
+        }
+
+        return sorted.back().first;
+    }
+
+    void PerfRecorder::report() const
+    {
+        cout << left << setw(24) << m_name << right
+             << fixed << setprecision(1)
+             << setw(12) << m_ops << " ops"
+             << setw(14) << opsPerSec() << " ops/s"
+             << setw(10) << allocationsPerOp() << " allocs/op"
+             << setw(12) << latencyUs(0.5) << " us p50"
+             << setw(12) << latencyUs(0.99) << " us p99"
+             << setw(12) << latencyUs(1.0) << " us max" << endl;
+
+        const char *path = getenv("PERF_REPORT");
+        if (!path)
+        {
+            return;
+        }
+
+        ostringstream json;
+        json << fixed << setprecision(3)
+             << "{\"name\":\"" << m_name << "\""
+             << ",\"ops\":" << m_ops
+             << ",\"ops_per_sec\":" << opsPerSec()
+             << ",\"allocs_per_op\":" << allocationsPerOp()
+             << ",\"p50_us\":" << latencyUs(0.5)
+             << ",\"p99_us\":" << latencyUs(0.99)
+             << ",\"max_us\":" << latencyUs(1.0) << "}";
+
+        ofstream out(path, ios::app);
+        out << json.str() << endl;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace perf_test
+{
+    /*
+     * Measures one benchmark workload.
+     *
+     * A workload is driven through an orch in batches, the way the consumer
+     * tables hand entries to doTask(). Every entry of a batch is done when the
+     * batch is, so the batch duration is the latency of each of its entries.
+     * The report gives the throughput, the heap allocations per entry and the
+     * p50/p99/max entry latency. It is printed and, if PERF_REPORT names a
+     * file, appended to it as one JSON object per line so that runs of two
+     * builds can be compared.
+     */
+    class PerfRecorder
+    {
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        PerfRecorder(const std::string &name);
+
+        // Time a batch of ops entries
+        void run(size_t ops, const std::function<void()> &batch);
+
+        void report() const;
+
+        uint64_t ops() const
+        {
+            return m_ops;
+        }
+
+        double opsPerSec() const;
+        double allocationsPerOp() const;
+        // Entry latency at the given percentile, in microseconds
+        double latencyUs(double pct) const;
+
+    private:
+        std::string m_name;
+        uint64_t m_ops = 0;
+        uint64_t m_allocations = 0;
+        Clock::duration m_elapsed = Clock::duration::zero();
+        // One sample per batch, weighted by the batch size
+        std::vector<std::pair<double, size_t>> m_latencies;
+    };
+
+    // Heap allocations made by the process so far
+    uint64_t allocationCount();
+
+    // Workload size scaled by PERF_SCALE (default 0.1), at least 1
+    size_t scaled(size_t count);
+}
@@ -62,6 +62,16 @@ struct Portal
         {
             crmOrch->getResAvailableCounters();
         }
+
+        static void handleSetCommand(CrmOrch *crmOrch, const std::string &key, const std::vector<swss::FieldValueTuple> &data)
+        {
+            crmOrch->handleSetCommand(key, data);
+        }
+
+        static void poll(CrmOrch *crmOrch)
+        {
+            crmOrch->doTask(*crmOrch->m_timer);
+        }
     };
 
     struct CoppOrchInternal
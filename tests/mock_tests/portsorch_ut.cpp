@@ -86,6 +86,27 @@ namespace portsorch_test
         return status;
     }
 
+    /* Bulk queries go through the same stubs as the single port ones */
+    sai_status_t _ut_stub_sai_get_ports_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _Inout_ uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = _ut_stub_sai_get_port_attribute(object_id[i], attr_count[i], attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
     uint32_t _sai_set_pfc_mode_count;
     uint32_t _sai_set_admin_state_up_count;
     uint32_t _sai_set_admin_state_down_count;
@@ -261,6 +282,7 @@ namespace portsorch_test
         ut_sai_port_api = *sai_port_api;
         pold_sai_port_api = sai_port_api;
         ut_sai_port_api.get_port_attribute = _ut_stub_sai_get_port_attribute;
+        ut_sai_port_api.get_ports_attribute = _ut_stub_sai_get_ports_attribute;
         ut_sai_port_api.set_port_attribute = _ut_stub_sai_set_port_attribute;
         sai_port_api = &ut_sai_port_api;
     }
@@ -1453,6 +1475,8 @@ namespace portsorch_test
         sai_queue_type_t type;
         uint8_t index;
         auto queue_id = port.m_queue_ids[0];
+        // Drop what the bulk query at port init may have cached
+        gPortsOrch->m_queueInfo.erase(queue_id);
         auto ut_sai_get_queue_attr_count = _sai_get_queue_attr_count;
         gPortsOrch->getQueueTypeAndIndex(queue_id, type, index);
         ASSERT_EQ(type, SAI_QUEUE_TYPE_UNICAST);
@@ -2402,6 +2426,51 @@ namespace portsorch_test
         _unhook_sai_port_api();
     }
 
+    /*
+     * Test case: supported FEC modes of all the ports are fetched with one bulk query
+     **/
+    TEST_F(PortsOrchTest, PortSupportedFecModesBulk)
+    {
+        _hook_sai_port_api();
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table statePortTable = Table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+
+        not_support_fetching_fec = false;
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration :
+        //  create ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+
+            const auto &fecModes = gPortsOrch->m_portSupportedFecModes.at(port.m_port_id);
+            ASSERT_TRUE(fecModes.supported);
+            ASSERT_EQ(fecModes.data, PortSupportedFecModes(mock_port_fec_modes.begin(), mock_port_fec_modes.end()));
+
+            string value;
+            ASSERT_TRUE(statePortTable.hget(it.first, "supported_fecs", value));
+            ASSERT_EQ(value.find("rs,fc"), 0);
+        }
+
+        _unhook_sai_port_api();
+    }
+
     /*
      * Test case: SAI_PORT_ATTR_SUPPORTED_FEC_MODE is not supported by vendor
      **/
@@ -0,0 +1,93 @@
+#include "ut_helper.h"
+#include "prefixtrie.h"
+
+namespace prefixtrie_test
+{
+    using namespace std;
+
+    struct PrefixTrieTest : public ::testing::Test
+    {
+        PrefixTrieTest() {}
+    };
+
+    TEST_F(PrefixTrieTest, FindEraseAndIterate)
+    {
+        PrefixTrie<int> trie;
+
+        trie[IpPrefix("0.0.0.0/0")] = 0;
+        trie[IpPrefix("10.0.0.0/8")] = 8;
+        trie[IpPrefix("10.1.0.0/16")] = 16;
+        trie[IpPrefix("10.2.0.0/16")] = 17;
+        trie[IpPrefix("::/0")] = 100;
+        ASSERT_EQ(trie.size(), 5u);
+
+        ASSERT_FALSE(trie.emplace(IpPrefix("10.0.0.0/8"), 9).second);
+        ASSERT_EQ(trie.at(IpPrefix("10.0.0.0/8")), 8);
+        ASSERT_EQ(trie.find(IpPrefix("10.0.0.0/9")), trie.end());
+        ASSERT_EQ(trie.find(IpPrefix("10.1.0.0/24")), trie.end());
+
+        /* IPv4 first, a prefix before the prefixes it covers */
+        vector<string> keys;
+        for (const auto &entry : trie)
+        {
+            keys.push_back(entry.first.to_string());
+        }
+        ASSERT_EQ(keys, vector<string>({ "0.0.0.0/0", "10.0.0.0/8", "10.1.0.0/16", "10.2.0.0/16", "::/0" }));
+
+        /* Removing an intermediate prefix keeps the ones below it */
+        ASSERT_EQ(trie.erase(IpPrefix("10.0.0.0/8")), 1u);
+        ASSERT_EQ(trie.erase(IpPrefix("10.0.0.0/8")), 0u);
+        ASSERT_EQ(trie.size(), 4u);
+        ASSERT_EQ(trie.at(IpPrefix("10.2.0.0/16")), 17);
+
+        for (auto it = trie.begin(); it != trie.end();)
+        {
+            it = trie.erase(it);
+        }
+        ASSERT_TRUE(trie.empty());
+    }
+
+    TEST_F(PrefixTrieTest, CoveringAndCovered)
+    {
+        PrefixTrie<int> trie;
+
+        trie[IpPrefix("0.0.0.0/0")] = 0;
+        trie[IpPrefix("10.0.0.0/8")] = 8;
+        trie[IpPrefix("10.1.1.0/24")] = 24;
+        trie[IpPrefix("10.1.1.1/32")] = 32;
+        trie[IpPrefix("10.1.2.0/24")] = 25;
+        trie[IpPrefix("2001:db8::/32")] = 132;
+
+        ASSERT_EQ(trie.lookup(IpAddress("10.1.1.1"))->second, 32);
+        ASSERT_EQ(trie.lookup(IpAddress("10.1.1.2"))->second, 24);
+        ASSERT_EQ(trie.lookup(IpAddress("11.0.0.1"))->second, 0);
+        ASSERT_EQ(trie.lookup(IpAddress("2001:db8::1"))->second, 132);
+        ASSERT_EQ(trie.lookup(IpAddress("2001:db9::1")), trie.end());
+
+        vector<int> covering;
+        trie.forEachCovering(IpAddress("10.1.1.1"), [&](const PrefixTrie<int>::value_type &entry) {
+            covering.push_back(entry.second);
+        });
+        ASSERT_EQ(covering, vector<int>({ 0, 8, 24, 32 }));
+
+        vector<int> covered;
+        trie.forEachCovered(IpPrefix("10.1.0.0/16"), [&](const PrefixTrie<int>::value_type &entry) {
+            covered.push_back(entry.second);
+        });
+        ASSERT_EQ(covered, vector<int>({ 24, 32, 25 }));
+    }
+
+    TEST_F(PrefixTrieTest, HostBitsSet)
+    {
+        PrefixTrie<int> trie;
+
+        trie[IpPrefix("10.0.0.0/24")] = 24;
+
+        /* Another spelling of a subnet is not the same key */
+        ASSERT_THROW(trie.emplace(IpPrefix("10.0.0.1/24"), 25), invalid_argument);
+        ASSERT_EQ(trie.find(IpPrefix("10.0.0.1/24")), trie.end());
+        ASSERT_EQ(trie.erase(IpPrefix("10.0.0.1/24")), 0u);
+        ASSERT_EQ(trie.at(IpPrefix("10.0.0.0/24")), 24);
+        ASSERT_EQ(trie.size(), 1u);
+    }
+}
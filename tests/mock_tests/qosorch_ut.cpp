@@ -773,6 +773,56 @@ namespace qosorch_test
         CheckDependency(CFG_QUEUE_TABLE_NAME, "Ethernet0|3", "wred_profile", CFG_WRED_PROFILE_TABLE_NAME, "AZURE_LOSSLESS");
     }
 
+    TEST_F(QosOrchTest, QosOrchTestQueueReapplySameReference)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        Table queueTable = Table(m_config_db.get(), CFG_QUEUE_TABLE_NAME);
+        auto queueConsumer = dynamic_cast<Consumer *>(gQosOrch->getExecutor(CFG_QUEUE_TABLE_NAME));
+
+        queueTable.set("Ethernet0|3",
+                       {
+                           {"scheduler", "scheduler.1"},
+                           {"wred_profile", "AZURE_LOSSLESS"}
+                       });
+        gQosOrch->addExistingData(&queueTable);
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        // Apply the same references again
+        entries.push_back({"Ethernet0|3", "SET",
+                           {
+                               {"scheduler", "scheduler.1"},
+                               {"wred_profile", "AZURE_LOSSLESS"}
+                           }});
+        queueConsumer->addToSync(entries);
+        entries.clear();
+        static_cast<Orch *>(gQosOrch)->doTask();
+
+        // Make sure the dependencies are kept
+        CheckDependency(CFG_QUEUE_TABLE_NAME, "Ethernet0|3", "scheduler", CFG_SCHEDULER_TABLE_NAME, "scheduler.1");
+        CheckDependency(CFG_QUEUE_TABLE_NAME, "Ethernet0|3", "wred_profile", CFG_WRED_PROFILE_TABLE_NAME, "AZURE_LOSSLESS");
+
+        // The scheduler is still referenced and can't be removed
+        RemoveItem(CFG_SCHEDULER_TABLE_NAME, "scheduler.1");
+        auto current_sai_remove_scheduler_count = sai_remove_scheduler_count;
+        static_cast<Orch *>(gQosOrch)->doTask();
+        ASSERT_EQ(current_sai_remove_scheduler_count, sai_remove_scheduler_count);
+
+        // Dropping the reference releases it
+        entries.push_back({"Ethernet0|3", "SET",
+                           {
+                               {"wred_profile", "AZURE_LOSSLESS"}
+                           }});
+        queueConsumer->addToSync(entries);
+        entries.clear();
+        // Drain QUEUE table
+        static_cast<Orch *>(gQosOrch)->doTask();
+        // Drain SCHEDULER table
+        static_cast<Orch *>(gQosOrch)->doTask();
+        CheckDependency(CFG_QUEUE_TABLE_NAME, "Ethernet0|3", "scheduler", CFG_SCHEDULER_TABLE_NAME);
+        ASSERT_EQ(current_sai_remove_scheduler_count + 1, sai_remove_scheduler_count);
+        CheckDependency(CFG_QUEUE_TABLE_NAME, "Ethernet0|3", "wred_profile", CFG_WRED_PROFILE_TABLE_NAME, "AZURE_LOSSLESS");
+    }
+
     TEST_F(QosOrchTest, QosOrchTestQueueReplaceFieldAndRemoveObject)
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
@@ -1,9 +1,20 @@
-#include "response_publisher.h"
-
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define private public
+#include "response_publisher.h"
+#undef private
+
 using namespace swss;
 
+extern std::vector<std::string> *mockAppendedCommands;
+extern std::mutex mockAppendedCommandsLock;
+
 TEST(ResponsePublisher, TestPublish)
 {
     DBConnector conn{"APPL_STATE_DB", 0};
@@ -30,3 +41,199 @@ TEST(ResponsePublisher, TestPublishBuffered)
     ASSERT_TRUE(stateTable.hget("SOME_KEY", "field", value));
     ASSERT_EQ(value, "value");
 }
+
+TEST(ResponsePublisher, TestWriteNullAttributes)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "SOME_TABLE"};
+    std::string value;
+    ResponsePublisher publisher{"APPL_STATE_DB"};
+
+    // A SET without attributes creates the entry with a NULL attribute.
+    publisher.writeToDB("SOME_TABLE", "NEW_KEY", {}, SET_COMMAND);
+    ASSERT_TRUE(stateTable.hget("NEW_KEY", "NULL", value));
+
+    // But does not add it to an existing entry.
+    publisher.writeToDB("SOME_TABLE", "OLD_KEY", {{"field", "value"}}, SET_COMMAND);
+    publisher.writeToDB("SOME_TABLE", "OLD_KEY", {}, SET_COMMAND);
+    ASSERT_TRUE(stateTable.hget("OLD_KEY", "field", value));
+    ASSERT_EQ(value, "value");
+    ASSERT_FALSE(stateTable.hget("OLD_KEY", "NULL", value));
+
+    auto stats = publisher.getStats();
+    ASSERT_EQ(stats.queued, 3u);
+    ASSERT_EQ(stats.written, 3u);
+    ASSERT_EQ(stats.depth, 0u);
+}
+
+namespace
+{
+
+void waitForWrites(const ResponsePublisher &publisher, uint64_t written)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (publisher.getStats().written < written && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void recordCommands(std::vector<std::string> *commands)
+{
+    std::lock_guard<std::mutex> lock(mockAppendedCommandsLock);
+    mockAppendedCommands = commands;
+}
+
+// Returns the arguments of a formatted redis command.
+std::vector<std::string> parseCommand(const std::string &command)
+{
+    std::vector<std::string> args;
+    size_t pos = command.find("\r\n") + 2;
+    while (pos < command.size())
+    {
+        auto end = command.find("\r\n", pos);
+        auto len = std::stoul(command.substr(pos + 1, end - pos - 1));
+        args.push_back(command.substr(end + 2, len));
+        pos = end + 2 + len + 2;
+    }
+    return args;
+}
+
+// Returns the writes of each multi-key write, as "<key> <op> <field>=<value>...".
+std::vector<std::vector<std::string>> multiWrites(const std::vector<std::string> &commands)
+{
+    std::vector<std::vector<std::string>> writes;
+    for (const auto &command : commands)
+    {
+        auto args = parseCommand(command);
+        if (args.empty() || args[0] != "EVALSHA")
+        {
+            continue;
+        }
+
+        writes.emplace_back();
+        size_t keys = std::stoul(args[2]);
+        size_t i = 3 + keys;
+        for (size_t k = 0; k < keys; k++)
+        {
+            std::string write = args[3 + k] + " " + args[i];
+            size_t fields = std::stoul(args[i + 1]);
+            i += 2;
+            for (size_t f = 0; f < fields; f++, i += 2)
+            {
+                write += " " + args[i] + "=" + args[i + 1];
+            }
+            writes.back().push_back(write);
+        }
+    }
+    return writes;
+}
+
+} // namespace
+
+TEST(ResponsePublisher, TestWriteThread)
+{
+    std::vector<std::string> commands;
+    size_t writers = 0;
+    ResponsePublisher::Stats stats;
+    recordCommands(&commands);
+    {
+        ResponsePublisher publisher{"APPL_STATE_DB", true, true};
+
+        for (int i = 0; i < 100; i++)
+        {
+            publisher.writeToDB("SOME_TABLE", "KEY" + std::to_string(i), {{"field", std::to_string(i)}}, SET_COMMAND);
+        }
+        publisher.writeToDB("SOME_TABLE", "KEY0", {}, DEL_COMMAND);
+        publisher.writeToDB("OTHER_TABLE", "KEY0", {{"field", "0"}}, SET_COMMAND);
+        publisher.flush();
+        waitForWrites(publisher, 102);
+        writers = publisher.m_writers.size();
+        stats = publisher.getStats();
+    }
+    recordCommands(nullptr);
+
+    // Each table has its own write thread.
+    ASSERT_EQ(writers, 2u);
+    ASSERT_EQ(stats.queued, 102u);
+    ASSERT_EQ(stats.written, 102u);
+    ASSERT_EQ(stats.depth, 0u);
+    ASSERT_GE(stats.totalLatencyUs, stats.maxLatencyUs);
+
+    // The writes of a table are done in order.
+    std::vector<std::string> some_table;
+    std::vector<std::string> other_table;
+    for (const auto &writes : multiWrites(commands))
+    {
+        for (const auto &write : writes)
+        {
+            if (write.find("SOME_TABLE:") == 0)
+            {
+                some_table.push_back(write);
+            }
+            else
+            {
+                other_table.push_back(write);
+            }
+        }
+    }
+    ASSERT_EQ(some_table.size(), 101u);
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(some_table[i], "SOME_TABLE:KEY" + std::to_string(i) + " s field=" + std::to_string(i));
+    }
+    ASSERT_EQ(some_table[100], "SOME_TABLE:KEY0 d");
+    ASSERT_EQ(other_table, std::vector<std::string>{"OTHER_TABLE:KEY0 s field=0"});
+}
+
+TEST(ResponsePublisher, TestWriteBatch)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "BATCH_TABLE"};
+    std::string value;
+    std::vector<std::string> commands;
+    recordCommands(&commands);
+    {
+        ResponsePublisher publisher{"APPL_STATE_DB", true, true};
+        auto &w = publisher.getWriter("BATCH_TABLE");
+
+        std::vector<ResponsePublisher::entry> batch;
+        batch.push_back(ResponsePublisher::entry("BATCH_TABLE", "KEY1", {{"field", "1"}}, SET_COMMAND, false));
+        batch.push_back(ResponsePublisher::entry("BATCH_TABLE", "KEY2", {{"field", "2"}}, SET_COMMAND, false));
+        // NULL attributes depend on the existing entry, so they are written
+        // on their own.
+        batch.push_back(ResponsePublisher::entry("BATCH_TABLE", "KEY3", {}, SET_COMMAND, false));
+        batch.push_back(ResponsePublisher::entry("BATCH_TABLE", "KEY1", {{"field", "3"}}, SET_COMMAND, true));
+        batch.push_back(ResponsePublisher::entry("BATCH_TABLE", "KEY4", {}, SET_COMMAND, true));
+        batch.push_back(ResponsePublisher::entry("BATCH_TABLE", "KEY2", {}, DEL_COMMAND, false));
+        publisher.writeBatch(w, batch);
+    }
+    recordCommands(nullptr);
+
+    auto writes = multiWrites(commands);
+    ASSERT_EQ(writes.size(), 2u);
+    ASSERT_EQ(writes[0], (std::vector<std::string>{"BATCH_TABLE:KEY1 s field=1", "BATCH_TABLE:KEY2 s field=2"}));
+    ASSERT_EQ(writes[1], (std::vector<std::string>{"BATCH_TABLE:KEY1 r field=3", "BATCH_TABLE:KEY4 r NULL=NULL",
+                                                   "BATCH_TABLE:KEY2 d"}));
+    ASSERT_TRUE(stateTable.hget("KEY3", "NULL", value));
+}
+
+TEST(ResponsePublisher, TestTotalStats)
+{
+    auto before = ResponsePublisher::getTotalStats()["APPL_STATE_DB"];
+    {
+        ResponsePublisher publisher1{"APPL_STATE_DB"};
+        ResponsePublisher publisher2{"APPL_STATE_DB"};
+
+        publisher1.writeToDB("SOME_TABLE", "KEY1", {{"field", "1"}}, SET_COMMAND);
+        publisher2.writeToDB("SOME_TABLE", "KEY2", {{"field", "2"}}, SET_COMMAND);
+        publisher2.writeToDB("SOME_TABLE", "KEY2", {}, DEL_COMMAND);
+
+        auto totals = ResponsePublisher::getTotalStats();
+        ASSERT_EQ(totals["APPL_STATE_DB"].queued, before.queued + 3);
+        ASSERT_EQ(totals["APPL_STATE_DB"].written, before.written + 3);
+    }
+
+    // A destroyed publisher no longer counts.
+    ASSERT_EQ(ResponsePublisher::getTotalStats()["APPL_STATE_DB"].queued, before.queued);
+}
@@ -4,12 +4,17 @@
 #define protected public
 #include "orch.h"
 #undef protected
+#define private public
+#include "routeorch.h"
+#undef private
 #include "ut_helper.h"
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
 #include "mock_response_publisher.h"
 #include "mock_sai_api.h"
 #include "bulker.h"
+#include <atomic>
+#include <thread>
 
 extern string gMySwitchType;
 
@@ -66,6 +71,8 @@ namespace routeorch_test
     shared_ptr<swss::DBConnector> m_chassis_app_db;
 
     int create_route_count;
+    atomic<bool> block_bulk_create(false);
+    atomic<bool> bulk_create_in_flight(false);
     int set_route_count;
     int remove_route_count;
     int sai_fail_count;
@@ -85,6 +92,13 @@ namespace routeorch_test
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
     {
+        bulk_create_in_flight = true;
+        while (block_bulk_create)
+        {
+            this_thread::yield();
+        }
+        bulk_create_in_flight = false;
+
         create_route_count++;
         return old_create_route_entries(object_count, route_entry, attr_count, attr_list, mode, object_statuses);
     }
@@ -670,6 +684,55 @@ namespace routeorch_test
         ASSERT_EQ(current_set_count, set_route_count);
     }
 
+    TEST_F(RouteOrchTest, RouteOrchAsyncBulkFlushOverlapsNextBatch)
+    {
+        // Flush route bulks asynchronously, as with -P
+        gRouteOrch->m_bulkFlushEvent = new RouteBulkFlushEvent(gRouteOrch);
+        gRouteOrch->addExecutor(gRouteOrch->m_bulkFlushEvent);
+
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        Table routeTable(m_app_db.get(), APP_ROUTE_TABLE_NAME);
+        routeTable.del("1.1.1.0/24");
+        routeTable.del("0.0.0.0/0");
+
+        // First batch, its bulk call is held in flight
+        block_bulk_create = true;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        while (!bulk_create_in_flight)
+        {
+            this_thread::yield();
+        }
+        ASSERT_TRUE(Executor::hasPendingCompletions());
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("2.2.2.0/24")), 0);
+
+        // The next batch is popped while the first one is still in the SAI call
+        routeTable.set("3.3.3.0/24", { {"ifname", "Ethernet0"},
+                                       {"nexthop", "10.0.0.3"}});
+        auto popped = make_shared<std::deque<KeyOpFieldsValuesTuple>>();
+        consumer->getConsumerTable()->pops(*popped);
+        ASSERT_EQ(popped->size(), 1);
+        ASSERT_TRUE(bulk_create_in_flight);
+        ASSERT_TRUE(Executor::hasPendingCompletions());
+
+        // Processing it completes the first batch before touching any route state
+        block_bulk_create = false;
+        consumer->processAnyTask([=]() {
+            consumer->addToSync(popped);
+            consumer->drain();
+        });
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("2.2.2.0/24")), 1);
+
+        // The second batch is in flight now, the flush event completes it
+        gRouteOrch->m_bulkFlushEvent->execute();
+        ASSERT_FALSE(Executor::hasPendingCompletions());
+        ASSERT_EQ(gRouteOrch->m_syncdRoutes[gVirtualRouterId].count(IpPrefix("3.3.3.0/24")), 1);
+        ASSERT_EQ(consumer->m_toSync.size(), 0);
+    }
+
     TEST_F(RouteOrchTest, RouteOrchTestDelSetDiffNexthop)
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
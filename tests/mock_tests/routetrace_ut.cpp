@@ -0,0 +1,129 @@
+#include "ut_helper.h"
+#include "routetrace.h"
+
+namespace routetrace_test
+{
+    using namespace std;
+    using namespace swss;
+
+    struct RouteTraceTest : public ::testing::Test
+    {
+        RouteTracer m_tracer;
+        shared_ptr<DBConnector> m_state_db;
+        shared_ptr<Table> m_trace_table;
+
+        void SetUp() override
+        {
+            m_state_db = make_shared<DBConnector>("STATE_DB", 0);
+            m_trace_table = make_shared<Table>(m_state_db.get(), RouteTracer::TABLE_NAME);
+            m_tracer.setStateTable(m_trace_table.get());
+        }
+    };
+
+    TEST_F(RouteTraceTest, DisabledByDefault)
+    {
+        ASSERT_FALSE(m_tracer.isEnabled());
+        ASSERT_FALSE(m_tracer.isSampled("10.0.0.0/24"));
+
+        m_tracer.stamp("10.0.0.0/24", RouteTracer::ORCH_DOTASK);
+        ASSERT_EQ(m_tracer.openTraces(), 0);
+    }
+
+    TEST_F(RouteTraceTest, SamplingIsDeterministic)
+    {
+        m_tracer.enable("orchagent", 4);
+
+        RouteTracer other;
+        other.enable("fpmsyncd", 4);
+
+        size_t sampled = 0;
+        for (int i = 0; i < 1000; i++)
+        {
+            string key = "10." + to_string(i / 256) + "." + to_string(i % 256) + ".0/24";
+            ASSERT_EQ(m_tracer.isSampled(key), other.isSampled(key));
+            sampled += m_tracer.isSampled(key);
+        }
+
+        ASSERT_GT(sampled, 150);
+        ASSERT_LT(sampled, 350);
+    }
+
+    TEST_F(RouteTraceTest, StagesAndExport)
+    {
+        m_tracer.enable("orchagent", 1);
+
+        auto start = RouteTracer::Clock::now();
+        m_tracer.stamp("10.0.0.0/24", RouteTracer::ORCH_DOTASK, start);
+        m_tracer.stamp("10.1.0.0/24", RouteTracer::ORCH_DOTASK, start);
+        /* Only the first stamp of a stage counts */
+        m_tracer.stamp("10.0.0.0/24", RouteTracer::ORCH_DOTASK, start + chrono::seconds(1));
+        ASSERT_EQ(m_tracer.openTraces(), 2);
+
+        m_tracer.stampAll(RouteTracer::BULK_FLUSH);
+        m_tracer.complete("10.0.0.0/24", RouteTracer::RESPONSE);
+        ASSERT_EQ(m_tracer.openTraces(), 1);
+
+        /* Completing an unknown route does not open a trace */
+        m_tracer.complete("10.2.0.0/24", RouteTracer::RESPONSE);
+        ASSERT_EQ(m_tracer.openTraces(), 1);
+
+        ASSERT_EQ(m_tracer.getHistogram(RouteTracer::ORCH_DOTASK).count, 0);
+        ASSERT_EQ(m_tracer.getHistogram(RouteTracer::BULK_FLUSH).count, 1);
+        ASSERT_EQ(m_tracer.getHistogram(RouteTracer::RESPONSE).count, 1);
+        ASSERT_EQ(m_tracer.getTotalHistogram().count, 1);
+        ASSERT_LT(m_tracer.getTotalHistogram().maxUs, 1000000);
+
+        m_tracer.completeAll(RouteTracer::RESPONSE);
+        ASSERT_EQ(m_tracer.openTraces(), 0);
+        ASSERT_EQ(m_tracer.getTotalHistogram().count, 2);
+
+        m_tracer.exportHistograms();
+
+        string count;
+        ASSERT_TRUE(m_trace_table->hget("orchagent|BULK_FLUSH", "count", count));
+        ASSERT_EQ(count, "2");
+        ASSERT_TRUE(m_trace_table->hget("orchagent|TOTAL", "count", count));
+        ASSERT_EQ(count, "2");
+        ASSERT_FALSE(m_trace_table->hget("orchagent|ORCH_DOTASK", "count", count));
+    }
+
+    TEST_F(RouteTraceTest, OpenTracesAreBounded)
+    {
+        m_tracer.enable("fpmsyncd", 1);
+
+        for (size_t i = 0; i < RouteTracer::MAX_OPEN_TRACES + 10; i++)
+        {
+            m_tracer.stamp(to_string(i), RouteTracer::FPM_RECV);
+        }
+
+        ASSERT_EQ(m_tracer.openTraces(), RouteTracer::MAX_OPEN_TRACES);
+        ASSERT_EQ(m_tracer.droppedTraces(), 10);
+
+        /* Stamping a trace that is already open is not a drop */
+        m_tracer.stamp("0", RouteTracer::APPL_DB_WRITE);
+        ASSERT_EQ(m_tracer.droppedTraces(), 10);
+
+        m_tracer.exportHistograms();
+        string dropped;
+        ASSERT_TRUE(m_trace_table->hget("fpmsyncd|TOTAL", "dropped", dropped));
+        ASSERT_EQ(dropped, "10");
+    }
+
+    TEST_F(RouteTraceTest, HistogramPercentile)
+    {
+        RouteTracer::Histogram h;
+        ASSERT_EQ(h.percentile(0.99), 0);
+
+        for (uint64_t us = 1; us <= 100; us++)
+        {
+            h.add(us);
+        }
+
+        ASSERT_EQ(h.count, 100);
+        ASSERT_EQ(h.maxUs, 100);
+        ASSERT_EQ(h.sumUs, 5050);
+        /* 50 falls into [32, 64) */
+        ASSERT_EQ(h.percentile(0.5), 63);
+        ASSERT_EQ(h.percentile(0.99), 100);
+    }
+}
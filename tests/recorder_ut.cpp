@@ -0,0 +1,119 @@
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+#include "recorder.h"
+
+using namespace std;
+using namespace swss;
+
+TEST(RecRing, PushPopWrap)
+{
+    RecRing ring(16);
+    string out;
+
+    EXPECT_TRUE(ring.push("0123456789", 10));
+    EXPECT_FALSE(ring.push("abcdefg", 7));
+    EXPECT_EQ(ring.pop(out), 10u);
+    EXPECT_EQ(out, "0123456789");
+
+    /* Wraps around the end of the buffer */
+    EXPECT_TRUE(ring.push("abcdefghijkl", 12));
+    EXPECT_EQ(ring.used(), 12u);
+    out.clear();
+    EXPECT_EQ(ring.pop(out), 12u);
+    EXPECT_EQ(out, "abcdefghijkl");
+    EXPECT_EQ(ring.pop(out), 0u);
+}
+
+TEST(BinaryRecord, EncodeDecode)
+{
+    BinaryRecord rec;
+    rec.timestamp = 1700000000123456;
+    rec.key = "ROUTE_TABLE:10.0.0.0/24";
+    rec.op = "SET";
+    rec.fieldValues = { { "nexthop", "10.0.0.1,10.0.0.3" }, { "ifname", "Ethernet0,Ethernet4" } };
+
+    BinaryRecord dropped;
+    dropped.timestamp = 1700000000223456;
+    dropped.type = BinaryRecord::DROPPED;
+    dropped.dropped = 3;
+
+    string data;
+    rec.encode(data);
+    dropped.encode(data);
+
+    istringstream in(data);
+    BinaryRecord decoded;
+    ASSERT_TRUE(decoded.decode(in));
+    EXPECT_EQ(decoded.timestamp, rec.timestamp);
+    EXPECT_EQ(decoded.key, rec.key);
+    EXPECT_EQ(decoded.op, rec.op);
+    EXPECT_EQ(decoded.fieldValues, rec.fieldValues);
+
+    string text = decoded.toText();
+    EXPECT_EQ(text.substr(text.find('|')), "|ROUTE_TABLE:10.0.0.0/24|SET|nexthop:10.0.0.1,10.0.0.3|ifname:Ethernet0,Ethernet4");
+
+    ASSERT_TRUE(decoded.decode(in));
+    EXPECT_EQ(decoded.type, BinaryRecord::DROPPED);
+    EXPECT_EQ(decoded.dropped, 3u);
+
+    EXPECT_FALSE(decoded.decode(in));
+
+    /* A truncated record is not decoded */
+    istringstream truncated(data.substr(0, data.size() - 1));
+    ASSERT_TRUE(decoded.decode(truncated));
+    EXPECT_FALSE(decoded.decode(truncated));
+}
+
+TEST(RecWriter, BinaryRecording)
+{
+    char dir[] = "/tmp/recorder_utXXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+
+    {
+        RecWriter writer;
+        writer.setRecord(true);
+        writer.setRotate(false);
+        writer.setLocation(dir);
+        writer.setFileName("swss.rec");
+        writer.setName("Test");
+        writer.setBinary(true, 4096);
+        writer.startRec(false);
+
+        for (int i = 0; i < 100; i++)
+        {
+            writer.record("PORT_TABLE:Ethernet" + to_string(i), "SET", { { "mtu", "9100" } });
+        }
+    }
+
+    string path = string(dir) + "/swss.rec" + BinaryRecord::SUFFIX;
+    ifstream in(path, ifstream::binary);
+    string magic(BinaryRecord::MAGIC.size(), '\0');
+    ASSERT_TRUE(in.read(&magic[0], magic.size()));
+    EXPECT_EQ(magic, BinaryRecord::MAGIC);
+
+    BinaryRecord rec;
+    ASSERT_TRUE(rec.decode(in));
+    EXPECT_EQ(rec.type, BinaryRecord::START);
+
+    /* Records are in order, with the ones that did not fit counted */
+    uint64_t entries = 0, dropped = 0;
+    while (rec.decode(in))
+    {
+        if (rec.type == BinaryRecord::DROPPED)
+        {
+            dropped += rec.dropped;
+            continue;
+        }
+        ASSERT_EQ(rec.type, BinaryRecord::ENTRY);
+        EXPECT_EQ(rec.op, "SET");
+        entries++;
+    }
+    EXPECT_EQ(entries + dropped, 100u);
+    EXPECT_GT(entries, 0u);
+
+    unlink(path.c_str());
+    rmdir(dir);
+}